@@ -28,6 +28,7 @@ extern    "C"
 #endif
 
 #include "riscv_math_types.h"
+#include "riscv_nn_types.h"
 
 /**
  * @defgroup Convolution Convolution Functions
@@ -4467,6 +4468,14 @@ uint32_t riscv_nn_conv_trans_HWC_s8_s8_s8_sym_bias_any_get_buffer_size(const uin
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - The outputs are computed in gather form, one stride_x * stride_y phase
+ *    at a time, instead of being scattered into a partial-result buffer of
+ *    the output size. tmp_buf holds the sub-kernel of the phase, repacked
+ *    from ker_weight, so its size scales with the weights rather than with
+ *    an output row: out_tensor_ch * 4 bytes of offset terms plus
+ *    (out_tensor_ch + NN_CONV_IM2COL_PIXELS) * ceil(ker_dim_y / stride_y) *
+ *    ceil(ker_dim_x / stride_x) * in_tensor_ch bytes, i.e. about the weight
+ *    size divided by stride_x * stride_y.
  */
 int32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
                                                        const uint16_t in_tensor_dim_x,
@@ -4498,7 +4507,8 @@ int32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
 /**
  * @brief           This function calculates the required size (in bytes) for
  *                  the input temporary buffer needed for
- *                  riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any.
+ *                  riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any. The
+ *                  size follows the weights of one phase, not the tensors.
  * @param[in]       in_tensor_dim_x     X dimension of the input tensor
  * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
  * @param[in]       in_tensor_ch        Number of input tensor channels
@@ -4575,6 +4585,9 @@ uint32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(const ui
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - Each output is accumulated from the input taps that reach it and written
+ *    out directly, so no temporary buffer is needed at present. in_tmp_buf
+ *    could be a null pointer.
  */
 int32_t riscv_nn_conv_trans_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
                                                          const int32_t in_tensor_dim_x,
@@ -4674,6 +4687,9 @@ uint32_t riscv_nn_conv_trans_HWC_s16_s16_s8_asym_bias_any_get_buffer_size(const
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - Each output is accumulated from the input taps that reach it and written
+ *    out directly, so no temporary buffer is needed at present. in_tmp_buf
+ *    could be a null pointer.
  */
 int32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
                                                              const int32_t in_tensor_dim_x,
@@ -4753,7 +4769,10 @@ uint32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any_get_buffer_size(co
  * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
  * @param[in]       tmp_buf             Temporary buffer for calculations. Its
  *                                      needed size could be obtained by calling
- *                                      riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any_get_buffer_size.
+ *                                      riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size.
+ *                                      It could be a null pointer, in which
+ *                                      case the packed weights are unpacked
+ *                                      per MAC.
  * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
  *                  fail to meet the constraints specified in Note below.
  *
@@ -4766,6 +4785,12 @@ uint32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any_get_buffer_size(co
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - With tmp_buf, the weights of every 4 output channels are unpacked once
+ *    into it and reused across all pixels (across every pixel of an output
+ *    row when strided), so the packed layout only costs extra memory traffic
+ *    for the weights, not per MAC. This path runs 4x4 register tiles that
+ *    keep 16 * NN_MAT_MULT_PANEL_ROWS bytes (128 bytes by default) of
+ *    accumulators on the stack.
  */
 int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
                                                      const int32_t in_tensor_dim_x,
@@ -4793,14 +4818,117 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
 /**
  * @brief           This function calculates the required size (in bytes) for
  *                  the input temporary buffer needed for
- *                  riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any.
+ *                  riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any.
  * @param[in]       in_tensor_ch        Number of input tensor channels
  * @param[in]       out_tensor_ch       Number of output tensor channels
- * @return          Returns the required size by the temporary buffer.
+ * @return          Returns the required size by the temporary buffer, which
+ *                  holds one unpacked group of 4 weight rows.
  */
 int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch,
                                                                      const int32_t out_tensor_ch);
 
+/**
+ * @brief           This function performs convolution using a 1x1 kernel on
+ *                  signed 8-bit integers for both inputs and outputs and signed
+ *                  4-bit integers for the kernel weight across any x and y
+ *                  dimensions, applying asymmetric quantization to the outputs.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[in]       out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max              Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       tmp_buf             Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any_get_buffer_size.
+ *                                      It could be a null pointer, in which
+ *                                      case the packed weights are unpacked
+ *                                      per MAC.
+ * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
+ *                  fail to meet the constraints specified in Note below.
+ *
+ * @note
+ *  - The input constraints of this function are:
+ *     - pad_x is 0
+ *     - pad_y is 0
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to
+ *    left shift calculation results whereas a negative one is used to right
+ *    shift.
+ *  - It runs as riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any, except that
+ *    with a stride other than 1 and a tmp_buf, the strided input pixels are
+ *    gathered into tmp_buf in tiles of up to NN_CONV_1X1_GATHER_BYTES bytes
+ *    that run across output rows and batches. The weights are then unpacked
+ *    once per tile instead of once per output row.
+ */
+int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any(const int8_t * in_tensor,
+                                                          const int32_t in_tensor_dim_x,
+                                                          const int32_t in_tensor_dim_y,
+                                                          const int32_t in_tensor_ch,
+                                                          const int32_t in_tensor_batch,
+                                                          const int8_t * ker_weight,
+                                                          const int32_t out_tensor_ch,
+                                                          const int32_t pad_x,
+                                                          const int32_t pad_y,
+                                                          const int32_t stride_x,
+                                                          const int32_t stride_y,
+                                                          const int32_t * bias,
+                                                          int8_t * out_tensor,
+                                                          const int32_t * out_shift,
+                                                          const int32_t * out_scale,
+                                                          const int32_t out_offset,
+                                                          const int32_t in_offset,
+                                                          const int32_t act_min,
+                                                          const int32_t act_max,
+                                                          const int32_t out_tensor_dim_x,
+                                                          const int32_t out_tensor_dim_y,
+                                                          int8_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the input temporary buffer needed for
+ *                  riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @return          Returns the required size by the temporary buffer, which
+ *                  holds one unpacked group of 4 weight rows and, when
+ *                  strided, a tile of gathered input pixels.
+ */
+int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any_get_buffer_size(const int32_t in_tensor_ch,
+                                                                          const int32_t out_tensor_ch,
+                                                                          const int32_t stride_x,
+                                                                          const int32_t stride_y,
+                                                                          const int32_t out_tensor_dim_x,
+                                                                          const int32_t out_tensor_dim_y);
+
 /**
  * @brief           This function performs convolution using a 1x1 kernel on
  *                  signed 8-bit integers for inputs, outputs and kernel weight
@@ -4838,6 +4966,7 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32
  * @param[in]       tmp_buf             Temporary buffer for calculations. Its
  *                                      needed size could be obtained by calling
  *                                      riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size.
+ *                                      It should be 4-byte aligned.
  * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
  *                  fail to meet the constraints specified in Note below.
  *
@@ -4849,6 +4978,14 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32
  *    function.
  * - During the quantization process, a positive out_shift value is used to left
  *   shift calculation results whereas a negative one is used to right shift.
+ * - tmp_buf is only used with a stride other than 1; its size is 0
+ *   otherwise. It holds the per-channel offset contributions (bias +
+ *   in_offset * sum of the weights), computed once per call, and the strided
+ *   input pixels, gathered into tiles of up to NN_CONV_1X1_GATHER_BYTES bytes
+ *   that run across output rows and batches, one matrix multiplication per
+ *   tile. If the bias already includes the contributions (see
+ *   riscv_nn_kernel_sum_s8) and in_offset is 0, the weights are not summed at
+ *   all. A NULL tmp_buf is allowed but slower.
  */
 int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const int8_t * in_tensor,
                                                           const uint16_t in_tensor_dim_x,
@@ -4876,7 +5013,7 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const int8_t * in_tens
 /**
  * @brief           This function calculates the required length for the input
  *                  temporary buffer needed for
- *                  riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size.
+ *                  riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any.
  * @param[in]       in_tensor_dim_x     X dimension of the input tensor
  * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
  * @param[in]       in_tensor_ch        Number of input tensor channels
@@ -4887,7 +5024,8 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const int8_t * in_tens
  * @param[in]       stride_y            Convolution stride in the y dimension
  * @param[in]       out_tensor_dim_x    X dimension of the output tensor
  * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
- * @return          Returns the required length of the temporary buffer.
+ * @return          Returns the required length of the temporary buffer in
+ *                  bytes.
  */
 int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size(const uint16_t in_tensor_dim_x,
                                                                           const uint16_t in_tensor_dim_y,
@@ -5370,10 +5508,14 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(const uint16_t
  * @param[in]       dilation_x          Dilation factor for the x dimension
  * @param[in]       dilation_y          Dilation factor for the y dimension
  * @param[in]       in_tmp_buf          Temporary buffer for the input tensor.
- *                                      It is required when -mext-dsp or
- *                                      -mext-vector is enabled and its needed
- *                                      size could be obtained by calling riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size.
- * @return          This function only returns 0.
+ *                                      Its needed size could be obtained by
+ *                                      calling riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size
+ *                                      and it should be 4-byte aligned. It
+ *                                      could be a null pointer, in which case
+ *                                      a slower direct convolution is used.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if in_tensor_ch or out_tensor_ch is not a multiple of
+ *                  in_tensor_ch / ker_ch.
  *
  * @note
  *  - bias could be a null pointer as the bias vector is optional for this
@@ -5381,6 +5523,14 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(const uint16_t
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - With in_tmp_buf, a few output pixels at a time are gathered (im2col)
+ *    into the buffer and multiplied with the weights by
+ *    riscv_nn_mat_mult_nt_t_s8_core. Dilation and grouped convolution
+ *    (ker_ch < in_tensor_ch) are handled on this path as well, one matrix
+ *    multiplication per group over its channel range.
+ *  - A 1x1 kernel without padding skips the gathering: the matrix
+ *    multiplication reads each group's channels in place, so grouped 1x1
+ *    convolutions cost no more per MAC than dense ones.
  */
 int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(const int8_t * in_tensor,
                                                          const uint16_t in_tensor_dim_x,
@@ -5414,9 +5564,10 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(const int8_t * in_tenso
  * @brief           This function calculates the required size (in bytes) for
  *                  the input temporary buffer needed for
  *                  riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated.
- * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_ch              Number of filter kernel channels
  * @param[in]       ker_dim_x           X dimension of the filter kernel
  * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       out_tensor_ch       Number of output tensor channels
  * @return          Returns the required size of the temporary buffer.
  */
 int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size(const uint16_t ker_ch,
@@ -5424,6 +5575,103 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size(const u
                                                                          const uint16_t ker_dim_y,
                                                                          const uint16_t out_tensor_ch);
 
+/**
+ * @brief           This function transforms 3x3 kernel weights offline into
+ *                  the Winograd F(2x2, 3x3) domain used by
+ *                  riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any.
+ * @param[in]       ker_weight          Pointer of kernel weights in the same
+ *                                      layout as for
+ *                                      riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[out]      wino_weight         Pointer to the transformed weights. Its
+ *                                      size must be
+ *                                      "16 * in_tensor_ch * out_tensor_ch".
+ * @return          This function only returns 0.
+ */
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_weight_transform(const int8_t * ker_weight,
+                                                           const uint16_t in_tensor_ch,
+                                                           const uint16_t out_tensor_ch,
+                                                           int16_t * wino_weight);
+
+/**
+ * @brief           This function performs convolution using 3x3 kernel and
+ *                  stride 1 with signed 8-bit integers for both inputs and
+ *                  outputs, applying asymmetric quantization to the outputs.
+ *                  It uses the Winograd F(2x2, 3x3) algorithm.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       wino_weight         Pointer of kernel weights transformed
+ *                                      by riscv_nn_conv_HWC_3x3_winograd_s8_weight_transform
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       tmp_buf             Temporary buffer for the transformed
+ *                                      input tiles. Its needed size could be
+ *                                      obtained by calling
+ *                                      riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if in_tensor_ch is larger than 1824.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - The results are bit-exact with riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any.
+ *    The weights are transformed with 2G so that they stay exact in 16 bits,
+ *    and the output transform yields exactly 4 times the direct sum.
+ *  - It uses 16 multiplications for every 2x2 outputs instead of 36.
+ */
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+                                                              const uint16_t in_tensor_dim_x,
+                                                              const uint16_t in_tensor_dim_y,
+                                                              const uint16_t in_tensor_ch,
+                                                              const uint16_t in_tensor_batch,
+                                                              const int16_t * wino_weight,
+                                                              const uint16_t out_tensor_ch,
+                                                              const uint16_t pad_x,
+                                                              const uint16_t pad_y,
+                                                              const int32_t * bias,
+                                                              int8_t * out_tensor,
+                                                              const int32_t * out_shift,
+                                                              const int32_t * out_scale,
+                                                              const int32_t out_offset,
+                                                              const int32_t in_offset,
+                                                              const int32_t act_min,
+                                                              const int32_t act_max,
+                                                              const uint16_t out_tensor_dim_x,
+                                                              const uint16_t out_tensor_dim_y,
+                                                              int16_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @return          Returns the required size of the temporary buffer.
+ */
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any_get_buffer_size(const uint16_t in_tensor_ch);
+
 /**
  * @brief           This function performs convolution with signed 16-bit
  *                  integers for both inputs and outputs across any x and y
@@ -5719,6 +5967,141 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_get_buffer_size(const int32_t in
                                                                 const int32_t dilation_x,
                                                                 const int32_t dilation_y);
 
+/**
+ * @brief           This function calculates the size (in bytes) of the
+ *                  packed weights produced by
+ *                  riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @return          Returns the size of the packed weights.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack_get_size(const int32_t in_tensor_ch,
+                                                             const int32_t out_tensor_ch,
+                                                             const int32_t ker_dim_x,
+                                                             const int32_t ker_dim_y);
+
+/**
+ * @brief           This function reorders the 4-bit kernel weights of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym once, e.g. at model
+ *                  load, into the panel layout read by the matrix
+ *                  multiplication micro-kernels. The packed weights are used by
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed.
+ * @param[in]       ker_weight          Pointer of packed 4-bit kernel weights
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[out]      packed_weight       Pointer to the packed weights. Its size
+ *                                      could be obtained by calling
+ *                                      riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack_get_size
+ *                                      and it should be 4-byte aligned.
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - The weights are unpacked to 8 bits, so the packed weights take about
+ *    twice the memory of the 4-bit ones; in return, inference neither
+ *    unpacks nibbles nor does strided weight loads.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack(const int8_t * ker_weight,
+                                                    const int32_t in_tensor_ch,
+                                                    const int32_t out_tensor_ch,
+                                                    const int32_t ker_dim_x,
+                                                    const int32_t ker_dim_y,
+                                                    int8_t * packed_weight);
+
+/**
+ * @brief           This function performs the same convolution as
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym on weights packed
+ *                  by riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       packed_weight       Pointer of packed kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       dilation_x          Dilation factor for the x dimension
+ * @param[in]       dilation_y          Dilation factor for the y dimension
+ * @param[in]       in_tmp_buf          Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed_get_buffer_size
+ *                                      and it should be 4-byte aligned.
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - The stack usage is that of
+ *    riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed(const int8_t * in_tensor,
+                                                       const int32_t in_tensor_dim_x,
+                                                       const int32_t in_tensor_dim_y,
+                                                       const int32_t in_tensor_ch,
+                                                       const int32_t in_tensor_batch,
+                                                       const int8_t * packed_weight,
+                                                       const int32_t out_tensor_ch,
+                                                       const int32_t ker_dim_x,
+                                                       const int32_t ker_dim_y,
+                                                       const int32_t pad_x,
+                                                       const int32_t pad_y,
+                                                       const int32_t stride_x,
+                                                       const int32_t stride_y,
+                                                       const int32_t * bias,
+                                                       int8_t * out_tensor,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const int32_t out_offset,
+                                                       const int32_t in_offset,
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const int32_t out_tensor_dim_x,
+                                                       const int32_t out_tensor_dim_y,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y,
+                                                       int8_t * in_tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @return          Returns the required size of the temporary buffer.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed_get_buffer_size(const int32_t in_tensor_ch,
+                                                                       const int32_t out_tensor_ch,
+                                                                       const int32_t ker_dim_x,
+                                                                       const int32_t ker_dim_y);
+
 /**
  * @brief           This is a wrapper function for
  *                  riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any,
@@ -5769,6 +6152,20 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_get_buffer_size(const int32_t in
  *    function.
  *  - During the quantization process, a positive out_shift value is used to left
  *    shift calculation results whereas a negative one is used to right shift.
+ *  - For a 1x1 kernel without padding or dilation, the kernel sums from
+ *    riscv_nn_kernel_sum_s8 can be passed as bias together with an in_offset
+ *    of 0.
+ *  - For a 1x1 kernel without padding or dilation, in_tmp_buf also selects
+ *    the faster matrix multiplication that reuses the per-channel offset
+ *    contributions it holds, so it should be provided even without
+ *    -mext-dsp or -mext-vector.
+ *  - Other kernels use the im2col path of
+ *    riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated when in_tmp_buf is
+ *    provided. With ENA_CONV_WINOGRAD_IN_WRAPPER defined in the library,
+ *    3x3 stride-1 kernels use
+ *    riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any instead.
+ *  - Grouped convolutions (ker_ch < in_tensor_ch), 1x1 ones included, take
+ *    the same path with one matrix multiplication per group.
  */
 int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(const int8_t * in_tensor,
                                                 const uint16_t in_tensor_dim_x,
@@ -5834,19 +6231,21 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(const uint16_t i
                                                                 const int32_t dilation_y);
 
 /**
- * @brief           This is a wrapper function for
- *                  riscv_nn_conv_HWC_s16_s16_s8_asym_bias_any and
- *                  riscv_nn_conv_HWC_s16_s16_s8_asym_bias_fast_any. This
- *                  function calls one of the two convolution functions
- *                  according to the provided parameters.
+ * @brief           This function performs the convolution of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym followed by the
+ *                  element-wise addition of a residual (skip) tensor, as
+ *                  riscv_nn_ew_add_s8_asym would, without writing the
+ *                  convolution outputs to memory.
  * @param[in]       in_tensor           Pointer to the input tensor
  * @param[in]       in_tensor_dim_x     X dimension of the input tensor
  * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
  * @param[in]       in_tensor_ch        Number of input tensor channels
  * @param[in]       in_tensor_batch     Size of input tensor batches
  * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
  * @param[in]       ker_dim_x           X dimension of the filter kernel
  * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
  * @param[in]       pad_x               Padding size in the x dimension
  * @param[in]       pad_y               Padding size in the y dimension
  * @param[in]       stride_x            Convolution stride in the x dimension
@@ -5854,35 +6253,581 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(const uint16_t i
  * @param[in]       bias                Pointer to the bias vector
  * @param[out]      out_tensor          Pointer to the output tensor
  * @param[in]       out_shift           Pointer to the shift vector for the
- *                                      quantization on outputs
+ *                                      quantization on convolution outputs
  * @param[in]       out_scale           Pointer to the scaling vector for the
- *                                      quantization on outputs
- * @param[in]       out_offset          Dummy
- * @param[in]       in_offset           Dummy
- * @param[in]       act_min             Minimum value that the output tensor is
- *                                      limited to. It should be in the range of
- *                                      -32768 to 32767.
- * @param[in]       act_max             Maximum value that the output tensor is
- *                                      limited to. It should be in the range of
- *                                      -32768 to 32767.
- * @param[in]       out_tensor_ch       Number of output tensor channels
+ *                                      quantization on convolution outputs
+ * @param[in]       out_offset          Offset value for the convolution
+ *                                      outputs. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the convolution
+ *                                      outputs are limited to. It should be in
+ *                                      the range of -128 to 127.
+ * @param[in]       act_max             Maximum value that the convolution
+ *                                      outputs are limited to. It should be in
+ *                                      the range of -128 to 127.
  * @param[in]       out_tensor_dim_x    X dimension of the output tensor
  * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
- * @param[in]       dilation_x          Dilation factor for the x dimension
- * @param[in]       dilation_y          Dilation factor for the y dimension
- * @param[in]       in_tmp_buf          Dummy
- * @return          This function only returns 0.
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @param[in]       residual            Pointer to the residual tensor and the
+ *                                      quantization of the addition. It could
+ *                                      be a null pointer to run the
+ *                                      convolution alone.
+ * @param[in]       in_tmp_buf          Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if in_tensor_ch is not a multiple of ker_ch, if
+ *                  out_tensor_ch is not a multiple of the number of groups, or
+ *                  if in_tmp_buf is a null pointer while it is needed.
  *
  * @note
- *  - bias could be a null pointer as the bias vector is optional for this
- *    function.
- *  - During the quantization process, a positive out_shift value is used to
- *    left shift calculation results whereas a negative one is used to right
- *    shift.
+ *  - The residual is added in the requantization epilogue of the matrix
+ *    multiplication (riscv_nn_mat_mult_nt_t_s8_add), so every output is
+ *    stored to out_tensor once. The input pixels of one output row at a time
+ *    are gathered into in_tmp_buf; 1x1 layers at stride 1 without padding or
+ *    groups read them in place and need no in_tmp_buf. The results are
+ *    bit-exact with riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym followed by
+ *    riscv_nn_ew_add_s8_asym, with the convolution outputs as in_vec1.
+ *  - out_tensor may be the same as residual->in_tensor.
  */
-int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym(const int16_t * in_tensor,
-                                                  const int32_t in_tensor_dim_x,
-                                                  const int32_t in_tensor_dim_y,
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add(const int8_t * in_tensor,
+                                                    const uint16_t in_tensor_dim_x,
+                                                    const uint16_t in_tensor_dim_y,
+                                                    const uint16_t in_tensor_ch,
+                                                    const uint16_t in_tensor_batch,
+                                                    const int8_t * ker_weight,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    const uint16_t pad_x,
+                                                    const uint16_t pad_y,
+                                                    const uint16_t stride_x,
+                                                    const uint16_t stride_y,
+                                                    const int32_t * bias,
+                                                    int8_t * out_tensor,
+                                                    const int32_t * out_shift,
+                                                    const int32_t * out_scale,
+                                                    const int32_t out_offset,
+                                                    const int32_t in_offset,
+                                                    const int32_t act_min,
+                                                    const int32_t act_max,
+                                                    const uint16_t out_tensor_dim_x,
+                                                    const uint16_t out_tensor_dim_y,
+                                                    const int32_t dilation_x,
+                                                    const int32_t dilation_y,
+                                                    const riscv_nn_residual_add_params * residual,
+                                                    int16_t * in_tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add.
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @return          Returns the required size of the temporary buffer.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                    const uint16_t in_tensor_dim_y,
+                                                                    const uint16_t in_tensor_ch,
+                                                                    const uint16_t in_tensor_batch,
+                                                                    const uint16_t ker_dim_x,
+                                                                    const uint16_t ker_dim_y,
+                                                                    const uint16_t ker_ch,
+                                                                    const uint16_t pad_x,
+                                                                    const uint16_t pad_y,
+                                                                    const uint16_t stride_x,
+                                                                    const uint16_t stride_y,
+                                                                    const uint16_t out_tensor_dim_x,
+                                                                    const uint16_t out_tensor_dim_y,
+                                                                    const uint16_t out_tensor_ch,
+                                                                    const int32_t dilation_x,
+                                                                    const int32_t dilation_y);
+
+/**
+ * @brief           This function performs the convolution of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym followed by a max
+ *                  or average pooling layer, without writing the
+ *                  full-resolution convolution outputs to memory.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the pooled output tensor of
+ *                                      pool->out_tensor_dim_x by
+ *                                      pool->out_tensor_dim_y pixels
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on convolution outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on convolution outputs
+ * @param[in]       out_offset          Offset value for the convolution
+ *                                      outputs. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the convolution
+ *                                      outputs are limited to. It should be in
+ *                                      the range of -128 to 127.
+ * @param[in]       act_max             Maximum value that the convolution
+ *                                      outputs are limited to. It should be in
+ *                                      the range of -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the convolution outputs
+ * @param[in]       out_tensor_dim_y    Y dimension of the convolution outputs
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @param[in]       pool                Pointer to the pooling window, pooled
+ *                                      output size and activation
+ * @param[in]       in_tmp_buf          Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if in_tmp_buf is a null pointer, pool->stride_y is not
+ *                  positive, or the last convolution rows read nothing but
+ *                  padding.
+ *
+ * @note
+ *  - For every pooled output row, only the convolution rows under its window
+ *    are computed, into a buffer of pool->ker_dim_y rows that keeps the rows
+ *    shared with the next window. The results are bit-exact with
+ *    riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym followed by
+ *    riscv_nn_maxpool_HWC_s8_any_act or riscv_nn_avepool_HWC_s8_any_act.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool(const int8_t * in_tensor,
+                                                     const uint16_t in_tensor_dim_x,
+                                                     const uint16_t in_tensor_dim_y,
+                                                     const uint16_t in_tensor_ch,
+                                                     const uint16_t in_tensor_batch,
+                                                     const int8_t * ker_weight,
+                                                     const uint16_t out_tensor_ch,
+                                                     const uint16_t ker_dim_x,
+                                                     const uint16_t ker_dim_y,
+                                                     const uint16_t ker_ch,
+                                                     const uint16_t pad_x,
+                                                     const uint16_t pad_y,
+                                                     const uint16_t stride_x,
+                                                     const uint16_t stride_y,
+                                                     const int32_t * bias,
+                                                     int8_t * out_tensor,
+                                                     const int32_t * out_shift,
+                                                     const int32_t * out_scale,
+                                                     const int32_t out_offset,
+                                                     const int32_t in_offset,
+                                                     const int32_t act_min,
+                                                     const int32_t act_max,
+                                                     const uint16_t out_tensor_dim_x,
+                                                     const uint16_t out_tensor_dim_y,
+                                                     const int32_t dilation_x,
+                                                     const int32_t dilation_y,
+                                                     const riscv_nn_pool_params * pool,
+                                                     int16_t * in_tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool.
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       out_tensor_dim_x    X dimension of the convolution outputs
+ * @param[in]       out_tensor_dim_y    Y dimension of the convolution outputs
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @param[in]       pool                Pointer to the pooling parameters
+ * @return          Returns the required size of the temporary buffer.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                     const uint16_t in_tensor_dim_y,
+                                                                     const uint16_t in_tensor_ch,
+                                                                     const uint16_t in_tensor_batch,
+                                                                     const uint16_t ker_dim_x,
+                                                                     const uint16_t ker_dim_y,
+                                                                     const uint16_t ker_ch,
+                                                                     const uint16_t pad_x,
+                                                                     const uint16_t pad_y,
+                                                                     const uint16_t stride_x,
+                                                                     const uint16_t stride_y,
+                                                                     const uint16_t out_tensor_dim_x,
+                                                                     const uint16_t out_tensor_dim_y,
+                                                                     const uint16_t out_tensor_ch,
+                                                                     const int32_t dilation_x,
+                                                                     const int32_t dilation_y,
+                                                                     const riscv_nn_pool_params * pool);
+
+/**
+ * @brief           This function sets up stream to run
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym on one input image
+ *                  fed row by row through riscv_nn_conv_stream_push_row_s8.
+ *                  Only the input rows under the current output row's window
+ *                  are kept, so the whole input never has to be in memory.
+ * @param[out]      stream              Pointer to the stream state
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @param[in]       stream_buf          Buffer for the held input rows and the
+ *                                      convolution scratch. It must stay valid
+ *                                      while stream is used and its needed size
+ *                                      could be obtained by calling
+ *                                      riscv_nn_conv_HWC_s8_s8_s8_asym_stream_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if stream or stream_buf is a null pointer, stride_y or
+ *                  dilation_y is not positive, or the last output rows read
+ *                  nothing but padding.
+ *
+ * @note
+ *  - The weights, bias and quantization vectors are referenced, not copied.
+ *  - The results are bit-exact with riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym
+ *    on a batch of one.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init(riscv_nn_conv_stream * stream,
+                                                    const uint16_t in_tensor_dim_x,
+                                                    const uint16_t in_tensor_dim_y,
+                                                    const uint16_t in_tensor_ch,
+                                                    const int8_t * ker_weight,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    const uint16_t pad_x,
+                                                    const uint16_t pad_y,
+                                                    const uint16_t stride_x,
+                                                    const uint16_t stride_y,
+                                                    const int32_t * bias,
+                                                    const int32_t * out_shift,
+                                                    const int32_t * out_scale,
+                                                    const int32_t out_offset,
+                                                    const int32_t in_offset,
+                                                    const int32_t act_min,
+                                                    const int32_t act_max,
+                                                    const uint16_t out_tensor_dim_x,
+                                                    const uint16_t out_tensor_dim_y,
+                                                    const int32_t dilation_x,
+                                                    const int32_t dilation_y,
+                                                    int8_t * stream_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the buffer needed for
+ *                  riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init.
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       dilation_x          Dilation value along the x dimension
+ * @param[in]       dilation_y          Dilation value along the y dimension
+ * @return          Returns the required size of the buffer.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_stream_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                               const uint16_t in_tensor_dim_y,
+                                                               const uint16_t in_tensor_ch,
+                                                               const uint16_t ker_dim_x,
+                                                               const uint16_t ker_dim_y,
+                                                               const uint16_t ker_ch,
+                                                               const uint16_t pad_x,
+                                                               const uint16_t pad_y,
+                                                               const uint16_t stride_x,
+                                                               const uint16_t stride_y,
+                                                               const uint16_t out_tensor_dim_x,
+                                                               const uint16_t out_tensor_ch,
+                                                               const int32_t dilation_x,
+                                                               const int32_t dilation_y);
+
+/**
+ * @brief           This function feeds the next input row to a stream set up by
+ *                  riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init or
+ *                  riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init and writes
+ *                  the output rows that the row completes.
+ * @param[in,out]   stream              Pointer to the stream state
+ * @param[in]       in_row              Pointer to the input row of
+ *                                      in_tensor_dim_x by in_tensor_ch values
+ * @param[out]      out_rows            Pointer to room for stream->max_out_rows
+ *                                      output rows of out_tensor_dim_x by
+ *                                      out_tensor_ch values
+ * @return          This function returns the number of output rows written,
+ *                  which are the rows following the ones returned by the
+ *                  previous pushes; otherwise, it returns -1 if the
+ *                  convolution fails.
+ *
+ * @note
+ *  - An output row is written by the push of the last input row under its
+ *    window, so only the last input row of a frame can complete more than one.
+ *    Input rows between two windows of a stride larger than the kernel are not
+ *    kept.
+ *  - The push of the last input row also resets stream, so the rows of the
+ *    next frame could be pushed right after it.
+ */
+int32_t riscv_nn_conv_stream_push_row_s8(riscv_nn_conv_stream * stream,
+                                         const int8_t * in_row,
+                                         int8_t * out_rows);
+
+/**
+ * @brief           This function calculates the size (in bytes) of the
+ *                  packed weights produced by
+ *                  riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack.
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @return          Returns the size of the packed weights.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack_get_size(const uint16_t out_tensor_ch,
+                                                             const uint16_t ker_dim_x,
+                                                             const uint16_t ker_dim_y,
+                                                             const uint16_t ker_ch);
+
+/**
+ * @brief           This function reorders the kernel weights of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym once, e.g. at model
+ *                  load, into the panel layout read by the matrix
+ *                  multiplication micro-kernels. The packed weights are used by
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed.
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[out]      packed_weight       Pointer to the packed weights. Its size
+ *                                      could be obtained by calling
+ *                                      riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack_get_size
+ *                                      and it should be 4-byte aligned.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if in_tensor_ch or out_tensor_ch is not a multiple of
+ *                  in_tensor_ch / ker_ch.
+ *
+ * @note
+ *  - Within every group, each set of 4 output channels is interleaved
+ *    column by column and the remaining output channels are kept in row
+ *    order. The per-channel weight sums follow the weights, so inference
+ *    does not read the weights to apply in_offset.
+ */
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack(const int8_t * ker_weight,
+                                                    const uint16_t in_tensor_ch,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    int8_t * packed_weight);
+
+/**
+ * @brief           This function performs the same convolution as
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym on weights packed
+ *                  by riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       packed_weight       Pointer of packed kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       dilation_x          Dilation factor for the x dimension
+ * @param[in]       dilation_y          Dilation factor for the y dimension
+ * @param[in]       in_tmp_buf          Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed_get_buffer_size
+ *                                      and it should be 4-byte aligned.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if in_tensor_ch or out_tensor_ch is not a multiple of
+ *                  in_tensor_ch / ker_ch.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - The results are bit-exact with riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym.
+ *  - The packed weights are multiplied with 4x4 register tiles that keep
+ *    16 * NN_MAT_MULT_PANEL_ROWS bytes (128 bytes by default) of
+ *    accumulators on the stack.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed(const int8_t * in_tensor,
+                                                       const uint16_t in_tensor_dim_x,
+                                                       const uint16_t in_tensor_dim_y,
+                                                       const uint16_t in_tensor_ch,
+                                                       const uint16_t in_tensor_batch,
+                                                       const int8_t * packed_weight,
+                                                       const uint16_t out_tensor_ch,
+                                                       const uint16_t ker_dim_x,
+                                                       const uint16_t ker_dim_y,
+                                                       const uint16_t ker_ch,
+                                                       const uint16_t pad_x,
+                                                       const uint16_t pad_y,
+                                                       const uint16_t stride_x,
+                                                       const uint16_t stride_y,
+                                                       const int32_t * bias,
+                                                       int8_t * out_tensor,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const int32_t out_offset,
+                                                       const int32_t in_offset,
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const uint16_t out_tensor_dim_x,
+                                                       const uint16_t out_tensor_dim_y,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y,
+                                                       int16_t * in_tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed.
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @return          Returns the required size of the temporary buffer.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed_get_buffer_size(const uint16_t out_tensor_ch,
+                                                                       const uint16_t ker_dim_x,
+                                                                       const uint16_t ker_dim_y,
+                                                                       const uint16_t ker_ch);
+
+/**
+ * @brief           This is a wrapper function for
+ *                  riscv_nn_conv_HWC_s16_s16_s8_asym_bias_any and
+ *                  riscv_nn_conv_HWC_s16_s16_s8_asym_bias_fast_any. This
+ *                  function calls one of the two convolution functions
+ *                  according to the provided parameters.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_offset          Dummy
+ * @param[in]       in_offset           Dummy
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -32768 to 32767.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -32768 to 32767.
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       dilation_x          Dilation factor for the x dimension
+ * @param[in]       dilation_y          Dilation factor for the y dimension
+ * @param[in]       in_tmp_buf          Dummy
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to
+ *    left shift calculation results whereas a negative one is used to right
+ *    shift.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym(const int16_t * in_tensor,
+                                                  const int32_t in_tensor_dim_x,
+                                                  const int32_t in_tensor_dim_y,
                                                   const int32_t in_tensor_ch,
                                                   const int32_t in_tensor_batch,
                                                   const int8_t * ker_weight,
@@ -5919,28 +6864,272 @@ int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym(const int16_t * in_tensor,
  * @param[in]       dilation_y      Dilation factor for the y dimension
  * @return          Returns the required size of the temporary buffer.
  */
-int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym_get_buffer_size(const int32_t in_tensor_ch,
-                                                                  const int32_t ker_dim_x,
-                                                                  const int32_t ker_dim_y,
-                                                                  const int32_t dilation_x,
-                                                                  const int32_t dilation_y);
+int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym_get_buffer_size(const int32_t in_tensor_ch,
+                                                                  const int32_t ker_dim_x,
+                                                                  const int32_t ker_dim_y,
+                                                                  const int32_t dilation_x,
+                                                                  const int32_t dilation_y);
+
+/**
+ * @brief           This function performs depthwise convolution with signed
+ *                  8-bit integers for both inputs and outputs and signed
+ *                  4-bit integers for the kernel weights across any x and
+ *                  y dimensions, applying asymmetric quantization to the
+ *                  outputs.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       dilation_x          Dilation factor for the x dimension
+ * @param[in]       dilation_y          Dilation factor for the y dimension
+ * @param[in]       tmp_buf             Temporary buffer for calculations. Its
+ *                                      needed size could be obtained by calling
+ *                                      riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size.
+ *                                      It could be a null pointer.
+ * @return          Returns 0 if successful
+ *
+ * @note
+ *  - With tmp_buf, a 3x3 kernel with ch_mult equal to 1 runs
+ *    riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any, which unpacks the
+ *    weights once instead of for every output pixel.
+ */
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
+                                                    const int32_t in_tensor_batch,
+                                                    const int32_t in_tensor_dim_x,
+                                                    const int32_t in_tensor_dim_y,
+                                                    const int32_t in_tensor_ch,
+                                                    const int8_t * ker_weight,
+                                                    const int32_t out_tensor_ch,
+                                                    const int32_t ch_mult,
+                                                    const int32_t ker_dim_x,
+                                                    const int32_t ker_dim_y,
+                                                    const int32_t pad_x,
+                                                    const int32_t pad_y,
+                                                    const int32_t stride_x,
+                                                    const int32_t stride_y,
+                                                    const int32_t * bias,
+                                                    int8_t * out_tensor,
+                                                    const int32_t * out_shift,
+                                                    const int32_t * out_scale,
+                                                    const int32_t out_tensor_dim_x,
+                                                    const int32_t out_tensor_dim_y,
+                                                    const int32_t out_offset,
+                                                    const int32_t in_offset,
+                                                    const int32_t act_min,
+                                                    const int32_t act_max,
+                                                    const int32_t dilation_x,
+                                                    const int32_t dilation_y,
+                                                    int8_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the input temporary buffer needed for
+ *                  riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @return          Returns the required size by the temporary buffer.
+ */
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch,
+                                                                    const int32_t ker_dim_x,
+                                                                    const int32_t ker_dim_y,
+                                                                    const int32_t ch_mult);
+
+/**
+ * @brief           This function performs depthwise convolution using a 3x3
+ *                  kernel with signed 8-bit integers for both inputs and
+ *                  outputs and signed 4-bit integers for the kernel weights
+ *                  across any x and y dimensions, applying asymmetric
+ *                  quantization to the outputs.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer of kernel weights, packed as
+ *                                      for riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       dilation_x          Dilation factor for the x dimension
+ * @param[in]       dilation_y          Dilation factor for the y dimension
+ * @param[in]       tmp_buf             Temporary buffer for the unpacked
+ *                                      weights. Its needed size could be
+ *                                      obtained by calling
+ *                                      riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any_get_buffer_size.
+ * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
+ *                  fail to meet the constraints specified in Note below.
+ *
+ * @note
+ *  - The input constraints of this function are:
+ *     - in_tensor_ch is equal to out_tensor_ch
+ *     - tmp_buf is not a null pointer
+ *  - The weights are unpacked into tmp_buf once per call and the batches then
+ *    run through riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any.
+ */
+int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
+                                                        const int32_t in_tensor_batch,
+                                                        const int32_t in_tensor_dim_x,
+                                                        const int32_t in_tensor_dim_y,
+                                                        const int32_t in_tensor_ch,
+                                                        const int8_t * ker_weight,
+                                                        const int32_t out_tensor_ch,
+                                                        const int32_t pad_x,
+                                                        const int32_t pad_y,
+                                                        const int32_t stride_x,
+                                                        const int32_t stride_y,
+                                                        const int32_t * bias,
+                                                        int8_t * out_tensor,
+                                                        const int32_t * out_shift,
+                                                        const int32_t * out_scale,
+                                                        const int32_t out_tensor_dim_x,
+                                                        const int32_t out_tensor_dim_y,
+                                                        const int32_t out_offset,
+                                                        const int32_t in_offset,
+                                                        const int32_t act_min,
+                                                        const int32_t act_max,
+                                                        const int32_t dilation_x,
+                                                        const int32_t dilation_y,
+                                                        int8_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the input temporary buffer needed for
+ *                  riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @return          Returns the required size by the temporary buffer.
+ */
+int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch);
+
+/**
+ * @brief           This function performs depthwise convolution using a 3x3
+ *                  kernel on signed 8-bit integers for both inputs and outputs
+ *                  across any x and y dimensions, applying asymmetric
+ *                  quantization to the outputs.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @param[in]       tmp_buf             Dummy
+ * @return          Returns 0 if successful; otherwise, returns -1 if
+ *                  in_tensor_ch is not equal to out_tensor_ch.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to left
+ *    shift calculation results whereas a negative one is used to right shift.
+ */
+int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+                                                        const int32_t in_tensor_dim_x,
+                                                        const int32_t in_tensor_dim_y,
+                                                        const int32_t in_tensor_ch,
+                                                        const int8_t * ker_weight,
+                                                        const int32_t out_tensor_ch,
+                                                        const int32_t pad_x,
+                                                        const int32_t pad_y,
+                                                        const int32_t stride_x,
+                                                        const int32_t stride_y,
+                                                        const int32_t * bias,
+                                                        int8_t * out_tensor,
+                                                        const int32_t * out_shift,
+                                                        const int32_t * out_scale,
+                                                        const int32_t out_tensor_dim_x,
+                                                        const int32_t out_tensor_dim_y,
+                                                        const int32_t out_offset,
+                                                        const int32_t in_offset,
+                                                        const int32_t act_min,
+                                                        const int32_t act_max,
+                                                        const int32_t dilation_x,
+                                                        const int32_t dilation_y,
+                                                        int16_t * tmp_buf);
 
 /**
- * @brief           This function performs depthwise convolution with signed
- *                  8-bit integers for both inputs and outputs and signed
- *                  4-bit integers for the kernel weights across any x and
- *                  y dimensions, applying asymmetric quantization to the
- *                  outputs.
+ * @brief           This function performs depthwise convolution using a 5x5
+ *                  kernel on signed 8-bit integers for both inputs and outputs
+ *                  across any x and y dimensions, applying asymmetric
+ *                  quantization to the outputs.
  * @param[in]       in_tensor           Pointer to the input tensor
- * @param[in]       in_tensor_batch     Size of input tensor batches
  * @param[in]       in_tensor_dim_x     X dimension of the input tensor
  * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
  * @param[in]       in_tensor_ch        Number of input tensor channels
  * @param[in]       ker_weight          Pointer of kernel weights
  * @param[in]       out_tensor_ch       Number of output tensor channels
- * @param[in]       ch_mult             Multiplier of input tensor channels
- * @param[in]       ker_dim_x           X dimension of the filter kernel
- * @param[in]       ker_dim_y           Y dimension of the filter kernel
  * @param[in]       pad_x               Padding size in the x dimension
  * @param[in]       pad_y               Padding size in the y dimension
  * @param[in]       stride_x            Convolution stride in the x dimension
@@ -5955,7 +7144,7 @@ int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym_get_buffer_size(const int32_t
  * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
  * @param[in]       out_offset          Offset value for the output tensor. It
  *                                      should be in the range of -128 to 127.
- * @param[in]       in_offset           Offset value for the input tensor. It
+ * @param[in]       in_offset           Offset value for the input tensor It
  *                                      should be in the range of -127 to 128.
  * @param[in]       act_min             Minimum value that the output tensor is
  *                                      limited to. It should be in the range of
@@ -5963,58 +7152,49 @@ int32_t riscv_nn_conv_HWC_wrapper_s16_s16_s8_asym_get_buffer_size(const int32_t
  * @param[in]       act_max             Maximum value that the output tensor is
  *                                      limited to. It should be in the range of
  *                                      -128 to 127.
- * @param[in]       dilation_x          Dilation factor for the x dimension
- * @param[in]       dilation_y          Dilation factor for the y dimension
- * @param[in]       tmp_buf             Temporary buffer for calculations. Its
- *                                      needed size could be obtained by calling
- *                                      riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size.
- * @return          Returns 0 if successful
- */
-int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
-                                                    const int32_t in_tensor_batch,
-                                                    const int32_t in_tensor_dim_x,
-                                                    const int32_t in_tensor_dim_y,
-                                                    const int32_t in_tensor_ch,
-                                                    const int8_t * ker_weight,
-                                                    const int32_t out_tensor_ch,
-                                                    const int32_t ch_mult,
-                                                    const int32_t ker_dim_x,
-                                                    const int32_t ker_dim_y,
-                                                    const int32_t pad_x,
-                                                    const int32_t pad_y,
-                                                    const int32_t stride_x,
-                                                    const int32_t stride_y,
-                                                    const int32_t * bias,
-                                                    int8_t * out_tensor,
-                                                    const int32_t * out_shift,
-                                                    const int32_t * out_scale,
-                                                    const int32_t out_tensor_dim_x,
-                                                    const int32_t out_tensor_dim_y,
-                                                    const int32_t out_offset,
-                                                    const int32_t in_offset,
-                                                    const int32_t act_min,
-                                                    const int32_t act_max,
-                                                    const int32_t dilation_x,
-                                                    const int32_t dilation_y,
-                                                    int8_t * tmp_buf);
-
-/**
- * @brief           This function calculates the required size (in bytes) for
- *                  the input temporary buffer needed for
- *                  riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any
- * @param[in]       in_tensor_ch        Number of input tensor channels
- * @param[in]       ker_dim_x           X dimension of the filter kernel
- * @param[in]       ker_dim_y           Y dimension of the filter kernel
- * @param[in]       ch_mult             Multiplier of input tensor channels
- * @return          Returns the required size by the temporary buffer.
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @param[in]       tmp_buf             Dummy
+ * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
+ *                  fail to meet the following constraints: in_tensor_ch must be
+ *                  equal to out_tensor_ch, and dilation_x and dilation_y must be
+ *                  1.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to left
+ *    shift calculation results whereas a negative one is used to right shift.
+ *  - Four horizontally adjacent outputs are computed together, so that each
+ *    kernel row is loaded once for all of them and, at stride 1, each input
+ *    once for every window that contains it.
  */
-int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch,
-                                                                    const int32_t ker_dim_x,
-                                                                    const int32_t ker_dim_y,
-                                                                    const int32_t ch_mult);
+int32_t riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+                                                        const int32_t in_tensor_dim_x,
+                                                        const int32_t in_tensor_dim_y,
+                                                        const int32_t in_tensor_ch,
+                                                        const int8_t * ker_weight,
+                                                        const int32_t out_tensor_ch,
+                                                        const int32_t pad_x,
+                                                        const int32_t pad_y,
+                                                        const int32_t stride_x,
+                                                        const int32_t stride_y,
+                                                        const int32_t * bias,
+                                                        int8_t * out_tensor,
+                                                        const int32_t * out_shift,
+                                                        const int32_t * out_scale,
+                                                        const int32_t out_tensor_dim_x,
+                                                        const int32_t out_tensor_dim_y,
+                                                        const int32_t out_offset,
+                                                        const int32_t in_offset,
+                                                        const int32_t act_min,
+                                                        const int32_t act_max,
+                                                        const int32_t dilation_x,
+                                                        const int32_t dilation_y,
+                                                        int16_t * tmp_buf);
 
 /**
- * @brief           This function performs depthwise convolution using a 3x3
+ * @brief           This function performs depthwise convolution using a 7x7
  *                  kernel on signed 8-bit integers for both inputs and outputs
  *                  across any x and y dimensions, applying asymmetric
  *                  quantization to the outputs.
@@ -6046,20 +7226,24 @@ int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_
  * @param[in]       act_max             Maximum value that the output tensor is
  *                                      limited to. It should be in the range of
  *                                      -128 to 127.
- * @param[in]       dilation_x          Dummy
- * @param[in]       dilation_y          Dummy
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
  * @param[in]       tmp_buf             Dummy
  * @return          Returns 0 if successful; otherwise, returns -1 if the inputs
  *                  fail to meet the following constraints: in_tensor_ch must be
- *                  equal to out_tensor_ch, and pad_x is less than or equal to 1.
+ *                  equal to out_tensor_ch, and dilation_x and dilation_y must be
+ *                  1.
  *
  * @note
  *  - bias could be a null pointer as the bias vector is optional for this
  *    function.
  *  - During the quantization process, a positive out_shift value is used to left
  *    shift calculation results whereas a negative one is used to right shift.
+ *  - Four horizontally adjacent outputs are computed together, so that each
+ *    kernel row is loaded once for all of them and, at stride 1, each input
+ *    once for every window that contains it.
  */
-int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+int32_t riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
                                                         const int32_t in_tensor_dim_x,
                                                         const int32_t in_tensor_dim_y,
                                                         const int32_t in_tensor_ch,
@@ -6399,9 +7583,11 @@ int32_t riscv_nn_conv_dw_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
 /**
  * @brief           This is a wrapper function for
  *                  riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any,
+ *                  riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any,
+ *                  riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any,
  *                  riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_any and
  *                  riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any. This
- *                  function calls one among the three depthwise convolution
+ *                  function calls one among the five depthwise convolution
  *                  functions according to the provided parameters.
  * @param[in]       in_tensor           Pointer to the input tensor
  * @param[in]       in_tensor_dim_x     X dimension of the input tensor
@@ -6436,8 +7622,8 @@ int32_t riscv_nn_conv_dw_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
  * @param[in]       act_max             Maximum value that the output tensor is
  *                                      limited to. It should be in the range of
  *                                      -128 to 127.
- * @param[in]       dilation_x          Dummy
- * @param[in]       dilation_y          Dummy
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
  * @param[in]       tmp_buf             Temporary buffer for the input tensor.
  *                                      It is required when -mext-dsp or
  *                                      -mext-vector is enabled and its needed
@@ -6448,6 +7634,11 @@ int32_t riscv_nn_conv_dw_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
  *                  equal to out_tensor_ch.
  *
  * @note
+ *  - With ch_mult equal to 1, every 3x3 kernel, whatever its padding and
+ *    dilation, is run by riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any.
+ *  - With ch_mult equal to 1, undilated 5x5 and 7x7 kernels are run by
+ *    riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any and
+ *    riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any.
  *  - bias could be a null pointer as the bias vector is optional for this
  *    function.
  *  - During the quantization process, a positive out_shift value is used to left
@@ -6497,6 +7688,198 @@ int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(const uint16_
                                                                    const uint16_t ker_dim_y,
                                                                    const uint16_t pad_x);
 
+/**
+ * @brief           This function sets up stream to run
+ *                  riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym on one input
+ *                  image fed row by row through
+ *                  riscv_nn_conv_stream_push_row_s8.
+ * @param[out]      stream              Pointer to the stream state
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer of kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[in]       out_shift           Pointer to the shift vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_scale           Pointer to the scaling vector for the
+ *                                      quantization on outputs
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_offset          Offset value for the output tensor. It
+ *                                      should be in the range of -128 to 127.
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to. It should be in the range of
+ *                                      -128 to 127.
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @param[in]       stream_buf          Buffer for the held input rows and the
+ *                                      convolution scratch. It must stay valid
+ *                                      while stream is used and its needed size
+ *                                      could be obtained by calling
+ *                                      riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if stream or stream_buf is a null pointer, ch_mult,
+ *                  stride_y or dilation_y is zero, or the last output rows read
+ *                  nothing but padding.
+ *
+ * @note
+ *  - The results are bit-exact with
+ *    riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym, whose kernel selection is
+ *    kept for every output row.
+ */
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init(riscv_nn_conv_stream * stream,
+                                                       const uint16_t in_tensor_dim_x,
+                                                       const uint16_t in_tensor_dim_y,
+                                                       const uint16_t in_tensor_ch,
+                                                       const int8_t * ker_weight,
+                                                       const uint16_t out_tensor_ch,
+                                                       const uint16_t ch_mult,
+                                                       const uint16_t ker_dim_x,
+                                                       const uint16_t ker_dim_y,
+                                                       const uint16_t pad_x,
+                                                       const uint16_t pad_y,
+                                                       const uint16_t stride_x,
+                                                       const uint16_t stride_y,
+                                                       const int32_t * bias,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const uint16_t out_tensor_dim_x,
+                                                       const uint16_t out_tensor_dim_y,
+                                                       const int32_t out_offset,
+                                                       const int32_t in_offset,
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const uint16_t dilation_x,
+                                                       const uint16_t dilation_y,
+                                                       int8_t * stream_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the buffer needed for
+ *                  riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init.
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @return          Returns the required size of the buffer.
+ */
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                  const uint16_t in_tensor_dim_y,
+                                                                  const uint16_t in_tensor_ch,
+                                                                  const uint16_t ch_mult,
+                                                                  const uint16_t ker_dim_x,
+                                                                  const uint16_t ker_dim_y,
+                                                                  const uint16_t pad_x,
+                                                                  const uint16_t dilation_y);
+
+/**
+ * @brief           This function runs a chain of s8 asymmetric convolution and
+ *                  depthwise convolution layers depth-first. The output of the
+ *                  last layer is produced in tiles of tile_rows rows; for each
+ *                  tile, every layer computes only the band of rows the tile
+ *                  needs through the layers after it, so the intermediate
+ *                  tensors never exist beyond tile size.
+ * @param[in]       in_tensor           Pointer to the input tensor of the
+ *                                      first layer
+ * @param[in]       in_tensor_batch     Size of input tensor batches
+ * @param[in]       layers              Pointer to the layers, in execution
+ *                                      order. The output dimensions of each
+ *                                      layer have to be the input dimensions
+ *                                      of the next.
+ * @param[in]       num_layers          Number of layers
+ * @param[out]      out_tensor          Pointer to the output tensor of the
+ *                                      last layer
+ * @param[in]       tile_rows           Output rows of the last layer per tile.
+ *                                      Smaller tiles need less memory but
+ *                                      recompute more of the rows that
+ *                                      neighbouring tiles share (the halo); a
+ *                                      tile of the whole output runs the layers
+ *                                      one after the other.
+ * @param[in]       in_tmp_buf          Temporary buffer for the intermediate
+ *                                      tiles and the layers. Its needed size
+ *                                      could be obtained by calling
+ *                                      riscv_nn_conv_chain_s8_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if in_tmp_buf is a null pointer, tile_rows is not positive,
+ *                  the layers do not chain, the last output rows of a layer
+ *                  read nothing but padding, or a layer fails.
+ *
+ * @note
+ *  - The results are bit-exact with running
+ *    riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym and
+ *    riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym layer by layer.
+ *  - riscv_nn_conv_chain_s8_get_cost reports the memory and the recomputed
+ *    work of a tile height, so that it could be chosen offline.
+ *
+ * @b Example:
+ * @code
+ * // inverted residual block: 1x1 expand, 3x3 depthwise, 1x1 project
+ * riscv_nn_conv_layer block[3] = { ... };
+ * riscv_nn_conv_chain_cost cost;
+ *
+ * riscv_nn_conv_chain_s8_get_cost(block, 3, 2, &cost);
+ * // cost.buffer_size bytes for in_tmp_buf, cost.recomputed_macs extra MACs
+ * riscv_nn_conv_chain_s8(in, 1, block, 3, out, 2, tmp);
+ * @endcode
+ */
+int32_t riscv_nn_conv_chain_s8(const int8_t * in_tensor,
+                               const int32_t in_tensor_batch,
+                               const riscv_nn_conv_layer * layers,
+                               const int32_t num_layers,
+                               int8_t * out_tensor,
+                               const int32_t tile_rows,
+                               int16_t * in_tmp_buf);
+
+/**
+ * @brief           This function reports the cost of running
+ *                  riscv_nn_conv_chain_s8 with a given tile height.
+ * @param[in]       layers              Pointer to the layers
+ * @param[in]       num_layers          Number of layers
+ * @param[in]       tile_rows           Output rows of the last layer per tile
+ * @param[out]      cost                Pointer to the cost: the size of the
+ *                                      temporary buffer and of the
+ *                                      intermediate tiles in it, and the
+ *                                      multiply-accumulates per batch with the
+ *                                      part of them spent on recomputed halos
+ * @return          This function returns 0 on success; otherwise, it returns -1
+ *                  if cost is a null pointer or the layers cannot run as a
+ *                  chain.
+ */
+int32_t riscv_nn_conv_chain_s8_get_cost(const riscv_nn_conv_layer * layers,
+                                        const int32_t num_layers,
+                                        const int32_t tile_rows,
+                                        riscv_nn_conv_chain_cost * cost);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for riscv_nn_conv_chain_s8.
+ * @param[in]       layers              Pointer to the layers
+ * @param[in]       num_layers          Number of layers
+ * @param[in]       tile_rows           Output rows of the last layer per tile
+ * @return          Returns the required size of the temporary buffer, or -1 if
+ *                  the layers cannot run as a chain.
+ */
+int32_t riscv_nn_conv_chain_s8_get_buffer_size(const riscv_nn_conv_layer * layers,
+                                               const int32_t num_layers,
+                                               const int32_t tile_rows);
+
 #ifdef __riscv_zfh
 /**
  * @brief           This function performs convolution using 1x1 kernel on
@@ -6606,6 +7989,13 @@ uint32_t riscv_nn_conv_1x1_HWC_f16_f16_f16_bias_any_get_buffer_size(const uint16
  *                                      "2 * in_tensor_ch * ker_dim * ker_dim".
  * @param[in]       tmp_buf             Dummy
  * @return          This function returns 0.
+ *
+ * @note
+ *  - With ENA_CONV_WINOGRAD_IN_WRAPPER defined in the library, 3x3 stride-1
+ *    kernels use riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias when
+ *    in_tmp_buf is provided, and the length returned by
+ *    riscv_nn_conv_HWC_f16_f16_f16_bias_get_buffer_size includes the
+ *    transformed weights.
  */
 int32_t riscv_nn_conv_HWC_f16_f16_f16_bias(const float16_t * in_tensor,
                                            const uint16_t in_tensor_dim,
@@ -6641,6 +8031,74 @@ uint32_t riscv_nn_conv_HWC_f16_f16_f16_bias_get_buffer_size(const uint16_t in_te
                                                             const uint16_t stride,
                                                             const uint16_t out_tensor_dim);
 
+/**
+ * @brief           This function transforms 3x3 kernel weights offline into
+ *                  the Winograd F(4x4, 3x3) domain used by
+ *                  riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias.
+ * @param[in]       ker_weight          Pointer of kernel weights in the same
+ *                                      layout as for
+ *                                      riscv_nn_conv_HWC_f16_f16_f16_bias
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[out]      wino_weight         Pointer to the transformed weights. Its
+ *                                      length must be
+ *                                      "36 * in_tensor_ch * out_tensor_ch".
+ * @return          This function only returns 0.
+ */
+int32_t riscv_nn_conv_HWC_3x3_winograd_f16_weight_transform(const float16_t * ker_weight,
+                                                            const uint16_t in_tensor_ch,
+                                                            const uint16_t out_tensor_ch,
+                                                            float16_t * wino_weight);
+
+/**
+ * @brief           This function performs convolution using 3x3 kernel and
+ *                  stride 1 on half-precision floating-point data for both
+ *                  inputs and outputs. It uses the Winograd F(4x4, 3x3)
+ *                  algorithm.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim       Dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       wino_weight         Pointer of kernel weights transformed
+ *                                      by riscv_nn_conv_HWC_3x3_winograd_f16_weight_transform
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       pad                 Padding size
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_tensor_dim      Dimension of the output tensor
+ * @param[in]       tmp_buf             Temporary buffer for the transformed
+ *                                      input tile. Its needed length could be
+ *                                      obtained by calling
+ *                                      riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias_get_buffer_size.
+ * @return          This function returns 0.
+ *
+ * @note
+ *  - It uses 36 multiplications for every 4x4 outputs instead of 144.
+ *  - The results are not bit-exact with riscv_nn_conv_HWC_f16_f16_f16_bias.
+ *    The transforms scale intermediate values by up to 100 times, so the
+ *    absolute error is about 4 times that of the direct convolution with the
+ *    default half-precision accumulation, and about 2 times with
+ *    ENA_KERNEL_FP32 enabled.
+ */
+int32_t riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias(const float16_t * in_tensor,
+                                                        const uint16_t in_tensor_dim,
+                                                        const uint16_t in_tensor_ch,
+                                                        const float16_t * wino_weight,
+                                                        const uint16_t out_tensor_ch,
+                                                        const uint16_t pad,
+                                                        const float16_t * bias,
+                                                        float16_t * out_tensor,
+                                                        const uint16_t out_tensor_dim,
+                                                        float16_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required length for the
+ *                  temporary buffer needed for
+ *                  riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @return          Returns the required length of the temporary buffer.
+ */
+uint32_t riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias_get_buffer_size(const uint16_t in_tensor_ch);
+
 /**
  * @brief           This function performs depthwise convolution on
  *                  half-precision floating-point data for both inputs and
@@ -28,6 +28,7 @@ extern    "C"
 #endif
 
 #include "riscv_math_types.h"
+#include "riscv_nn_types.h"
 
 /**
  * @defgroup FullyConnect Fully-Connected Layer Functions
@@ -89,6 +90,10 @@ extern    "C"
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - Each lhs x rhs matrix pair runs as a tiled matrix multiplication. Pairs
+ *    that share one rhs matrix (the rhs broadcast over N or H) are merged
+ *    into a single multiplication so the rhs is packed only once. A non-zero
+ *    rhs_offset falls back to one vector-matrix product per lhs row.
  */
 int32_t riscv_nn_batch_matmul_s8_s8_s8(const int8_t * in_lhs,
                                        const int8_t * in_rhs,
@@ -111,6 +116,89 @@ int32_t riscv_nn_batch_matmul_s8_s8_s8(const int8_t * in_lhs,
                                        const int32_t act_min,
                                        const int32_t act_max);
 
+/**
+ * @brief           This function performs batch matrix multiplication with
+ *                  signed 8-bit integers for both inputs and outputs, taking
+ *                  the right-hand side matrices in non-transposed layout.
+ * @param[in]       in_lhs          Pointer to the left-hand side input tensor
+ * @param[in]       in_rhs          Pointer to the right-hand side input tensor
+ * @param[in]       lhs_offset      Offset value for the left-hand side inputs.
+ *                                  It should be in the range of -128 to 127.
+ * @param[in]       rhs_offset      Offset value for the right-hand side inputs.
+ *                                  It should be in the range of -128 to 127.
+ * @param[in]       bias            Pointer to the bias vector of rhs_dim_c
+ *                                  elements
+ * @param[in]       dst             Pointer to the output tensor
+ * @param[in]       out_offset      Offset value for the output tensor. It
+ *                                  should be in the range of -128 to 127.
+ * @param[in]       out_scale       Scaling value for the quantization on the
+ *                                  outputs
+ * @param[in]       out_shift       Shift amount for the quantization on the
+ *                                  outputs
+ * @param[in]       lhs_dim_n       N dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_h       H dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_w       W dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_n       N dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_h       H dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_w       W dimension of the right-hand side input
+ *                                  tensor (rows of each rhs matrix)
+ * @param[in]       rhs_dim_c       C dimension of the right-hand side input
+ *                                  tensor (columns of each rhs matrix)
+ * @param[in]       out_dim_n       N dimension of the output tensor
+ * @param[in]       out_dim_h       H dimension of the output tensor
+ * @param[in]       act_min         Minimum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -128 to 127.
+ * @param[in]       act_max         Maximum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -128 to 127.
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to
+ *    left shift calculation results whereas a negative one is used to right
+ *    shift.
+ *  - in_rhs holds [rhs_dim_n][rhs_dim_h][rhs_dim_w][rhs_dim_c] matrices in
+ *    natural row-major order, i.e. not transposed: rhs_dim_w is the inner
+ *    dimension shared with the lhs and rhs_dim_c is the number of output
+ *    columns. in_lhs is [lhs_dim_n][lhs_dim_h][lhs_dim_w][rhs_dim_w] and dst
+ *    is [out_dim_n][out_dim_h][lhs_dim_w][rhs_dim_c]. This matches an attention P x V
+ *    product without transposing V first.
+ *  - Matrix pairs are merged as for riscv_nn_batch_matmul_s8_s8_s8 and the
+ *    rhs is packed panel by panel directly from the row-major layout. A
+ *    non-zero rhs_offset falls back to row-by-row column strips.
+ *  - The panels are packed on the stack: 4 * NN_MAT_MULT_PANEL_K bytes plus
+ *    16 * NN_MAT_MULT_PANEL_ROWS bytes of accumulators (384 bytes by
+ *    default).
+ */
+int32_t riscv_nn_batch_matmul_s8_s8_s8_rhs_nt(const int8_t * in_lhs,
+                                              const int8_t * in_rhs,
+                                              const int16_t lhs_offset,
+                                              const int16_t rhs_offset,
+                                              const int32_t * bias,
+                                              int8_t * dst,
+                                              const int16_t out_offset,
+                                              const int32_t out_scale,
+                                              const int32_t out_shift,
+                                              const int32_t lhs_dim_n,
+                                              const int32_t lhs_dim_h,
+                                              const int32_t lhs_dim_w,
+                                              const int32_t rhs_dim_n,
+                                              const int32_t rhs_dim_h,
+                                              const int32_t rhs_dim_w,
+                                              const int32_t rhs_dim_c,
+                                              const int32_t out_dim_n,
+                                              const int32_t out_dim_h,
+                                              const int32_t act_min,
+                                              const int32_t act_max);
+
 /**
  * @brief           This function performs batch matrix multiplication with
  *                  signed 16-bit integers for both inputs and outputs.
@@ -155,6 +243,9 @@ int32_t riscv_nn_batch_matmul_s8_s8_s8(const int8_t * in_lhs,
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - Each lhs x rhs matrix pair runs as a matrix multiplication with 2x4
+ *    register tiles. Pairs that share one rhs matrix are merged as for
+ *    riscv_nn_batch_matmul_s8_s8_s8.
  */
 int32_t riscv_nn_batch_matmul_s16_s16_s16(const int16_t * in_lhs,
                                           const int16_t * in_rhs,
@@ -177,6 +268,349 @@ int32_t riscv_nn_batch_matmul_s16_s16_s16(const int16_t * in_lhs,
                                           const int32_t act_min,
                                           const int32_t act_max);
 
+/**
+ * @brief           This function performs batch matrix multiplication with
+ *                  signed 16-bit integers for both inputs and outputs, taking
+ *                  the right-hand side matrices in non-transposed layout.
+ * @param[in]       in_lhs          Pointer to the left-hand side input tensor
+ * @param[in]       in_rhs          Pointer to the right-hand side input tensor
+ * @param[in]       lhs_offset      Dummy
+ * @param[in]       rhs_offset      Dummy
+ * @param[in]       bias            Pointer to the bias vector of rhs_dim_c
+ *                                  elements
+ * @param[in]       dst             Pointer to the output tensor
+ * @param[in]       out_offset      Dummy
+ * @param[in]       out_scale       Scaling value for the quantization on the
+ *                                  outputs
+ * @param[in]       out_shift       Shift amount for the quantization on the
+ *                                  outputs
+ * @param[in]       lhs_dim_n       N dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_h       H dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_w       W dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_n       N dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_h       H dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_w       W dimension of the right-hand side input
+ *                                  tensor (rows of each rhs matrix)
+ * @param[in]       rhs_dim_c       C dimension of the right-hand side input
+ *                                  tensor (columns of each rhs matrix)
+ * @param[in]       dst_dim_n       N dimension of the output tensor
+ * @param[in]       dst_dim_h       H dimension of the output tensor
+ * @param[in]       act_min         Minimum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -32768 to 32767.
+ * @param[in]       act_max         Maximum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -32768 to 32767.
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - bias could be a null pointer as the bias vector is optional for this
+ *    function.
+ *  - During the quantization process, a positive out_shift value is used to
+ *    left shift calculation results whereas a negative one is used to right
+ *    shift.
+ *  - in_rhs holds [rhs_dim_n][rhs_dim_h][rhs_dim_w][rhs_dim_c] matrices in
+ *    natural row-major order, i.e. not transposed: rhs_dim_w is the inner
+ *    dimension shared with the lhs and rhs_dim_c is the number of output
+ *    columns. in_lhs is [lhs_dim_n][lhs_dim_h][lhs_dim_w][rhs_dim_w] and dst
+ *    is [dst_dim_n][dst_dim_h][lhs_dim_w][rhs_dim_c]. This matches an attention P x V
+ *    product without transposing V first.
+ *  - Matrix pairs are merged as for riscv_nn_batch_matmul_s8_s8_s8. Every 4
+ *    rhs columns are copied into a transposed panel and run with 2x4 register
+ *    tiles; rhs_dim_w beyond NN_MAT_MULT_PANEL_K reads the rhs in place.
+ */
+int32_t riscv_nn_batch_matmul_s16_s16_s16_rhs_nt(const int16_t * in_lhs,
+                                                 const int16_t * in_rhs,
+                                                 const int16_t lhs_offset,
+                                                 const int16_t rhs_offset,
+                                                 const int64_t * bias,
+                                                 int16_t * dst,
+                                                 const int16_t out_offset,
+                                                 const int32_t out_scale,
+                                                 const int32_t out_shift,
+                                                 const int32_t lhs_dim_n,
+                                                 const int32_t lhs_dim_h,
+                                                 const int32_t lhs_dim_w,
+                                                 const int32_t rhs_dim_n,
+                                                 const int32_t rhs_dim_h,
+                                                 const int32_t rhs_dim_w,
+                                                 const int32_t rhs_dim_c,
+                                                 const int32_t dst_dim_n,
+                                                 const int32_t dst_dim_h,
+                                                 const int32_t act_min,
+                                                 const int32_t act_max);
+
+/**
+ * @brief           This function performs fused scaled dot-product attention
+ *                  on signed 8-bit integer queries, keys and values, with the
+ *                  softmax evaluated at 16-bit precision.
+ * @param[in]       q               Pointer to the query tensor of
+ *                                  [batch][q_heads][q_len][head_dim]
+ * @param[in]       k               Pointer to the key tensor of
+ *                                  [batch][kv_heads][kv_len][head_dim]
+ * @param[in]       v               Pointer to the value tensor of
+ *                                  [batch][kv_heads][kv_len][head_dim]
+ * @param[in]       kv_mask         Pointer to the padding mask of
+ *                                  [batch][kv_len]. Keys whose entry is 0 are
+ *                                  ignored.
+ * @param[out]      dst             Pointer to the output tensor of
+ *                                  [batch][q_heads][q_len][head_dim]
+ * @param[in]       batch           Number of batches
+ * @param[in]       q_heads         Number of query heads
+ * @param[in]       kv_heads        Number of key/value heads. It must divide
+ *                                  q_heads; each key/value head serves
+ *                                  q_heads / kv_heads consecutive query heads.
+ * @param[in]       q_len           Number of query rows per head
+ * @param[in]       kv_len          Number of key/value rows per head
+ * @param[in]       head_dim        Number of elements in each row
+ * @param[in]       q_offset        Offset value for the queries. It should be
+ *                                  in the range of -128 to 127.
+ * @param[in]       k_offset        Offset value for the keys. It should be in
+ *                                  the range of -128 to 127.
+ * @param[in]       v_offset        Offset value for the values. It should be
+ *                                  in the range of -128 to 127.
+ * @param[in]       qk_scale        Scaling value for the quantization of the
+ *                                  query-key products into 8-bit scores
+ * @param[in]       qk_shift        Shift amount for the quantization of the
+ *                                  query-key products into 8-bit scores
+ * @param[in]       sm_scale        Scaling value for the softmax input
+ *                                  quantization, as the scale of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       sm_lshift       Left shift amount for the softmax input
+ *                                  quantization, as the lshift of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       diff_min        Minimum threshold to perform the quantized
+ *                                  exponential operation, as the diff_min of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       out_offset      Offset value for the output tensor. It
+ *                                  should be in the range of -128 to 127.
+ * @param[in]       out_scale       Scaling value for the quantization from
+ *                                  value units to the outputs
+ * @param[in]       out_shift       Shift amount for the quantization from
+ *                                  value units to the outputs
+ * @param[in]       act_min         Minimum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -128 to 127.
+ * @param[in]       act_max         Maximum value that the output tensor is
+ *                                  limited to. It should be in the range of
+ *                                  -128 to 127.
+ * @param[in]       causal          If non-zero, query row i only attends to
+ *                                  keys 0 to i + kv_len - q_len.
+ * @param[in]       tmp_buf         Temporary buffer for the accumulators. Its
+ *                                  size could be obtained by calling
+ *                                  riscv_nn_attention_s8_s8_s8_get_buffer_size
+ *                                  and it should be 8-byte aligned.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if kv_heads does not divide q_heads or tmp_buf is NULL.
+ *
+ * @note
+ *  - kv_mask could be a null pointer if no key is padded.
+ *  - Each output row is softmax(q x k^T) x v for its head. The scores are
+ *    requantized with qk_scale and qk_shift into 8 bits as by
+ *    riscv_nn_batch_matmul_s8_s8_s8, and their exponentials follow
+ *    riscv_nn_softmax_s8_s16_hp, kept at Q15 precision. The weighted sum of
+ *    (v + v_offset) divided by the sum of the weights is then requantized
+ *    with out_scale and out_shift.
+ *  - NN_ATTENTION_Q_TILE query rows at a time run against blocks of
+ *    NN_ATTENTION_KV_BLOCK keys. The running row maximum, weight sum and
+ *    output accumulators are rescaled whenever a block raises the maximum
+ *    (online softmax), so the q_len x kv_len score matrix is never stored.
+ *  - A query row that attends to no key produces out_offset.
+ */
+int32_t riscv_nn_attention_s8_s8_s8(const int8_t * q,
+                                    const int8_t * k,
+                                    const int8_t * v,
+                                    const uint8_t * kv_mask,
+                                    int8_t * dst,
+                                    const int32_t batch,
+                                    const int32_t q_heads,
+                                    const int32_t kv_heads,
+                                    const int32_t q_len,
+                                    const int32_t kv_len,
+                                    const int32_t head_dim,
+                                    const int16_t q_offset,
+                                    const int16_t k_offset,
+                                    const int16_t v_offset,
+                                    const int32_t qk_scale,
+                                    const int32_t qk_shift,
+                                    const int32_t sm_scale,
+                                    const int32_t sm_lshift,
+                                    const int32_t diff_min,
+                                    const int16_t out_offset,
+                                    const int32_t out_scale,
+                                    const int32_t out_shift,
+                                    const int32_t act_min,
+                                    const int32_t act_max,
+                                    const int32_t causal,
+                                    int16_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for riscv_nn_attention_s8_s8_s8.
+ * @param[in]       head_dim        Number of elements in each row
+ * @return          This function returns the required size of the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_attention_s8_s8_s8_get_buffer_size(const int32_t head_dim);
+
+/**
+ * @brief           This function initializes an empty signed 8-bit key/value
+ *                  cache on caller-provided buffers.
+ * @param[out]      cache           Pointer to the cache object
+ * @param[in]       k_buf           Buffer for the keys of
+ *                                  kv_heads * capacity * head_dim bytes
+ * @param[in]       v_buf           Buffer for the values of
+ *                                  kv_heads * capacity * head_dim bytes
+ * @param[in]       qk_scaling      Pointer to kv_heads requantization
+ *                                  parameters from the query-key products to
+ *                                  8-bit scores, folding in the key scale of
+ *                                  each head
+ * @param[in]       out_scaling     Pointer to kv_heads requantization
+ *                                  parameters from value units to the
+ *                                  outputs, folding in the value scale of each
+ *                                  head
+ * @param[in]       k_offset        Pointer to kv_heads offset values for the
+ *                                  keys. They should be in the range of -128
+ *                                  to 127.
+ * @param[in]       v_offset        Pointer to kv_heads offset values for the
+ *                                  values. They should be in the range of -128
+ *                                  to 127.
+ * @param[in]       kv_heads        Number of key/value heads
+ * @param[in]       head_dim        Number of elements in each key or value row
+ * @param[in]       capacity        Number of tokens each head can hold
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 for a null pointer or a non-positive size.
+ *
+ * @note
+ *  - k_offset and v_offset could be null pointers if the cached keys or
+ *    values are symmetric, i.e. their offsets are 0.
+ *  - The buffers, scaling and offset arrays are referenced, not copied, and
+ *    must outlive the cache.
+ */
+int32_t riscv_nn_kv_cache_s8_init(riscv_nn_kv_cache_s8 * cache,
+                                  int8_t * k_buf,
+                                  int8_t * v_buf,
+                                  const riscv_nn_scaling * qk_scaling,
+                                  const riscv_nn_scaling * out_scaling,
+                                  const int16_t * k_offset,
+                                  const int16_t * v_offset,
+                                  const int32_t kv_heads,
+                                  const int32_t head_dim,
+                                  const int32_t capacity);
+
+/**
+ * @brief           This function appends the keys and values of new tokens
+ *                  to a signed 8-bit key/value cache.
+ * @param[in,out]   cache           Pointer to the cache object
+ * @param[in]       k               Pointer to the new keys of
+ *                                  [kv_heads][tokens][head_dim]
+ * @param[in]       v               Pointer to the new values of
+ *                                  [kv_heads][tokens][head_dim]
+ * @param[in]       tokens          Number of new tokens
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if the cache cannot hold the new tokens, in which case
+ *                  nothing is appended.
+ *
+ * @note
+ *  - Only the new rows are copied, so a decode step costs
+ *    O(kv_heads * head_dim). Evict old tokens first to make room.
+ */
+int32_t riscv_nn_kv_cache_s8_append(riscv_nn_kv_cache_s8 * cache,
+                                    const int8_t * k,
+                                    const int8_t * v,
+                                    const int32_t tokens);
+
+/**
+ * @brief           This function drops the oldest tokens of a signed 8-bit
+ *                  key/value cache.
+ * @param[in,out]   cache           Pointer to the cache object
+ * @param[in]       tokens          Number of tokens to drop
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if tokens is negative or larger than the number of
+ *                  cached tokens.
+ *
+ * @note
+ *  - The cache is a ring buffer, so no data is moved; this is suited to a
+ *    sliding attention window.
+ */
+int32_t riscv_nn_kv_cache_s8_evict(riscv_nn_kv_cache_s8 * cache,
+                                   const int32_t tokens);
+
+/**
+ * @brief           This function performs single-query attention over a
+ *                  signed 8-bit key/value cache for incremental decoding.
+ * @param[in]       q               Pointer to the query of [q_heads][head_dim]
+ * @param[in]       cache           Pointer to the key/value cache
+ * @param[out]      dst             Pointer to the output of
+ *                                  [q_heads][head_dim]
+ * @param[in]       q_heads         Number of query heads. It must be a
+ *                                  multiple of the kv_heads of the cache.
+ * @param[in]       q_offset        Offset value for the query. It should be in
+ *                                  the range of -128 to 127.
+ * @param[in]       sm_scale        Scaling value for the softmax input
+ *                                  quantization, as the scale of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       sm_lshift       Left shift amount for the softmax input
+ *                                  quantization, as the lshift of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       diff_min        Minimum threshold to perform the quantized
+ *                                  exponential operation, as the diff_min of
+ *                                  riscv_nn_softmax_s8_s16_hp
+ * @param[in]       out_offset      Offset value for the output. It should be
+ *                                  in the range of -128 to 127.
+ * @param[in]       act_min         Minimum value that the output is limited
+ *                                  to. It should be in the range of -128 to
+ *                                  127.
+ * @param[in]       act_max         Maximum value that the output is limited
+ *                                  to. It should be in the range of -128 to
+ *                                  127.
+ * @param[in]       tmp_buf         Temporary buffer for the scores and
+ *                                  accumulators. Its size could be obtained by
+ *                                  calling
+ *                                  riscv_nn_decode_attention_s8_s8_s8_get_buffer_size
+ *                                  and it should be 8-byte aligned.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if kv_heads does not divide q_heads or tmp_buf is NULL.
+ *
+ * @note
+ *  - Every cached token is visible to the query, so append the key and value
+ *    of the current token first.
+ *  - The cache is read in place, and the cost is O(len * head_dim) per head
+ *    for len cached tokens. The scores use the qk_scaling and k_offset of the
+ *    head and the outputs its out_scaling and v_offset; otherwise the results
+ *    follow riscv_nn_attention_s8_s8_s8 with one query row.
+ *  - With no cached token the outputs are out_offset.
+ */
+int32_t riscv_nn_decode_attention_s8_s8_s8(const int8_t * q,
+                                           const riscv_nn_kv_cache_s8 * cache,
+                                           int8_t * dst,
+                                           const int32_t q_heads,
+                                           const int16_t q_offset,
+                                           const int32_t sm_scale,
+                                           const int32_t sm_lshift,
+                                           const int32_t diff_min,
+                                           const int16_t out_offset,
+                                           const int32_t act_min,
+                                           const int32_t act_max,
+                                           int16_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_decode_attention_s8_s8_s8.
+ * @param[in]       head_dim        Number of elements in each row
+ * @param[in]       capacity        Capacity of the cache in tokens
+ * @return          This function returns the required size of the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_decode_attention_s8_s8_s8_get_buffer_size(const int32_t head_dim,
+                                                           const int32_t capacity);
+
 /**
  * @brief           This function performs calculation on signed 8-bit integers
  *                  for inputs, applying shift-based quantization to the outputs.
@@ -1155,6 +1589,11 @@ void riscv_nn_fc_mat_vec_s8_wt_converter(const q7_t *wt_mat,
  *  - During the quantization process, a positive out_shift value is used to
  *    left shift calculation results whereas a negative one is used to right
  *    shift.
+ *  - The kernel sums from riscv_nn_kernel_sum_s8 can be passed as bias
+ *    together with an in_offset of 0.
+ *  - When in_vec_batch is at least NN_FC_GEMM_MIN_BATCH and wt_offset is 0,
+ *    the batch runs as one matrix multiplication, so the weight matrix is
+ *    read once per tile of input vectors rather than once per input vector.
  */
 int32_t riscv_nn_fc_s8_s8_s8_asym_bias(const int8_t * in_vec,
                                        const int8_t * wt_mat,
@@ -1264,6 +1703,164 @@ int32_t riscv_nn_fc_f16_f16_f16_bias(const float16_t * in_vec,
                                      const float16_t * bias,
                                      float16_t * out_vec,
                                      float16_t * tmp_buf);
+
+/**
+ * @brief           This function performs fused scaled dot-product attention
+ *                  on half-precision floating-point queries, keys and values.
+ * @param[in]       q               Pointer to the query tensor of
+ *                                  [batch][q_heads][q_len][head_dim]
+ * @param[in]       k               Pointer to the key tensor of
+ *                                  [batch][kv_heads][kv_len][head_dim]
+ * @param[in]       v               Pointer to the value tensor of
+ *                                  [batch][kv_heads][kv_len][head_dim]
+ * @param[in]       kv_mask         Pointer to the padding mask of
+ *                                  [batch][kv_len]. Keys whose entry is 0 are
+ *                                  ignored.
+ * @param[out]      dst             Pointer to the output tensor of
+ *                                  [batch][q_heads][q_len][head_dim]
+ * @param[in]       batch           Number of batches
+ * @param[in]       q_heads         Number of query heads
+ * @param[in]       kv_heads        Number of key/value heads. It must divide
+ *                                  q_heads.
+ * @param[in]       q_len           Number of query rows per head
+ * @param[in]       kv_len          Number of key/value rows per head
+ * @param[in]       head_dim        Number of elements in each row
+ * @param[in]       scale           Factor applied to the query-key products
+ *                                  before the softmax, typically
+ *                                  1 / sqrt(head_dim)
+ * @param[in]       causal          If non-zero, query row i only attends to
+ *                                  keys 0 to i + kv_len - q_len.
+ * @param[in]       tmp_buf         Temporary buffer for the accumulators. Its
+ *                                  size could be obtained by calling
+ *                                  riscv_nn_attention_f16_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if kv_heads does not divide q_heads or tmp_buf is NULL.
+ *
+ * @note
+ *  - kv_mask could be a null pointer if no key is padded.
+ *  - The query tiling and online softmax follow riscv_nn_attention_s8_s8_s8.
+ *    The products, running maximum, weight sum and output accumulators are
+ *    kept in single precision, since long sequences would lose the smaller
+ *    weights in a half-precision sum.
+ *  - A query row that attends to no key produces 0.
+ */
+int32_t riscv_nn_attention_f16(const float16_t * q,
+                               const float16_t * k,
+                               const float16_t * v,
+                               const uint8_t * kv_mask,
+                               float16_t * dst,
+                               const int32_t batch,
+                               const int32_t q_heads,
+                               const int32_t kv_heads,
+                               const int32_t q_len,
+                               const int32_t kv_len,
+                               const int32_t head_dim,
+                               const float16_t scale,
+                               const int32_t causal,
+                               float32_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for riscv_nn_attention_f16.
+ * @param[in]       head_dim        Number of elements in each row
+ * @return          This function returns the required size of the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_attention_f16_get_buffer_size(const int32_t head_dim);
+
+/**
+ * @brief           This function initializes an empty half-precision
+ *                  key/value cache on caller-provided buffers.
+ * @param[out]      cache           Pointer to the cache object
+ * @param[in]       k_buf           Buffer for kv_heads * capacity * head_dim
+ *                                  keys
+ * @param[in]       v_buf           Buffer for kv_heads * capacity * head_dim
+ *                                  values
+ * @param[in]       kv_heads        Number of key/value heads
+ * @param[in]       head_dim        Number of elements in each key or value row
+ * @param[in]       capacity        Number of tokens each head can hold
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 for a null pointer or a non-positive size.
+ */
+int32_t riscv_nn_kv_cache_f16_init(riscv_nn_kv_cache_f16 * cache,
+                                   float16_t * k_buf,
+                                   float16_t * v_buf,
+                                   const int32_t kv_heads,
+                                   const int32_t head_dim,
+                                   const int32_t capacity);
+
+/**
+ * @brief           This function appends the keys and values of new tokens
+ *                  to a half-precision key/value cache.
+ * @param[in,out]   cache           Pointer to the cache object
+ * @param[in]       k               Pointer to the new keys of
+ *                                  [kv_heads][tokens][head_dim]
+ * @param[in]       v               Pointer to the new values of
+ *                                  [kv_heads][tokens][head_dim]
+ * @param[in]       tokens          Number of new tokens
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if the cache cannot hold the new tokens, in which case
+ *                  nothing is appended.
+ */
+int32_t riscv_nn_kv_cache_f16_append(riscv_nn_kv_cache_f16 * cache,
+                                     const float16_t * k,
+                                     const float16_t * v,
+                                     const int32_t tokens);
+
+/**
+ * @brief           This function drops the oldest tokens of a half-precision
+ *                  key/value cache.
+ * @param[in,out]   cache           Pointer to the cache object
+ * @param[in]       tokens          Number of tokens to drop
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if tokens is negative or larger than the number of
+ *                  cached tokens.
+ */
+int32_t riscv_nn_kv_cache_f16_evict(riscv_nn_kv_cache_f16 * cache,
+                                    const int32_t tokens);
+
+/**
+ * @brief           This function performs single-query attention over a
+ *                  half-precision key/value cache for incremental decoding.
+ * @param[in]       q               Pointer to the query of [q_heads][head_dim]
+ * @param[in]       cache           Pointer to the key/value cache
+ * @param[out]      dst             Pointer to the output of
+ *                                  [q_heads][head_dim]
+ * @param[in]       q_heads         Number of query heads. It must be a
+ *                                  multiple of the kv_heads of the cache.
+ * @param[in]       scale           Factor applied to the query-key products
+ *                                  before the softmax, typically
+ *                                  1 / sqrt(head_dim)
+ * @param[in]       tmp_buf         Temporary buffer for the scores and
+ *                                  accumulators. Its size could be obtained by
+ *                                  calling
+ *                                  riscv_nn_decode_attention_f16_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if kv_heads does not divide q_heads or tmp_buf is NULL.
+ *
+ * @note
+ *  - The cache is read in place as for riscv_nn_decode_attention_s8_s8_s8,
+ *    with the arithmetic of riscv_nn_attention_f16.
+ *  - With no cached token the outputs are 0.
+ */
+int32_t riscv_nn_decode_attention_f16(const float16_t * q,
+                                      const riscv_nn_kv_cache_f16 * cache,
+                                      float16_t * dst,
+                                      const int32_t q_heads,
+                                      const float16_t scale,
+                                      float32_t * tmp_buf);
+
+/**
+ * @brief           This function calculates the required size (in bytes) for
+ *                  the temporary buffer needed for
+ *                  riscv_nn_decode_attention_f16.
+ * @param[in]       head_dim        Number of elements in each row
+ * @param[in]       capacity        Capacity of the cache in tokens
+ * @return          This function returns the required size of the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_decode_attention_f16_get_buffer_size(const int32_t head_dim,
+                                                      const int32_t capacity);
 #endif
 
 /**
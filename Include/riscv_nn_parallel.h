@@ -0,0 +1,451 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#ifndef __RISCV_NN_PARALLEL_H__
+#define __RISCV_NN_PARALLEL_H__
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+#include "riscv_math_types.h"
+
+/**
+ * @defgroup Parallel Parallel Execution Functions
+ * @brief Parallel execution functions split one layer into independent tasks
+ *        over output rows, output channels or batches, and hand the tasks to a
+ *        user-provided dispatcher (e.g. an RTOS thread pool). Every task writes
+ *        a disjoint part of the output and owns one slot of the temporary
+ *        buffer, so the results are bit-exact with the single-threaded
+ *        functions they wrap.
+ *
+ * @{
+ */
+
+/**
+ * @brief           This is the type of one unit of work handed to a
+ *                  dispatcher.
+ * @param[in]       ctx             Context pointer passed to the dispatcher
+ * @param[in]       task_idx        Index of the task, in the range of 0 to
+ *                                  num_tasks - 1
+ */
+typedef void (*riscv_nn_task_fn)(void * ctx, int32_t task_idx);
+
+/**
+ * @brief           This is the type of a task dispatcher.
+ * @param[in]       task            Function to run once for every task index
+ * @param[in]       ctx             Context pointer to pass to task
+ * @param[in]       num_tasks       Number of tasks. It never exceeds the
+ *                                  num_threads given to
+ *                                  riscv_nn_set_parallel_dispatcher.
+ * @param[in]       user_data       User data given to
+ *                                  riscv_nn_set_parallel_dispatcher
+ *
+ * @note
+ *  - The dispatcher must run task(ctx, i) exactly once for each i in
+ *    [0, num_tasks) and return only after all of them have finished. The
+ *    tasks may run in any order and on any threads, including the caller's.
+ */
+typedef void (*riscv_nn_dispatch_fn)(riscv_nn_task_fn task,
+                                     void * ctx,
+                                     int32_t num_tasks,
+                                     void * user_data);
+
+/**
+ * @brief           This function sets the dispatcher and the number of threads
+ *                  used by the riscv_nn_*_mt functions.
+ * @param[in]       dispatch        Pointer to the dispatcher. If it is NULL, the
+ *                                  built-in POSIX-thread pool is used when the
+ *                                  library is built with ENA_PARALLEL_PTHREAD;
+ *                                  otherwise the tasks run serially on the
+ *                                  caller and num_threads is set to 1.
+ * @param[in]       user_data       User data passed to every dispatch call
+ * @param[in]       num_threads     Number of threads. It is clamped to the
+ *                                  range of 1 to NN_PARALLEL_MAX_THREADS (8 by
+ *                                  default).
+ *
+ * @note
+ *  - This function is not thread-safe. Call it before any riscv_nn_*_mt
+ *    function and before querying the *_mt_get_buffer_size functions, whose
+ *    results depend on the number of threads.
+ *  - The default setting is one thread, in which case the riscv_nn_*_mt
+ *    functions simply call the functions they wrap.
+ *  - The built-in pool starts num_threads - 1 worker threads here and keeps
+ *    them for the life of the process; later calls only add workers. Its
+ *    dispatches from different threads are serialized, and a task must not
+ *    call a riscv_nn_*_mt function itself.
+ */
+void riscv_nn_set_parallel_dispatcher(riscv_nn_dispatch_fn dispatch,
+                                      void * user_data,
+                                      int32_t num_threads);
+
+/**
+ * @brief           This function returns the number of threads used by the
+ *                  riscv_nn_*_mt functions.
+ * @return          This function returns the number of threads.
+ */
+int32_t riscv_nn_get_parallel_threads(void);
+
+/**
+ * @brief           This function runs tasks through the current dispatcher.
+ * @param[in]       task            Function to run once for every task index
+ * @param[in]       ctx             Context pointer to pass to task
+ * @param[in]       num_tasks       Number of tasks. It should not exceed the
+ *                                  value returned by
+ *                                  riscv_nn_get_parallel_threads.
+ */
+void riscv_nn_parallel_run(riscv_nn_task_fn task, void * ctx, int32_t num_tasks);
+
+/**
+ * @brief           This is a multi-threaded version of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym. It splits the
+ *                  output rows of all batches into one contiguous range per
+ *                  thread.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Number of input tensor batches
+ * @param[in]       ker_weight          Pointer to the kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for output
+ *                                      tensors
+ * @param[in]       out_scale           Pointer to the scale vector for output
+ *                                      tensors
+ * @param[in]       out_offset          Offset value for the output tensor
+ * @param[in]       in_offset           Offset value for the input tensor
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @param[in]       in_tmp_buf          Temporary buffer for the calculation.
+ *                                      Its size, in bytes, could be obtained
+ *                                      by calling
+ *                                      riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if any of the tasks fails.
+ *
+ * @note
+ *  - Layers with a single output row per batch are split over batches only.
+ *  - Layers whose last output row reads nothing but bottom padding are run
+ *    single-threaded.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt(const int8_t * in_tensor,
+                                                   const uint16_t in_tensor_dim_x,
+                                                   const uint16_t in_tensor_dim_y,
+                                                   const uint16_t in_tensor_ch,
+                                                   const uint16_t in_tensor_batch,
+                                                   const int8_t * ker_weight,
+                                                   const uint16_t out_tensor_ch,
+                                                   const uint16_t ker_dim_x,
+                                                   const uint16_t ker_dim_y,
+                                                   const uint16_t ker_ch,
+                                                   const uint16_t pad_x,
+                                                   const uint16_t pad_y,
+                                                   const uint16_t stride_x,
+                                                   const uint16_t stride_y,
+                                                   const int32_t * bias,
+                                                   int8_t * out_tensor,
+                                                   const int32_t * out_shift,
+                                                   const int32_t * out_scale,
+                                                   const int32_t out_offset,
+                                                   const int32_t in_offset,
+                                                   const int32_t act_min,
+                                                   const int32_t act_max,
+                                                   const uint16_t out_tensor_dim_x,
+                                                   const uint16_t out_tensor_dim_y,
+                                                   const int32_t dilation_x,
+                                                   const int32_t dilation_y,
+                                                   int16_t * in_tmp_buf);
+
+/**
+ * @brief           This function is used to get the needed size, in bytes, by
+ *                  the temporary buffer of
+ *                  riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt. It is the
+ *                  per-call size of riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym,
+ *                  rounded up to a multiple of 4, times the number of threads.
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       in_tensor_batch     Number of input tensor batches
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       ker_ch              Number of filter kernel channels
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @return          This function returns the needed size by the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                   const uint16_t in_tensor_dim_y,
+                                                                   const uint16_t in_tensor_ch,
+                                                                   const uint16_t in_tensor_batch,
+                                                                   const uint16_t ker_dim_x,
+                                                                   const uint16_t ker_dim_y,
+                                                                   const uint16_t ker_ch,
+                                                                   const uint16_t pad_x,
+                                                                   const uint16_t pad_y,
+                                                                   const uint16_t stride_x,
+                                                                   const uint16_t stride_y,
+                                                                   const uint16_t out_tensor_dim_x,
+                                                                   const uint16_t out_tensor_dim_y,
+                                                                   const uint16_t out_tensor_ch,
+                                                                   const int32_t dilation_x,
+                                                                   const int32_t dilation_y);
+
+/**
+ * @brief           This is a multi-threaded version of
+ *                  riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym. It splits the
+ *                  output rows into one contiguous range per thread.
+ * @param[in]       in_tensor           Pointer to the input tensor
+ * @param[in]       in_tensor_dim_x     X dimension of the input tensor
+ * @param[in]       in_tensor_dim_y     Y dimension of the input tensor
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ker_weight          Pointer to the kernel weights
+ * @param[in]       out_tensor_ch       Number of output tensor channels
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @param[in]       pad_y               Padding size in the y dimension
+ * @param[in]       stride_x            Convolution stride in the x dimension
+ * @param[in]       stride_y            Convolution stride in the y dimension
+ * @param[in]       bias                Pointer to the bias vector
+ * @param[out]      out_tensor          Pointer to the output tensor
+ * @param[in]       out_shift           Pointer to the shift vector for output
+ *                                      tensors
+ * @param[in]       out_scale           Pointer to the scale vector for output
+ *                                      tensors
+ * @param[in]       out_tensor_dim_x    X dimension of the output tensor
+ * @param[in]       out_tensor_dim_y    Y dimension of the output tensor
+ * @param[in]       out_offset          Offset value for the output tensor
+ * @param[in]       in_offset           Offset value for the input tensor
+ * @param[in]       act_min             Minimum value that the output tensor is
+ *                                      limited to
+ * @param[in]       act_max             Maximum value that the output tensor is
+ *                                      limited to
+ * @param[in]       dilation_x          Dilation factor in the x dimension
+ * @param[in]       dilation_y          Dilation factor in the y dimension
+ * @param[in]       tmp_buf             Temporary buffer for the calculation.
+ *                                      Its size, in bytes, could be obtained
+ *                                      by calling
+ *                                      riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size.
+ * @return          This function returns 0 on success; otherwise, it returns
+ *                  -1 if any of the tasks fails.
+ *
+ * @note
+ *  - Layers whose last output row reads nothing but bottom padding are run
+ *    single-threaded.
+ */
+int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt(const int8_t * in_tensor,
+                                                      const uint16_t in_tensor_dim_x,
+                                                      const uint16_t in_tensor_dim_y,
+                                                      const uint16_t in_tensor_ch,
+                                                      const int8_t * ker_weight,
+                                                      const uint16_t out_tensor_ch,
+                                                      const uint16_t ch_mult,
+                                                      const uint16_t ker_dim_x,
+                                                      const uint16_t ker_dim_y,
+                                                      const uint16_t pad_x,
+                                                      const uint16_t pad_y,
+                                                      const uint16_t stride_x,
+                                                      const uint16_t stride_y,
+                                                      const int32_t * bias,
+                                                      int8_t * out_tensor,
+                                                      const int32_t * out_shift,
+                                                      const int32_t * out_scale,
+                                                      const uint16_t out_tensor_dim_x,
+                                                      const uint16_t out_tensor_dim_y,
+                                                      const int32_t out_offset,
+                                                      const int32_t in_offset,
+                                                      const int32_t act_min,
+                                                      const int32_t act_max,
+                                                      const uint16_t dilation_x,
+                                                      const uint16_t dilation_y,
+                                                      int16_t * tmp_buf);
+
+/**
+ * @brief           This function is used to get the needed size, in bytes, by
+ *                  the temporary buffer of
+ *                  riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt.
+ * @param[in]       in_tensor_ch        Number of input tensor channels
+ * @param[in]       ch_mult             Multiplier of input tensor channels
+ * @param[in]       ker_dim_x           X dimension of the filter kernel
+ * @param[in]       ker_dim_y           Y dimension of the filter kernel
+ * @param[in]       pad_x               Padding size in the x dimension
+ * @return          This function returns the needed size by the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(const uint16_t in_tensor_ch,
+                                                                      const uint16_t ch_mult,
+                                                                      const uint16_t ker_dim_x,
+                                                                      const uint16_t ker_dim_y,
+                                                                      const uint16_t pad_x);
+
+/**
+ * @brief           This is a multi-threaded version of
+ *                  riscv_nn_fc_s8_s8_s8_asym_bias. It splits the batches into
+ *                  one contiguous range per thread if there are at least as
+ *                  many batches as threads, and the output channels otherwise.
+ * @param[in]       in_vec          Pointer to the input vector
+ * @param[in]       wt_mat          Pointer to the transposed weight matrix
+ * @param[in]       in_vec_col      Number of columns in the input vector (or
+ *                                  transposed weight matrix)
+ * @param[in]       wt_mat_row      Number of rows in the transposed weight
+ *                                  matrix
+ * @param[in]       in_vec_batch    Number of batches in the input vector
+ * @param[in]       in_offset       Offset value for the input vector
+ * @param[in]       wt_offset       Offset value for the weight matrix
+ * @param[in]       out_scale       Scaling value for the quantization on the
+ *                                  outputs
+ * @param[in]       out_shift       Shift amount for the quantization on the
+ *                                  outputs
+ * @param[in]       out_offset      Offset value for the outputs
+ * @param[in]       bias            Pointer to the bias vector
+ * @param[out]      out_vec         Pointer to the output vector
+ * @param[in]       act_min         Minimum value that the outputs are limited
+ *                                  to
+ * @param[in]       act_max         Maximum value that the outputs are limited
+ *                                  to
+ * @param[in]       tmp_buf         Temporary buffer for the calculation. Its
+ *                                  size, in bytes, could be obtained by
+ *                                  calling
+ *                                  riscv_nn_fc_s8_s8_s8_asym_bias_mt_get_buffer_size.
+ * @return          This function only returns 0.
+ */
+int32_t riscv_nn_fc_s8_s8_s8_asym_bias_mt(const int8_t * in_vec,
+                                          const int8_t * wt_mat,
+                                          const uint16_t in_vec_col,
+                                          const uint16_t wt_mat_row,
+                                          const uint16_t in_vec_batch,
+                                          const int32_t in_offset,
+                                          const int32_t wt_offset,
+                                          const int32_t out_scale,
+                                          const int32_t out_shift,
+                                          const int32_t out_offset,
+                                          const int32_t * bias,
+                                          int8_t * out_vec,
+                                          const int32_t act_min,
+                                          const int32_t act_max,
+                                          int16_t * tmp_buf);
+
+/**
+ * @brief           This function is used to get the needed size, in bytes, by
+ *                  the temporary buffer of riscv_nn_fc_s8_s8_s8_asym_bias_mt.
+ * @param[in]       in_vec_col      Number of columns in the input vector (or
+ *                                  transposed weight matrix)
+ * @return          This function returns the needed size by the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_fc_s8_s8_s8_asym_bias_mt_get_buffer_size(const uint16_t in_vec_col);
+
+/**
+ * @brief           This is a multi-threaded version of
+ *                  riscv_nn_batch_matmul_s8_s8_s8. It splits the output rows
+ *                  of all batches and heights into one contiguous range per
+ *                  thread.
+ * @param[in]       in_lhs          Pointer to the left-hand side input tensor
+ * @param[in]       in_rhs          Pointer to the right-hand side input tensor
+ * @param[in]       lhs_offset      Offset value for the left-hand side inputs
+ * @param[in]       rhs_offset      Offset value for the right-hand side inputs
+ * @param[in]       bias            Pointer to the bias vector
+ * @param[in]       dst             Pointer to the output tensor
+ * @param[in]       out_offset      Offset value for the output tensor
+ * @param[in]       out_scale       Scaling value for the quantization on the
+ *                                  outputs
+ * @param[in]       out_shift       Shift amount for the quantization on the
+ *                                  outputs
+ * @param[in]       lhs_dim_n       N dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_h       H dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       lhs_dim_w       W dimension of the left-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_n       N dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_h       H dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_w       W dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       rhs_dim_c       C dimension of the right-hand side input
+ *                                  tensor
+ * @param[in]       out_dim_n       N dimension of the output tensor
+ * @param[in]       out_dim_h       H dimension of the output tensor
+ * @param[in]       act_min         Minimum value that the output tensor is
+ *                                  limited to
+ * @param[in]       act_max         Maximum value that the output tensor is
+ *                                  limited to
+ * @return          This function only returns 0.
+ *
+ * @note
+ *  - No temporary buffer is needed, as riscv_nn_batch_matmul_s8_s8_s8 needs
+ *    none.
+ */
+int32_t riscv_nn_batch_matmul_s8_s8_s8_mt(const int8_t * in_lhs,
+                                          const int8_t * in_rhs,
+                                          const int16_t lhs_offset,
+                                          const int16_t rhs_offset,
+                                          const int32_t * bias,
+                                          int8_t * dst,
+                                          const int16_t out_offset,
+                                          const int32_t out_scale,
+                                          const int32_t out_shift,
+                                          const int32_t lhs_dim_n,
+                                          const int32_t lhs_dim_h,
+                                          const int32_t lhs_dim_w,
+                                          const int32_t rhs_dim_n,
+                                          const int32_t rhs_dim_h,
+                                          const int32_t rhs_dim_w,
+                                          const int32_t rhs_dim_c,
+                                          const int32_t out_dim_n,
+                                          const int32_t out_dim_h,
+                                          const int32_t act_min,
+                                          const int32_t act_max);
+
+/**
+ *   * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -208,8 +208,8 @@ int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                                    const int32_t lhs_offset,
                                    const int32_t dst_offset,
                                    const int32_t activation_min,
-                                   const int32_t lhs_cols_offset,
-                                   const int32_t activation_max);
+                                   const int32_t activation_max,
+                                   const int32_t lhs_cols_offset);
 
 int32_t riscv_nn_mat_mult_nt_t_s8_v2(const int8_t *lhs,
             const int8_t *rhs,
@@ -227,6 +227,106 @@ int32_t riscv_nn_mat_mult_nt_t_s8_v2(const int8_t *lhs,
             const int32_t lhs_cols_offset,
             int32_t *contri_buf);
 
+// Core of riscv_nn_mat_mult_nt_t_s8 and _v2, which leave the tile to the
+// shape.
+// - dst_stride: distance between two output rows of dst (rhs_rows for a
+//   dense output; larger to write one group of a grouped convolution)
+// - contri_buf: optional per-rhs-row bias + lhs_offset * sum(rhs row)
+// - tile_rows: lhs rows per register tile; 2 for the 2x2 tile, 4 or 8 for the
+//   4x4 or 8x4 tiles on packed rhs panels, or 0 to select by shape (the 4x4
+//   tile when lhs_rows and rhs_rows are both at least 4)
+// The 4x4 and 8x4 tiles keep a 4 * NN_MAT_MULT_PANEL_K byte panel and
+// 16 * NN_MAT_MULT_PANEL_ROWS bytes of accumulators on the stack (384 bytes
+// with the defaults); the 2x2 tile needs no extra stack.
+int32_t riscv_nn_mat_mult_nt_t_s8_core(const int8_t *lhs,
+                                       const int8_t *rhs,
+                                       const int32_t *bias,
+                                       int8_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,
+                                       const int32_t dst_offset,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const int32_t lhs_cols_offset,
+                                       const int32_t dst_stride,
+                                       const int32_t *contri_buf,
+                                       const int32_t tile_rows);
+
+// Gather the receptive field of one output pixel into col (im2col), for the
+// ker_ch channels starting at in_tensor. (base_idx_x, base_idx_y) is the input
+// position of the top-left tap, possibly negative. Taps outside the input are
+// filled with pad_val, which is -in_offset for the asym kernels so that they
+// add nothing once the offset is applied.
+void riscv_nn_im2col_HWC_s8(const int8_t * in_tensor,
+                            const int32_t in_tensor_dim_x,
+                            const int32_t in_tensor_dim_y,
+                            const int32_t in_tensor_ch,
+                            const int32_t ker_dim_x,
+                            const int32_t ker_dim_y,
+                            const int32_t ker_ch,
+                            const int32_t base_idx_x,
+                            const int32_t base_idx_y,
+                            const int32_t dilation_x,
+                            const int32_t dilation_y,
+                            const int8_t pad_val,
+                            int8_t * col);
+
+// Reorder the rhs matrix of riscv_nn_mat_mult_nt_t_s8 into the panel layout
+// of its 4-column tiles: every group of 4 rows is interleaved column by
+// column (packed[4 * k + j] = rhs[j][k]); the rhs_rows % 4 left-over rows are
+// kept in row order. packed_rhs has the same size as rhs.
+void riscv_nn_mat_mult_nt_t_s8_pack_rhs(const int8_t *rhs,
+                                         const int32_t rhs_rows,
+                                         const int32_t rhs_cols,
+                                         int8_t *packed_rhs);
+
+// riscv_nn_mat_mult_nt_t_s8_core on an rhs packed by
+// riscv_nn_mat_mult_nt_t_s8_pack_rhs. contri_buf is required and holds
+// bias[i] + lhs_offset * sum(rhs[i][:]) for every rhs row. The 4x4 tile is
+// always used and keeps 16 * NN_MAT_MULT_PANEL_ROWS bytes of accumulators on
+// the stack.
+int32_t riscv_nn_mat_mult_nt_t_s8_packed(const int8_t *lhs,
+                                         const int8_t *packed_rhs,
+                                         const int32_t *contri_buf,
+                                         int8_t *dst,
+                                         const int32_t *dst_multipliers,
+                                         const int32_t *dst_shifts,
+                                         const int32_t lhs_rows,
+                                         const int32_t rhs_rows,
+                                         const int32_t rhs_cols,
+                                         const int32_t dst_offset,
+                                         const int32_t activation_min,
+                                         const int32_t activation_max,
+                                         const int32_t lhs_cols_offset,
+                                         const int32_t dst_stride);
+
+// riscv_nn_mat_mult_nt_t_s8_core whose outputs have the residual added to
+// them, as riscv_nn_ew_add_s8_asym would with the products as in_vec1, before
+// they are stored to dst. res points to the residual element of dst[0] and
+// shares dst_stride; it may be the same as dst. The 4x4 tile runs on all
+// rhs rows but the rhs_rows % 4 left over, which take a plain dot product.
+int32_t riscv_nn_mat_mult_nt_t_s8_add(const int8_t *lhs,
+                                      const int8_t *rhs,
+                                      const int32_t *bias,
+                                      int8_t *dst,
+                                      const int32_t *dst_multipliers,
+                                      const int32_t *dst_shifts,
+                                      const int32_t lhs_rows,
+                                      const int32_t rhs_rows,
+                                      const int32_t rhs_cols,
+                                      const int32_t lhs_offset,
+                                      const int32_t dst_offset,
+                                      const int32_t activation_min,
+                                      const int32_t activation_max,
+                                      const int32_t lhs_cols_offset,
+                                      const int32_t dst_stride,
+                                      const riscv_nn_residual_add_params *residual,
+                                      const int8_t *res);
+
 int riscv_nn_mat_mult_nt_t_s4(const int8_t *lhs,
                               const int8_t *packed_rhs,
                               const int32_t *bias,
@@ -242,6 +342,67 @@ int riscv_nn_mat_mult_nt_t_s4(const int8_t *lhs,
                               const int32_t activation_max,
                               const int32_t lhs_cols_offset);
 
+// riscv_nn_mat_mult_nt_t_s8_core with a single dst_multiplier and dst_shift
+// shared by all rhs rows. bias may be NULL.
+int32_t riscv_nn_mat_mult_nt_t_s8_per_tensor(const int8_t *lhs,
+                                             const int8_t *rhs,
+                                             const int32_t *bias,
+                                             int8_t *dst,
+                                             const int32_t dst_multiplier,
+                                             const int32_t dst_shift,
+                                             const int32_t lhs_rows,
+                                             const int32_t rhs_rows,
+                                             const int32_t rhs_cols,
+                                             const int32_t lhs_offset,
+                                             const int32_t dst_offset,
+                                             const int32_t activation_min,
+                                             const int32_t activation_max,
+                                             const int32_t lhs_cols_offset,
+                                             const int32_t dst_stride);
+
+// dst = lhs x rhs for a non-transposed rhs[rhs_rows][rhs_cols] (rhs_rows is
+// the inner dimension), with one dst_multiplier and dst_shift for all
+// outputs. bias has rhs_cols entries and may be NULL. It runs the 4x4 tile of
+// riscv_nn_mat_mult_nt_t_s8_core and takes the same stack.
+int32_t riscv_nn_mat_mult_nt_nt_s8_per_tensor(const int8_t *lhs,
+                                              const int8_t *rhs,
+                                              const int32_t *bias,
+                                              int8_t *dst,
+                                              const int32_t dst_multiplier,
+                                              const int32_t dst_shift,
+                                              const int32_t lhs_rows,
+                                              const int32_t rhs_rows,
+                                              const int32_t rhs_cols,
+                                              const int32_t lhs_offset,
+                                              const int32_t dst_offset,
+                                              const int32_t activation_min,
+                                              const int32_t activation_max,
+                                              const int32_t lhs_cols_offset,
+                                              const int32_t dst_stride);
+
+// riscv_nn_mat_mult_nt_t_s8_core on an rhs of packed int4 values (see
+// riscv_nn_mat_mult_nt_t_s4). Each group of 4 rhs rows is unpacked once into
+// rhs_buf, which holds 4 * rhs_cols bytes. contri_buf may be NULL. As for
+// riscv_nn_mat_mult_nt_t_s8_packed, 16 * NN_MAT_MULT_PANEL_ROWS bytes of
+// accumulators are kept on the stack.
+int32_t riscv_nn_mat_mult_nt_t_s4_core(const int8_t *lhs,
+                                       const int8_t *packed_rhs,
+                                       const int32_t *bias,
+                                       int8_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,
+                                       const int32_t dst_offset,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const int32_t lhs_cols_offset,
+                                       const int32_t dst_stride,
+                                       const int32_t *contri_buf,
+                                       int8_t *rhs_buf);
+
 //========== sub-functions for convolution ==========
 // following are internal sub-functions called by NN convolution functions
 
@@ -1161,6 +1322,8 @@ int32_t nn_mat_mat_mult_t_s8_s8_s8(const int8_t *lhs,
                                    const int32_t act_min,
                                    const int32_t act_max);
 
+// Matrix form of nn_vec_mat_mult_t_s16_s16_s16 over lhs_rows contiguous lhs
+// rows; out_scale is the full 32-bit multiplier and the offsets are unused.
 int32_t nn_mat_mat_mult_t_s16_s16_s16(const int16_t *lhs,
                                       const int16_t *rhs,
                                       const int32_t lhs_offset,
@@ -1176,6 +1339,34 @@ int32_t nn_mat_mat_mult_t_s16_s16_s16(const int16_t *lhs,
                                       const int32_t act_min,
                                       const int32_t act_max);
 
+// nn_mat_mat_mult_t_s16_s16_s16 for a non-transposed rhs[rhs_rows][rhs_cols];
+// lhs has rhs_rows columns and dst has rhs_cols columns.
+int32_t nn_mat_mat_mult_s16_s16_s16(const int16_t *lhs,
+                                    const int16_t *rhs,
+                                    const int32_t lhs_offset,
+                                    const int32_t rhs_offset,
+                                    const int64_t *bias,
+                                    int16_t *dst,
+                                    const int32_t out_offset,
+                                    const int32_t out_scale,
+                                    const int32_t out_shift,
+                                    const int32_t lhs_rows,
+                                    const int32_t rhs_rows,
+                                    const int32_t rhs_cols,
+                                    const int32_t act_min,
+                                    const int32_t act_max);
+
+// lut[d] = exp(-d) in Q15 for the 8-bit score differences d = max - score in
+// [first, last), evaluated as riscv_nn_softmax_s8_s16_hp does for the same
+// scale, lshift and diff_min; differences below diff_min get 0. A full table
+// covers 0 to 255.
+void riscv_nn_attention_exp_lut_s8(int32_t *lut,
+                                   const int32_t first,
+                                   const int32_t last,
+                                   const int32_t scale,
+                                   const int32_t lshift,
+                                   const int32_t diff_min);
+
 int8_t * riscv_nn_mat_mul_kernel_tiling_asym_s8_s8_s8(const int8_t * src1,
                                                     const int8_t * src2,
                                                     int32_t * tmp_out,
@@ -1371,6 +1562,88 @@ void nn_transpose_nhwc_to_ncwh_s32(int32_t * in_tensor,
                                    const uint32_t in_tensor_batch,
                                    int32_t *out_tensor);
 
+// Depthwise convolution (ch_mult 1, no dilation) with a ker_size x ker_size
+// kernel, where ker_size is 5 or 7; returns -1 for other sizes. Interior
+// pixels are computed four at a time per channel so that kernel rows and, at
+// stride 1, input pixels are loaded once for several outputs.
+int32_t riscv_nn_dw_conv_HWC_kxk_s8(const int8_t * in_tensor,
+                                    const int32_t in_tensor_dim_x,
+                                    const int32_t in_tensor_dim_y,
+                                    const int32_t in_tensor_ch,
+                                    const int8_t * ker_weight,
+                                    const int32_t ker_size,
+                                    const int32_t pad_x,
+                                    const int32_t pad_y,
+                                    const int32_t stride_x,
+                                    const int32_t stride_y,
+                                    const int32_t * bias,
+                                    int8_t * out_tensor,
+                                    const int32_t * out_shift,
+                                    const int32_t * out_scale,
+                                    const int32_t out_tensor_dim_x,
+                                    const int32_t out_tensor_dim_y,
+                                    const int32_t out_offset,
+                                    const int32_t in_offset,
+                                    const int32_t act_min,
+                                    const int32_t act_max);
+
+// Run output rows [row_start, row_end) of one batch of
+// riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym into out_rows. in_tensor points to
+// the batch and every row must read at least one input row, i.e.
+// stride_y * (row_end - 1) - pad_y < in_tensor_dim_y. The buffer size is in
+// bytes, a multiple of 4, and covers any slice of the layer.
+int32_t riscv_nn_conv_HWC_s8_asym_rows(const int8_t * in_tensor,
+                                       const int32_t in_tensor_dim_x,
+                                       const int32_t in_tensor_dim_y,
+                                       const int32_t in_tensor_ch,
+                                       const int8_t * ker_weight,
+                                       const int32_t out_tensor_ch,
+                                       const int32_t ker_dim_x,
+                                       const int32_t ker_dim_y,
+                                       const int32_t ker_ch,
+                                       const int32_t pad_x,
+                                       const int32_t pad_y,
+                                       const int32_t stride_x,
+                                       const int32_t stride_y,
+                                       const int32_t * bias,
+                                       int8_t * out_rows,
+                                       const int32_t * out_shift,
+                                       const int32_t * out_scale,
+                                       const int32_t out_offset,
+                                       const int32_t in_offset,
+                                       const int32_t act_min,
+                                       const int32_t act_max,
+                                       const int32_t out_tensor_dim_x,
+                                       const int32_t row_start,
+                                       const int32_t row_end,
+                                       const int32_t dilation_x,
+                                       const int32_t dilation_y,
+                                       int16_t * in_tmp_buf);
+
+int32_t riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(const int32_t in_tensor_dim_x,
+                                                       const int32_t in_tensor_dim_y,
+                                                       const int32_t in_tensor_ch,
+                                                       const int32_t ker_dim_x,
+                                                       const int32_t ker_dim_y,
+                                                       const int32_t ker_ch,
+                                                       const int32_t pad_x,
+                                                       const int32_t pad_y,
+                                                       const int32_t stride_x,
+                                                       const int32_t stride_y,
+                                                       const int32_t out_tensor_dim_x,
+                                                       const int32_t out_tensor_dim_y,
+                                                       const int32_t out_tensor_ch,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y);
+
+// Split [0, total) into num_tasks contiguous ranges whose lengths differ by at
+// most one, and return the [start, end) range of task task_idx.
+void riscv_nn_parallel_split(const int32_t total,
+                             const int32_t num_tasks,
+                             const int32_t task_idx,
+                             int32_t * start,
+                             int32_t * end);
+
 void nn_transpose_nhwc_to_hncw_s32(int32_t *in_tensor,
 							 	   const uint32_t in_tensor_dim_x,
 								   const uint32_t in_tensor_dim_y,
@@ -128,4 +128,150 @@ typedef enum
 	NN_WZYX_2_YWZX = 7,  // perm:[2,0,1,3]
 } riscv_nn_transpose_format;
 
+/** Buffer of a tensor arena: size and lifetime in, placement out */
+typedef struct
+{
+    int32_t size;       /**< Size of the buffer in bytes */
+    int32_t first_use;  /**< Index of the first layer that writes or reads the buffer */
+    int32_t last_use;   /**< Index of the last layer that reads the buffer */
+    int32_t offset;     /**< Offset of the buffer in the arena, set by riscv_nn_arena_plan */
+} riscv_nn_arena_buffer;
+
+/** Residual (skip) input and quantization of a fused element-wise addition.
+ *  The fields follow the second input and the output arguments of
+ *  riscv_nn_ew_add_s8_asym; the fused layer output takes the place of its
+ *  first input. */
+typedef struct
+{
+    const int8_t *in_tensor;    /**< Skip tensor, laid out as the layer output */
+    int32_t layer_offset;       /**< in_offset1 applied to the layer output */
+    int32_t layer_scale;        /**< in_scale1 applied to the layer output */
+    int32_t layer_rshift;       /**< in_rshift1 applied to the layer output */
+    int32_t in_offset;          /**< in_offset2 applied to the skip tensor */
+    int32_t in_scale;           /**< in_scale2 applied to the skip tensor */
+    int32_t in_rshift;          /**< in_rshift2 applied to the skip tensor */
+    int32_t lshift;             /**< Left shift applied to both inputs */
+    int32_t out_offset;         /**< Offset of the sum */
+    int32_t out_scale;          /**< Scaling value of the sum */
+    int32_t out_rshift;         /**< Right shift of the sum */
+    int32_t act_min;            /**< Min value used to clamp the sum */
+    int32_t act_max;            /**< Max value used to clamp the sum */
+} riscv_nn_residual_add_params;
+
+/** Pooling operation of a fused pooling layer */
+typedef enum
+{
+    NN_POOL_MAX = 0,    /**< riscv_nn_maxpool_HWC_s8_any_act */
+    NN_POOL_AVE = 1,    /**< riscv_nn_avepool_HWC_s8_any_act */
+} riscv_nn_pool_type;
+
+/** Window, output size and activation of a fused pooling layer */
+typedef struct
+{
+    riscv_nn_pool_type type;    /**< Max or average pooling */
+    int32_t ker_dim_x;          /**< X dimension of the pooling window */
+    int32_t ker_dim_y;          /**< Y dimension of the pooling window */
+    int32_t stride_x;           /**< Stride of the pooling window in the x dimension */
+    int32_t stride_y;           /**< Stride of the pooling window in the y dimension */
+    int32_t pad_x;              /**< Padding size in the x dimension */
+    int32_t pad_y;              /**< Padding size in the y dimension */
+    int32_t act_min;            /**< Min value used to clamp the pooled outputs */
+    int32_t act_max;            /**< Max value used to clamp the pooled outputs */
+    int32_t out_tensor_dim_x;   /**< X dimension of the pooled output */
+    int32_t out_tensor_dim_y;   /**< Y dimension of the pooled output */
+} riscv_nn_pool_params;
+
+/** State of a row-streamed s8 convolution. It is set up by
+ *  riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init or
+ *  riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init and advanced by
+ *  riscv_nn_conv_stream_push_row_s8. */
+typedef struct
+{
+    const int8_t *ker_weight;
+    const int32_t *bias;
+    const int32_t *out_shift;
+    const int32_t *out_scale;
+    int8_t *rows;               /**< Ring of the input rows of the current window */
+    int16_t *tmp_buf;           /**< Scratch of the convolution */
+    int32_t in_dim_x, in_dim_y, in_ch, out_ch;
+    int32_t ch_mult;            /**< Channel multiplier of a depthwise layer; 0 for a convolution */
+    int32_t ker_dim_x, ker_dim_y, ker_ch;
+    int32_t pad_x, pad_y, stride_x, stride_y, dilation_x, dilation_y;
+    int32_t out_offset, in_offset, act_min, act_max;
+    int32_t out_dim_x, out_dim_y;
+    int32_t max_out_rows;       /**< Most output rows returned by one push */
+    int32_t rows_in;            /**< Input rows pushed so far in this frame */
+    int32_t rows_out;           /**< Output rows returned so far in this frame */
+    int32_t held_start;         /**< Input row held first, at slot held_start modulo the ring size of rows */
+    int32_t held;               /**< Number of input rows held in rows */
+} riscv_nn_conv_stream;
+
+/** Kind of a layer of riscv_nn_conv_chain_s8 */
+typedef enum
+{
+    NN_CONV_STANDARD = 0,       /**< riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym */
+    NN_CONV_DEPTHWISE = 1       /**< riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym */
+} riscv_nn_conv_type;
+
+/** One layer of a convolution chain run by riscv_nn_conv_chain_s8. The fields
+ *  follow the arguments of the wrapper that type selects; ker_ch is ignored
+ *  for a depthwise layer and ch_mult for a convolution. */
+typedef struct
+{
+    riscv_nn_conv_type type;
+    const int8_t *ker_weight;
+    const int32_t *bias;
+    const int32_t *out_shift;
+    const int32_t *out_scale;
+    int32_t in_dim_x, in_dim_y, in_ch, out_ch;
+    int32_t ch_mult, ker_dim_x, ker_dim_y, ker_ch;
+    int32_t pad_x, pad_y, stride_x, stride_y, dilation_x, dilation_y;
+    int32_t out_offset, in_offset, act_min, act_max;
+    int32_t out_dim_x, out_dim_y;
+} riscv_nn_conv_layer;
+
+/** Cost of running a convolution chain with a given tile height, reported by
+ *  riscv_nn_conv_chain_s8_get_cost */
+typedef struct
+{
+    int32_t buffer_size;        /**< Bytes of the temporary buffer */
+    int32_t tile_size;          /**< Bytes of it that hold intermediate tiles */
+    int64_t macs;               /**< Multiply-accumulates per batch */
+    int64_t recomputed_macs;    /**< Part of macs spent on recomputed halo rows */
+} riscv_nn_conv_chain_cost;
+
+/** Key/value cache of one sequence for incremental decoding with signed 8-bit
+ *  keys and values. The rows of each head form a ring of capacity tokens, so
+ *  riscv_nn_kv_cache_s8_evict never moves data. Set it up with
+ *  riscv_nn_kv_cache_s8_init. */
+typedef struct
+{
+    int8_t *k;                           /**< Keys of [kv_heads][capacity][head_dim] */
+    int8_t *v;                           /**< Values of [kv_heads][capacity][head_dim] */
+    const riscv_nn_scaling *qk_scaling;  /**< Per-head requantization of the query-key products into 8-bit scores */
+    const riscv_nn_scaling *out_scaling; /**< Per-head requantization from value units to the outputs */
+    const int16_t *k_offset;             /**< Per-head key offsets, or NULL for symmetric keys */
+    const int16_t *v_offset;             /**< Per-head value offsets, or NULL for symmetric values */
+    int32_t kv_heads;
+    int32_t head_dim;
+    int32_t capacity;                    /**< Tokens each head can hold */
+    int32_t start;                       /**< Ring slot of the oldest cached token */
+    int32_t len;                         /**< Number of cached tokens */
+} riscv_nn_kv_cache_s8;
+
+#if defined (__riscv_zfh)
+/** Key/value cache of one sequence for incremental decoding with
+ *  half-precision keys and values, laid out as riscv_nn_kv_cache_s8 */
+typedef struct
+{
+    float16_t *k;                        /**< Keys of [kv_heads][capacity][head_dim] */
+    float16_t *v;                        /**< Values of [kv_heads][capacity][head_dim] */
+    int32_t kv_heads;
+    int32_t head_dim;
+    int32_t capacity;                    /**< Tokens each head can hold */
+    int32_t start;                       /**< Ring slot of the oldest cached token */
+    int32_t len;                         /**< Number of cached tokens */
+} riscv_nn_kv_cache_f16;
+#endif
+
 #endif // RISCV_NN_TYPES_H
\ No newline at end of file
@@ -53,6 +53,64 @@ typedef enum
  */
 char * get_version_libnn(void);
 
+/**
+ * @brief           This function plans a static tensor arena. It places every
+ *                  buffer at an offset such that no two buffers whose
+ *                  lifetimes overlap share any byte, and returns the arena
+ *                  size needed.
+ * @param[in,out]   buffers         Pointer to the buffers. The size, first_use
+ *                                  and last_use of each buffer are read and
+ *                                  its offset is written.
+ * @param[in]       num_buffers     Number of buffers
+ * @param[in]       align           Alignment, in bytes, of every offset. It
+ *                                  should be a power of 2.
+ * @param[in]       tmp_buf         Temporary buffer for the planning. Its
+ *                                  size, in bytes, could be obtained by
+ *                                  calling riscv_nn_arena_plan_get_buffer_size.
+ * @return          This function returns the arena size in bytes, i.e. the
+ *                  peak RAM of the planned buffers; otherwise, it returns -1
+ *                  if a size is negative, a lifetime is empty or align is not
+ *                  a power of 2.
+ *
+ * @note
+ *  - Lifetimes are inclusive layer indices. An activation produced by layer i
+ *    and last consumed by layer j has first_use = i and last_use = j; the
+ *    scratch buffer of layer i, whose size comes from the layer's
+ *    *_get_buffer_size function, has first_use = last_use = i, so the scratch
+ *    buffers of different layers share the same bytes.
+ *  - The placement is greedy by size: buffers are placed from the largest to
+ *    the smallest, each at the lowest aligned offset that does not collide
+ *    with an already placed buffer alive at the same time.
+ *
+ * @b Example:
+ * @code
+ * // conv (layer 0) -> avepool (layer 1), with the input in the arena too
+ * riscv_nn_arena_buffer buf[4] =
+ * {
+ *     {IN_SIZE,  0, 0, 0},
+ *     {riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(...), 0, 0, 0},
+ *     {MID_SIZE, 0, 1, 0},
+ *     {OUT_SIZE, 1, 1, 0},
+ * };
+ * int32_t tmp[4 * 2];
+ * int32_t peak = riscv_nn_arena_plan(buf, 4, 4, tmp);
+ * // arena + buf[i].offset is the address of buffer i
+ * @endcode
+ */
+int32_t riscv_nn_arena_plan(riscv_nn_arena_buffer * buffers,
+                            const int32_t num_buffers,
+                            const int32_t align,
+                            int32_t * tmp_buf);
+
+/**
+ * @brief           This function is used to get the needed size, in bytes, by
+ *                  the temporary buffer of riscv_nn_arena_plan.
+ * @param[in]       num_buffers     Number of buffers
+ * @return          This function returns the needed size by the temporary
+ *                  buffer.
+ */
+int32_t riscv_nn_arena_plan_get_buffer_size(const int32_t num_buffers);
+
 /**
  * @brief           This function finds the indices of the maximum vlues along
  *                  the specified axis.
@@ -261,6 +319,45 @@ int32_t riscv_nn_gather_HWC_s16(const int16_t * in_tensor,
                                 const uint32_t axis, // 0-3
                                 int16_t * out_tensor);
 
+/**
+ * @brief           This function folds the input offset and the bias of a
+ *                  signed 8-bit convolution or fully-connected layer into one
+ *                  effective bias per output channel, i.e.
+ *                  kernel_sum[i] = bias[i] + in_offset * sum(ker_weight[i][:]).
+ * @param[in]       ker_weight          Pointer to the kernel weights. The
+ *                                      weights of each output channel are
+ *                                      stored contiguously.
+ * @param[in]       bias                Pointer to the bias vector. It can be
+ *                                      NULL.
+ * @param[in]       out_tensor_ch       Number of output channels
+ * @param[in]       ker_size            Number of weights per output channel
+ *                                      (ker_dim_x * ker_dim_y * ker_ch for
+ *                                      convolutions and the input vector
+ *                                      size for fully-connected layers)
+ * @param[in]       in_offset           Offset value for the input tensor. It
+ *                                      should be in the range of -127 to 128.
+ * @param[out]      kernel_sum          Pointer to the output effective bias
+ *                                      vector of out_tensor_ch elements
+ * @return          This function only returns 0.
+ *
+ * @note
+ * - The weights are constant, so this function is meant to be called once
+ *   when the model is loaded. Passing kernel_sum as the bias and 0 as
+ *   in_offset to riscv_nn_fc_s8_s8_s8_asym_bias,
+ *   riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any or
+ *   riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym (when it selects the 1x1 path,
+ *   i.e. a 1x1 kernel without padding or dilation) gives bit-exact results
+ *   and removes the per-call pass over the weights.
+ * - It must not be used for convolutions with padding, as padded positions
+ *   do not contribute in_offset to the sum.
+ */
+int32_t riscv_nn_kernel_sum_s8(const int8_t * ker_weight,
+                               const int32_t * bias,
+                               const int32_t out_tensor_ch,
+                               const int32_t ker_size,
+                               const int32_t in_offset,
+                               int32_t * kernel_sum);
+
 #ifdef __riscv_zfh
 /**
  * @brief           This function performs layer normalization on
@@ -29,6 +29,7 @@ SRC_DIR := $(addprefix $(SRC_ROOT)/, ActivationFunctions \
 									 ConvolutionFunctions \
 									 FullyConnectedFunctions \
 									 NNSupportFunctions \
+									 ParallelFunctions \
 									 PoolingFunctions \
 									 SoftmaxFunctions \
 									 UtilFunctions)
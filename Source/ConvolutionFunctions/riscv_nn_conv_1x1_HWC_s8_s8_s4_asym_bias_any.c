@@ -53,7 +53,41 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
         return -1;
     }
 
-    (void)tmp_buf;
+    if (tmp_buf != NULL)
+    {
+        // the weights of every group of 4 output channels are unpacked into
+        // tmp_buf once per call (or once per output row when strided)
+        const int32_t rhs_rows = out_tensor_ch;
+        const int32_t rhs_cols = in_tensor_ch;
+
+        if ((stride_x == 1) && (stride_y == 1))
+        {
+            riscv_nn_mat_mult_nt_t_s4_core(in_tensor, ker_weight, bias, out_tensor, out_scale,
+                                           out_shift, in_tensor_dim_x * in_tensor_dim_y * in_tensor_batch,
+                                           rhs_rows, rhs_cols, in_offset, out_offset, act_min, act_max,
+                                           rhs_cols, rhs_rows, NULL, tmp_buf);
+        }
+        else
+        {
+            const int32_t input_inc = in_tensor_dim_x * stride_y * rhs_cols;
+            const int32_t output_inc = out_tensor_dim_x * rhs_rows;
+
+            for (int i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+            {
+                const int8_t *in_tensor2 = in_tensor + (i_batch * rhs_cols * in_tensor_dim_x * in_tensor_dim_y);
+                for (int i_output_h = 0; i_output_h < out_tensor_dim_y; i_output_h++)
+                {
+                    riscv_nn_mat_mult_nt_t_s4_core(in_tensor2, ker_weight, bias, out_tensor, out_scale,
+                                                   out_shift, out_tensor_dim_x, rhs_rows, rhs_cols,
+                                                   in_offset, out_offset, act_min, act_max,
+                                                   rhs_cols * stride_x, rhs_rows, NULL, tmp_buf);
+                    in_tensor2 += input_inc;
+                    out_tensor += output_inc;
+                }
+            }
+        }
+        return 0;
+    }
 
     if ((stride_x == 1) && (stride_y == 1))
     {
@@ -118,7 +152,6 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
 int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch,
                                                                      const int32_t out_tensor_ch)
 {
-    (void)in_tensor_ch;
     (void)out_tensor_ch;
-    return 0;
+    return 4 * in_tensor_ch;
 }
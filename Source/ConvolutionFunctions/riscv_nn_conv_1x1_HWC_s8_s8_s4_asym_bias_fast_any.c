@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright (C) 2010-2025 Arm Limited or its affiliates. All rights reserved.*
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+
+//// Convolution Functions
+
+int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any(const int8_t * in_tensor,
+                                                          const int32_t in_tensor_dim_x,
+                                                          const int32_t in_tensor_dim_y,
+                                                          const int32_t in_tensor_ch,
+                                                          const int32_t in_tensor_batch,
+                                                          const int8_t * ker_weight,
+                                                          const int32_t out_tensor_ch,
+                                                          const int32_t pad_x,
+                                                          const int32_t pad_y,
+                                                          const int32_t stride_x,
+                                                          const int32_t stride_y,
+                                                          const int32_t * bias,
+                                                          int8_t * out_tensor,
+                                                          const int32_t * out_shift,
+                                                          const int32_t * out_scale,
+                                                          const int32_t out_offset,   //value is in the range of [-128, 127]
+                                                          const int32_t in_offset,    //value is in the range of [-127, 128]
+                                                          const int32_t act_min,
+                                                          const int32_t act_max,
+                                                          const int32_t out_tensor_dim_x,
+                                                          const int32_t out_tensor_dim_y,
+                                                          int8_t * tmp_buf)
+{
+    if ((tmp_buf == NULL) ||
+        ((stride_x == 1) && (stride_y == 1)))
+    {
+        return riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(in_tensor, in_tensor_dim_x, in_tensor_dim_y,
+                    in_tensor_ch, in_tensor_batch, ker_weight, out_tensor_ch, pad_x, pad_y, stride_x,
+                    stride_y, bias, out_tensor, out_shift, out_scale, out_offset, in_offset, act_min,
+                    act_max, out_tensor_dim_x, out_tensor_dim_y, tmp_buf);
+    }
+
+    if ((pad_x != 0) ||
+        (pad_y != 0))
+    {
+        return -1;
+    }
+
+    // Strided pixels are gathered behind the unpacked weight group of tmp_buf
+    // into tiles that run across output rows and batches, as in
+    // riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any, so the weights are
+    // unpacked once per tile rather than once per output row.
+    const int32_t rhs_rows = out_tensor_ch;
+    const int32_t rhs_cols = in_tensor_ch;
+    const int32_t out_pixels = out_tensor_dim_x * out_tensor_dim_y;
+    const int32_t total_pixels = out_pixels * in_tensor_batch;
+    const int32_t tile_pixels = nn_conv_1x1_gather_pixels(rhs_cols, out_pixels);
+    int8_t *lhs_buf = tmp_buf + 4 * rhs_cols;
+    const int8_t *in_row = in_tensor;
+    int32_t i_out_x = 0;
+    int32_t i_out_y = 0;
+
+    for (int32_t i_pixel = 0; i_pixel < total_pixels; i_pixel += tile_pixels)
+    {
+        const int32_t pixels = MIN(tile_pixels, total_pixels - i_pixel);
+        int8_t *lhs = lhs_buf;
+
+        for (int32_t i = 0; i < pixels; i++)
+        {
+            memcpy(lhs, in_row + i_out_x * stride_x * rhs_cols, rhs_cols);
+            lhs += rhs_cols;
+            if (++i_out_x == out_tensor_dim_x)
+            {
+                i_out_x = 0;
+                in_row += in_tensor_dim_x * stride_y * rhs_cols;
+                if (++i_out_y == out_tensor_dim_y)
+                {
+                    // the rows below the last strided one are skipped
+                    i_out_y = 0;
+                    in_row += in_tensor_dim_x * (in_tensor_dim_y - out_tensor_dim_y * stride_y) * rhs_cols;
+                }
+            }
+        }
+
+        riscv_nn_mat_mult_nt_t_s4_core(lhs_buf, ker_weight, bias, out_tensor + i_pixel * rhs_rows,
+                                       out_scale, out_shift, pixels, rhs_rows, rhs_cols, in_offset,
+                                       out_offset, act_min, act_max, rhs_cols, rhs_rows, NULL,
+                                       tmp_buf);
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any_get_buffer_size(const int32_t in_tensor_ch,
+                                                                          const int32_t out_tensor_ch,
+                                                                          const int32_t stride_x,
+                                                                          const int32_t stride_y,
+                                                                          const int32_t out_tensor_dim_x,
+                                                                          const int32_t out_tensor_dim_y)
+{
+    // one unpacked group of 4 weight rows, followed by the gathered pixels of
+    // a strided layer
+    int32_t buf_size = riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(in_tensor_ch,
+                                                                                   out_tensor_ch);
+    if ((stride_x != 1) || (stride_y != 1))
+    {
+        buf_size += nn_conv_1x1_gather_pixels(in_tensor_ch, out_tensor_dim_x * out_tensor_dim_y) * in_tensor_ch;
+    }
+    return buf_size;
+}
@@ -21,6 +21,7 @@
 
 #include "internal_nn_math.h"
 #include "riscv_nn_support.h"
+#include "riscv_nn_util.h"
 
 //// Convolution Functions
 
@@ -53,13 +54,12 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const int8_t * in_tens
         return -1;
     }
 
-    (void)tmp_buf;
+    const int32_t rhs_rows = out_tensor_ch;
+    const int32_t rhs_cols = in_tensor_ch;
 
     if ((stride_x == 1) && (stride_y == 1))
     {
         const int32_t lhs_rows = in_tensor_dim_x * in_tensor_dim_y * in_tensor_batch;
-        const int32_t rhs_rows = out_tensor_ch;
-        const int32_t rhs_cols = in_tensor_ch;
         const int32_t lhs_cols_offset = rhs_cols;
 
         riscv_nn_mat_mult_nt_t_s8(in_tensor,
@@ -77,11 +77,73 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const int8_t * in_tens
                                 act_max,
                                 lhs_cols_offset);
     }
+    else if (tmp_buf != NULL)
+    {
+        // Strided pixels are gathered into tiles that run across output rows
+        // and batches, so that one matrix multiplication covers the tile and
+        // the weights are not read again for every output row. The tiles
+        // share bias + in_offset * sum(w), computed once into the front of
+        // tmp_buf; in_offset == 0 (e.g. kernel sums passed as bias) needs no
+        // pass over the weights at all.
+        const int32_t out_pixels = out_tensor_dim_x * out_tensor_dim_y;
+        const int32_t total_pixels = out_pixels * in_tensor_batch;
+        const int32_t tile_pixels = nn_conv_1x1_gather_pixels(rhs_cols, out_pixels);
+        int32_t *contri_buf = NULL;
+        int8_t *lhs_buf = (int8_t *)tmp_buf + rhs_rows * sizeof(int32_t);
+        const int8_t *in_row = in_tensor;
+        int32_t i_out_x = 0;
+        int32_t i_out_y = 0;
+
+        if (in_offset != 0)
+        {
+            contri_buf = (int32_t *)tmp_buf;
+            riscv_nn_kernel_sum_s8(ker_weight, bias, rhs_rows, rhs_cols, in_offset, contri_buf);
+        }
+
+        for (int32_t i_pixel = 0; i_pixel < total_pixels; i_pixel += tile_pixels)
+        {
+            const int32_t pixels = MIN(tile_pixels, total_pixels - i_pixel);
+            int8_t *lhs = lhs_buf;
+
+            for (int32_t i = 0; i < pixels; i++)
+            {
+                memcpy(lhs, in_row + i_out_x * stride_x * rhs_cols, rhs_cols);
+                lhs += rhs_cols;
+                if (++i_out_x == out_tensor_dim_x)
+                {
+                    i_out_x = 0;
+                    in_row += in_tensor_dim_x * stride_y * rhs_cols;
+                    if (++i_out_y == out_tensor_dim_y)
+                    {
+                        // the rows below the last strided one are skipped
+                        i_out_y = 0;
+                        in_row += in_tensor_dim_x * (in_tensor_dim_y - out_tensor_dim_y * stride_y) * rhs_cols;
+                    }
+                }
+            }
+
+            riscv_nn_mat_mult_nt_t_s8_v2(lhs_buf,
+                                         ker_weight,
+                                         bias,
+                                         out_tensor + i_pixel * rhs_rows,
+                                         out_scale,
+                                         out_shift,
+                                         pixels,
+                                         rhs_rows,
+                                         rhs_cols,
+                                         in_offset,
+                                         out_offset,
+                                         act_min,
+                                         act_max,
+                                         rhs_cols,
+                                         contri_buf);
+        }
+    }
     else
     {
+        // without a temporary buffer, the strided rows are read in place one
+        // output row at a time
         const int32_t lhs_rows = out_tensor_dim_x;
-        const int32_t rhs_rows = out_tensor_ch;
-        const int32_t rhs_cols = in_tensor_ch;
         const int32_t input_inc = in_tensor_dim_x * stride_y * rhs_cols;
         const int32_t output_inc = out_tensor_dim_x * rhs_rows;
         const int32_t lhs_cols_offset = rhs_cols * stride_x;
@@ -129,14 +191,16 @@ int32_t riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size(const
 {
     (void) pad_x;
     (void) pad_y;
-    (void) stride_x;
-    (void) stride_y;
-    (void) out_tensor_dim_x;
-    (void) out_tensor_dim_y;
-    int32_t buf_size = 0;
     (void) in_tensor_dim_x;
     (void) in_tensor_dim_y;
-    (void) in_tensor_ch;
-    (void) out_tensor_ch;
+    int32_t buf_size = 0;
+
+    // only a strided layer uses it: the per-channel offset contributions for
+    // riscv_nn_mat_mult_nt_t_s8_v2, followed by one tile of gathered pixels
+    if ((stride_x != 1) || (stride_y != 1))
+    {
+        buf_size = out_tensor_ch * sizeof(int32_t) +
+                   nn_conv_1x1_gather_pixels(in_tensor_ch, out_tensor_dim_x * out_tensor_dim_y) * in_tensor_ch;
+    }
     return buf_size;
 }
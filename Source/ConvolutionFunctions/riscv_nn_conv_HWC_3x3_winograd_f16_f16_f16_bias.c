@@ -0,0 +1,226 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+// Winograd F(4x4, 3x3): 36 multiplications for every 4x4 outputs instead of
+// 144. The transform-domain sums are accumulated in wino_acc_t.
+#ifdef ENA_KERNEL_FP32
+typedef float32_t wino_acc_t;
+#else
+typedef float16_t wino_acc_t;
+#endif
+
+// out = G * in for a column of 3 weights
+static void wino_g_f32(const float32_t *in, const int32_t in_stride, float32_t *out, const int32_t out_stride)
+{
+    const float32_t g0 = in[0];
+    const float32_t g1 = in[in_stride];
+    const float32_t g2 = in[2 * in_stride];
+
+    out[0] = g0 * (1.0f / 4.0f);
+    out[out_stride] = -(g0 + g1 + g2) * (1.0f / 6.0f);
+    out[2 * out_stride] = -(g0 - g1 + g2) * (1.0f / 6.0f);
+    out[3 * out_stride] = g0 * (1.0f / 24.0f) + g1 * (1.0f / 12.0f) + g2 * (1.0f / 6.0f);
+    out[4 * out_stride] = g0 * (1.0f / 24.0f) - g1 * (1.0f / 12.0f) + g2 * (1.0f / 6.0f);
+    out[5 * out_stride] = g2;
+}
+
+// out = B^T * in for a column of 6 inputs
+static void wino_bt_f16(const float16_t *in, const int32_t in_stride, float16_t *out, const int32_t out_stride)
+{
+    const float16_t d0 = in[0];
+    const float16_t d1 = in[in_stride];
+    const float16_t d2 = in[2 * in_stride];
+    const float16_t d3 = in[3 * in_stride];
+    const float16_t d4 = in[4 * in_stride];
+    const float16_t d5 = in[5 * in_stride];
+
+    out[0] = (float16_t)4.0f * d0 - (float16_t)5.0f * d2 + d4;
+    out[out_stride] = -(float16_t)4.0f * (d1 + d2) + d3 + d4;
+    out[2 * out_stride] = (float16_t)4.0f * (d1 - d2) - d3 + d4;
+    out[3 * out_stride] = (float16_t)2.0f * (d3 - d1) - d2 + d4;
+    out[4 * out_stride] = (float16_t)2.0f * (d1 - d3) - d2 + d4;
+    out[5 * out_stride] = (float16_t)4.0f * d1 - (float16_t)5.0f * d3 + d5;
+}
+
+// out = A^T * in for a column of 6 transform-domain sums
+static void wino_at(const wino_acc_t *in, const int32_t in_stride, wino_acc_t *out, const int32_t out_stride)
+{
+    const wino_acc_t m0 = in[0];
+    const wino_acc_t m1 = in[in_stride];
+    const wino_acc_t m2 = in[2 * in_stride];
+    const wino_acc_t m3 = in[3 * in_stride];
+    const wino_acc_t m4 = in[4 * in_stride];
+    const wino_acc_t m5 = in[5 * in_stride];
+    const wino_acc_t s12 = m1 + m2;
+    const wino_acc_t d12 = m1 - m2;
+    const wino_acc_t s34 = m3 + m4;
+    const wino_acc_t d34 = m3 - m4;
+
+    out[0] = m0 + s12 + s34;
+    out[out_stride] = d12 + (wino_acc_t)2.0f * d34;
+    out[2 * out_stride] = s12 + (wino_acc_t)4.0f * s34;
+    out[3 * out_stride] = d12 + (wino_acc_t)8.0f * d34 + m5;
+}
+
+//// Convolution Functions
+int32_t riscv_nn_conv_HWC_3x3_winograd_f16_weight_transform(const float16_t * ker_weight,
+                                                            const uint16_t in_tensor_ch,
+                                                            const uint16_t out_tensor_ch,
+                                                            float16_t * wino_weight)
+{
+    const int32_t plane = in_tensor_ch * out_tensor_ch;
+
+    for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+    {
+        for (int32_t i_in_ch = 0; i_in_ch < in_tensor_ch; i_in_ch++)
+        {
+            const float16_t *g = ker_weight + i_out_ch * 9 * in_tensor_ch + i_in_ch;
+            float32_t gf[9];
+            float32_t tmp[6 * 3];
+            float32_t u[6 * 6];
+
+            for (int32_t i = 0; i < 9; i++)
+            {
+                gf[i] = g[i * in_tensor_ch];
+            }
+            // tmp = G g, then U = tmp G^T
+            for (int32_t x = 0; x < 3; x++)
+            {
+                wino_g_f32(&gf[x], 3, &tmp[x], 3);
+            }
+            for (int32_t r = 0; r < 6; r++)
+            {
+                wino_g_f32(&tmp[3 * r], 1, &u[6 * r], 1);
+            }
+            for (int32_t i = 0; i < 36; i++)
+            {
+                wino_weight[i * plane + i_out_ch * in_tensor_ch + i_in_ch] = (float16_t)u[i];
+            }
+        }
+    }
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias(const float16_t * in_tensor,
+                                                        const uint16_t in_tensor_dim,
+                                                        const uint16_t in_tensor_ch,
+                                                        const float16_t * wino_weight,
+                                                        const uint16_t out_tensor_ch,
+                                                        const uint16_t pad,
+                                                        const float16_t * bias,
+                                                        float16_t * out_tensor,
+                                                        const uint16_t out_tensor_dim,
+                                                        float16_t * tmp_buf)
+{
+    const int32_t plane = in_tensor_ch * out_tensor_ch;
+    const int32_t tiles = (out_tensor_dim + 3) >> 2;
+
+    for (int32_t i_tile_y = 0; i_tile_y < tiles; i_tile_y++)
+    {
+        for (int32_t i_tile_x = 0; i_tile_x < tiles; i_tile_x++)
+        {
+            const int32_t out_y = 4 * i_tile_y;
+            const int32_t out_x = 4 * i_tile_x;
+
+            // V = B^T d B for every input channel, stored as
+            // tmp_buf[(6 * r + c) * in_tensor_ch + ch]
+            for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+            {
+                float16_t d[36];
+                float16_t t[36];
+                float16_t v[36];
+
+                for (int32_t r = 0; r < 6; r++)
+                {
+                    const int32_t y = out_y - pad + r;
+
+                    for (int32_t c = 0; c < 6; c++)
+                    {
+                        const int32_t x = out_x - pad + c;
+
+                        d[6 * r + c] = (y < 0 || y >= in_tensor_dim || x < 0 || x >= in_tensor_dim) ?
+                                       (float16_t)0.0f : in_tensor[(y * in_tensor_dim + x) * in_tensor_ch + ch];
+                    }
+                }
+                for (int32_t c = 0; c < 6; c++)
+                {
+                    wino_bt_f16(&d[c], 6, &t[c], 6);
+                }
+                for (int32_t r = 0; r < 6; r++)
+                {
+                    wino_bt_f16(&t[6 * r], 1, &v[6 * r], 1);
+                }
+                for (int32_t i = 0; i < 36; i++)
+                {
+                    tmp_buf[i * in_tensor_ch + ch] = v[i];
+                }
+            }
+
+            for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+            {
+                const float16_t *u = wino_weight + i_out_ch * in_tensor_ch;
+                wino_acc_t m[36];
+                wino_acc_t s[24];
+                wino_acc_t y[16];
+
+                for (int32_t p = 0; p < 36; p++)
+                {
+                    const float16_t *up = u + p * plane;
+                    const float16_t *vp = tmp_buf + p * in_tensor_ch;
+                    wino_acc_t sum = 0;
+
+                    for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+                    {
+                        sum += (wino_acc_t)up[ch] * (wino_acc_t)vp[ch];
+                    }
+                    m[p] = sum;
+                }
+
+                // Y = A^T M A
+                for (int32_t c = 0; c < 6; c++)
+                {
+                    wino_at(&m[c], 6, &s[c], 6);
+                }
+                for (int32_t r = 0; r < 4; r++)
+                {
+                    wino_at(&s[6 * r], 1, &y[4 * r], 1);
+                }
+
+                for (int32_t r = 0; r < 4 && out_y + r < out_tensor_dim; r++)
+                {
+                    for (int32_t c = 0; c < 4 && out_x + c < out_tensor_dim; c++)
+                    {
+                        out_tensor[((out_y + r) * out_tensor_dim + out_x + c) * out_tensor_ch + i_out_ch] =
+                            (float16_t)(y[4 * r + c] + (wino_acc_t)bias[i_out_ch]);
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+uint32_t riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias_get_buffer_size(const uint16_t in_tensor_ch)
+{
+    return 36 * in_tensor_ch;
+}
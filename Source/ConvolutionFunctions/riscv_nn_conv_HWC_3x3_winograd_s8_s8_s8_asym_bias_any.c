@@ -0,0 +1,254 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+// Winograd F(2x2, 3x3) in integer arithmetic. The weights are transformed
+// with 2G instead of G, so that U' = (2G) g (2G)^T = 4 * U is an exact int16.
+// The input transform B^T d B only adds and subtracts, and the output
+// transform A^T M A then gives exactly 4 times the direct convolution sum.
+static const int8_t wino_g2[4][3] =
+{
+    {2,  0, 0},
+    {1,  1, 1},
+    {1, -1, 1},
+    {0,  0, 2},
+};
+
+//// Convolution Functions
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_weight_transform(const int8_t * ker_weight,
+                                                           const uint16_t in_tensor_ch,
+                                                           const uint16_t out_tensor_ch,
+                                                           int16_t * wino_weight)
+{
+    const int32_t plane = in_tensor_ch * out_tensor_ch;
+
+    for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+    {
+        for (int32_t i_in_ch = 0; i_in_ch < in_tensor_ch; i_in_ch++)
+        {
+            const int8_t *g = ker_weight + i_out_ch * 9 * in_tensor_ch + i_in_ch;
+            int32_t tmp[4][3];
+
+            // tmp = 2G * g
+            for (int32_t i = 0; i < 4; i++)
+            {
+                for (int32_t x = 0; x < 3; x++)
+                {
+                    tmp[i][x] = wino_g2[i][0] * g[x * in_tensor_ch]
+                              + wino_g2[i][1] * g[(3 + x) * in_tensor_ch]
+                              + wino_g2[i][2] * g[(6 + x) * in_tensor_ch];
+                }
+            }
+
+            // U' = tmp * (2G)^T
+            for (int32_t i = 0; i < 4; i++)
+            {
+                for (int32_t j = 0; j < 4; j++)
+                {
+                    const int32_t u = tmp[i][0] * wino_g2[j][0] + tmp[i][1] * wino_g2[j][1]
+                                    + tmp[i][2] * wino_g2[j][2];
+                    wino_weight[(i * 4 + j) * plane + i_out_ch * in_tensor_ch + i_in_ch] = (int16_t)u;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// V = B^T d B for the 4x4 input tile whose top-left corner is (in_y0, in_x0),
+// stored as v[(4 * r + c) * in_tensor_ch + ch]. Positions outside the input
+// read as zero after in_offset is applied.
+static void wino_input_transform_s8(const int8_t * in_tensor,
+                                    const int32_t in_tensor_dim_x,
+                                    const int32_t in_tensor_dim_y,
+                                    const int32_t in_tensor_ch,
+                                    const int32_t in_y0,
+                                    const int32_t in_x0,
+                                    const int32_t in_offset,
+                                    int16_t * v)
+{
+    const int8_t *ptr[16];
+
+    for (int32_t r = 0; r < 4; r++)
+    {
+        for (int32_t c = 0; c < 4; c++)
+        {
+            const int32_t y = in_y0 + r;
+            const int32_t x = in_x0 + c;
+
+            ptr[r * 4 + c] = (y < 0 || y >= in_tensor_dim_y || x < 0 || x >= in_tensor_dim_x) ?
+                             NULL : in_tensor + (y * in_tensor_dim_x + x) * in_tensor_ch;
+        }
+    }
+
+    for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+    {
+        int32_t d[16];
+        int32_t t[16];
+
+        for (int32_t i = 0; i < 16; i++)
+        {
+            d[i] = (ptr[i] != NULL) ? ptr[i][ch] + in_offset : 0;
+        }
+
+        // t = B^T d
+        for (int32_t c = 0; c < 4; c++)
+        {
+            t[c]      = d[c] - d[8 + c];
+            t[4 + c]  = d[4 + c] + d[8 + c];
+            t[8 + c]  = d[8 + c] - d[4 + c];
+            t[12 + c] = d[4 + c] - d[12 + c];
+        }
+
+        // V = t B
+        for (int32_t r = 0; r < 4; r++)
+        {
+            const int32_t *tr = &t[4 * r];
+
+            v[(4 * r) * in_tensor_ch + ch]     = (int16_t)(tr[0] - tr[2]);
+            v[(4 * r + 1) * in_tensor_ch + ch] = (int16_t)(tr[1] + tr[2]);
+            v[(4 * r + 2) * in_tensor_ch + ch] = (int16_t)(tr[2] - tr[1]);
+            v[(4 * r + 3) * in_tensor_ch + ch] = (int16_t)(tr[1] - tr[3]);
+        }
+    }
+}
+
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+                                                              const uint16_t in_tensor_dim_x,
+                                                              const uint16_t in_tensor_dim_y,
+                                                              const uint16_t in_tensor_ch,
+                                                              const uint16_t in_tensor_batch,
+                                                              const int16_t * wino_weight,
+                                                              const uint16_t out_tensor_ch,
+                                                              const uint16_t pad_x,
+                                                              const uint16_t pad_y,
+                                                              const int32_t * bias,
+                                                              int8_t * out_tensor,
+                                                              const int32_t * out_shift,
+                                                              const int32_t * out_scale,
+                                                              const int32_t out_offset,    //value is in the range of [-128, 127]
+                                                              const int32_t in_offset,     //value is in the range of [-127, 128]
+                                                              const int32_t act_min,
+                                                              const int32_t act_max,
+                                                              const uint16_t out_tensor_dim_x,
+                                                              const uint16_t out_tensor_dim_y,
+                                                              int16_t * tmp_buf)
+{
+    const int32_t plane = in_tensor_ch * out_tensor_ch;
+    const int32_t tiles_x = (out_tensor_dim_x + 1) >> 1;
+    const int32_t tiles_y = (out_tensor_dim_y + 1) >> 1;
+    const int32_t tile_size = 16 * in_tensor_ch;
+
+    // keeps every transform-domain dot product within int32
+    if (in_tensor_ch > NN_CONV_WINOGRAD_S8_MAX_CH)
+    {
+        return -1;
+    }
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        for (int32_t i_tile_y = 0; i_tile_y < tiles_y; i_tile_y++)
+        {
+            const int32_t out_y = 2 * i_tile_y;
+
+            for (int32_t i_tile_x = 0; i_tile_x < tiles_x; i_tile_x += NN_CONV_WINOGRAD_TILES)
+            {
+                const int32_t tiles = MIN(NN_CONV_WINOGRAD_TILES, tiles_x - i_tile_x);
+
+                for (int32_t t = 0; t < tiles; t++)
+                {
+                    wino_input_transform_s8(in_tensor, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch,
+                                            out_y - pad_y, 2 * (i_tile_x + t) - pad_x, in_offset,
+                                            tmp_buf + t * tile_size);
+                }
+
+                for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+                {
+                    const int16_t *u = wino_weight + i_out_ch * in_tensor_ch;
+                    const int32_t bias_val = (bias != NULL) ? bias[i_out_ch] : 0;
+
+                    for (int32_t t = 0; t < tiles; t++)
+                    {
+                        const int16_t *v = tmp_buf + t * tile_size;
+                        const int32_t out_x = 2 * (i_tile_x + t);
+                        uint32_t m[16];
+                        uint32_t s[8];
+                        int32_t y[4];
+
+                        for (int32_t p = 0; p < 16; p++)
+                        {
+                            const int16_t *up = u + p * plane;
+                            const int16_t *vp = v + p * in_tensor_ch;
+                            int32_t sum = 0;
+
+                            for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+                            {
+                                sum += up[ch] * vp[ch];
+                            }
+                            m[p] = (uint32_t)sum;
+                        }
+
+                        // Y = A^T M A; intermediate sums may wrap, the final
+                        // 4 * conv values do not.
+                        for (int32_t c = 0; c < 4; c++)
+                        {
+                            s[c]     = m[c] + m[4 + c] + m[8 + c];
+                            s[4 + c] = m[4 + c] - m[8 + c] - m[12 + c];
+                        }
+                        y[0] = (int32_t)(s[0] + s[1] + s[2]);
+                        y[1] = (int32_t)(s[1] - s[2] - s[3]);
+                        y[2] = (int32_t)(s[4] + s[5] + s[6]);
+                        y[3] = (int32_t)(s[5] - s[6] - s[7]);
+
+                        for (int32_t i = 0; i < 4; i++)
+                        {
+                            const int32_t oy = out_y + (i >> 1);
+                            const int32_t ox = out_x + (i & 1);
+                            int32_t conv_out;
+
+                            if (oy >= out_tensor_dim_y || ox >= out_tensor_dim_x)
+                            {
+                                continue;
+                            }
+                            conv_out = (y[i] >> 2) + bias_val;
+                            conv_out = riscv_nn_requantize(conv_out, out_scale[i_out_ch], out_shift[i_out_ch]);
+                            conv_out += out_offset;
+                            conv_out = MAX(conv_out, act_min);
+                            conv_out = MIN(conv_out, act_max);
+                            out_tensor[(oy * out_tensor_dim_x + ox) * out_tensor_ch + i_out_ch] = (int8_t)conv_out;
+                        }
+                    }
+                }
+            }
+        }
+        in_tensor += (in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch);
+        out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
+    }
+
+    /* Return to application */
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any_get_buffer_size(const uint16_t in_tensor_ch)
+{
+    return NN_CONV_WINOGRAD_TILES * 16 * in_tensor_ch * sizeof(int16_t);
+}
@@ -21,6 +21,7 @@
 
 #include "internal_nn_math.h"
 #include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
 
 
 
@@ -43,6 +44,19 @@ int32_t riscv_nn_conv_HWC_f16_f16_f16_bias(const float16_t * in_tensor,
     float16_t conv_out;
     long in_row, in_col;
 
+#ifdef ENA_CONV_WINOGRAD_IN_WRAPPER
+    if ((ker_dim == 3) && (stride == 1) && (in_tmp_buf != NULL))
+    {
+        float16_t *wino_weight = in_tmp_buf;
+
+        riscv_nn_conv_HWC_3x3_winograd_f16_weight_transform(ker_weight, in_tensor_ch, out_tensor_ch, wino_weight);
+        return riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias(in_tensor, in_tensor_dim, in_tensor_ch,
+                                                               wino_weight, out_tensor_ch, pad, bias,
+                                                               out_tensor, out_tensor_dim,
+                                                               wino_weight + 36 * in_tensor_ch * out_tensor_ch);
+    }
+#endif
+
     for (i = 0; i < out_tensor_ch; i++)
     {
         for (j = 0; j < out_tensor_dim; j++)
@@ -87,5 +101,12 @@ uint32_t riscv_nn_conv_HWC_f16_f16_f16_bias_get_buffer_size(const uint16_t in_te
     (void) stride;
     (void) out_tensor_dim;
     uint32_t buf_size = 0;
+#ifdef ENA_CONV_WINOGRAD_IN_WRAPPER
+    if ((ker_dim == 3) && (stride == 1))
+    {
+        buf_size = 36 * in_tensor_ch * out_tensor_ch
+                   + riscv_nn_conv_HWC_3x3_winograd_f16_f16_f16_bias_get_buffer_size(in_tensor_ch);
+    }
+#endif
     return buf_size;
 }
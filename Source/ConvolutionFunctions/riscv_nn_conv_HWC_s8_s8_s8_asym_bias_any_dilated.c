@@ -21,45 +21,40 @@
 
 #include "internal_nn_math.h"
 #include "riscv_nn_support.h"
+#include "riscv_nn_util.h"
 
 //// Convolution Functions
-int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(const int8_t * in_tensor,
-                                                         const uint16_t in_tensor_dim_x,
-                                                         const uint16_t in_tensor_dim_y,
-                                                         const uint16_t in_tensor_ch,
-                                                         const uint16_t in_tensor_batch,
-                                                         const int8_t * ker_weight,
-                                                         const uint16_t out_tensor_ch,
-                                                         const uint16_t ker_dim_x,
-                                                         const uint16_t ker_dim_y,
-                                                         const uint16_t ker_ch,
-                                                         const uint16_t pad_x,
-                                                         const uint16_t pad_y,
-                                                         const uint16_t stride_x,
-                                                         const uint16_t stride_y,
-                                                         const int32_t * bias,
-                                                         int8_t * out_tensor,
-                                                         const int32_t * out_shift,
-                                                         const int32_t * out_scale,
-                                                         const int32_t out_offset,    //value is in the range of [-128, 127]
-                                                         const int32_t in_offset,     //value is in the range of [-127, 128]
-                                                         const int32_t act_min,
-                                                         const int32_t act_max,
-                                                         const uint16_t out_tensor_dim_x,
-                                                         const uint16_t out_tensor_dim_y,
-                                                         const int32_t dilation_x,
-                                                         const int32_t dilation_y,
-                                                         int16_t * in_tmp_buf)
-{
-    (void)in_tmp_buf;
-    const int32_t groups = in_tensor_ch / ker_ch;
-    const int32_t out_ch_per_group = out_tensor_ch / groups;
-
-    if (in_tensor_ch % groups != 0 || out_tensor_ch % groups != 0)
-    {
-        return -1;
-    }
 
+// Direct form, used when no temporary buffer is given.
+static void conv_HWC_s8_asym_dilated_direct(const int8_t * in_tensor,
+                                            const uint16_t in_tensor_dim_x,
+                                            const uint16_t in_tensor_dim_y,
+                                            const uint16_t in_tensor_ch,
+                                            const uint16_t in_tensor_batch,
+                                            const int8_t * ker_weight,
+                                            const uint16_t out_tensor_ch,
+                                            const uint16_t ker_dim_x,
+                                            const uint16_t ker_dim_y,
+                                            const uint16_t ker_ch,
+                                            const uint16_t pad_x,
+                                            const uint16_t pad_y,
+                                            const uint16_t stride_x,
+                                            const uint16_t stride_y,
+                                            const int32_t * bias,
+                                            int8_t * out_tensor,
+                                            const int32_t * out_shift,
+                                            const int32_t * out_scale,
+                                            const int32_t out_offset,
+                                            const int32_t in_offset,
+                                            const int32_t act_min,
+                                            const int32_t act_max,
+                                            const uint16_t out_tensor_dim_x,
+                                            const uint16_t out_tensor_dim_y,
+                                            const int32_t dilation_x,
+                                            const int32_t dilation_y,
+                                            const int32_t groups,
+                                            const int32_t out_ch_per_group)
+{
     for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
     {
         for (int32_t i_group = 0; i_group < groups; i_group++)
@@ -118,6 +113,159 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(const int8_t * in_tenso
         out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
     }
 
+}
+
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(const int8_t * in_tensor,
+                                                         const uint16_t in_tensor_dim_x,
+                                                         const uint16_t in_tensor_dim_y,
+                                                         const uint16_t in_tensor_ch,
+                                                         const uint16_t in_tensor_batch,
+                                                         const int8_t * ker_weight,
+                                                         const uint16_t out_tensor_ch,
+                                                         const uint16_t ker_dim_x,
+                                                         const uint16_t ker_dim_y,
+                                                         const uint16_t ker_ch,
+                                                         const uint16_t pad_x,
+                                                         const uint16_t pad_y,
+                                                         const uint16_t stride_x,
+                                                         const uint16_t stride_y,
+                                                         const int32_t * bias,
+                                                         int8_t * out_tensor,
+                                                         const int32_t * out_shift,
+                                                         const int32_t * out_scale,
+                                                         const int32_t out_offset,    //value is in the range of [-128, 127]
+                                                         const int32_t in_offset,     //value is in the range of [-127, 128]
+                                                         const int32_t act_min,
+                                                         const int32_t act_max,
+                                                         const uint16_t out_tensor_dim_x,
+                                                         const uint16_t out_tensor_dim_y,
+                                                         const int32_t dilation_x,
+                                                         const int32_t dilation_y,
+                                                         int16_t * in_tmp_buf)
+{
+    const int32_t groups = in_tensor_ch / ker_ch;
+    const int32_t out_ch_per_group = out_tensor_ch / groups;
+
+    if (in_tensor_ch % groups != 0 || out_tensor_ch % groups != 0)
+    {
+        return -1;
+    }
+
+    if (in_tmp_buf == NULL)
+    {
+        conv_HWC_s8_asym_dilated_direct(in_tensor, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch,
+                                        in_tensor_batch, ker_weight, out_tensor_ch, ker_dim_x, ker_dim_y,
+                                        ker_ch, pad_x, pad_y, stride_x, stride_y, bias, out_tensor,
+                                        out_shift, out_scale, out_offset, in_offset, act_min, act_max,
+                                        out_tensor_dim_x, out_tensor_dim_y, dilation_x, dilation_y,
+                                        groups, out_ch_per_group);
+        return 0;
+    }
+
+    // in_tmp_buf holds bias + in_offset * sum(weights) for every output
+    // channel, followed by NN_CONV_IM2COL_PIXELS gathered columns. With the
+    // padding filled by -in_offset, the offset term is the same for every
+    // pixel, so the matmul never needs to sum the weights again.
+    const int32_t col_size = ker_dim_x * ker_dim_y * ker_ch;
+    const int32_t out_pixels = out_tensor_dim_x * out_tensor_dim_y;
+    const int8_t pad_val = (int8_t)(-in_offset);
+    int32_t *contri_buf = (int32_t *)in_tmp_buf;
+    int8_t *col_buf = (int8_t *)(contri_buf + out_tensor_ch);
+
+    riscv_nn_kernel_sum_s8(ker_weight, bias, out_tensor_ch, col_size, in_offset, contri_buf);
+
+    // a 1x1 kernel without padding reads the channels of its group as they
+    // are, so the matmul takes them in place with the pixel distance as the
+    // row stride: one output row at a time, or the whole image at once when
+    // its pixels are contiguous
+    if ((ker_dim_x == 1) && (ker_dim_y == 1) && (pad_x == 0) && (pad_y == 0))
+    {
+        const int32_t whole = (stride_x == 1) && (stride_y == 1) && (out_tensor_dim_x == in_tensor_dim_x);
+        const int32_t num_rows = whole ? 1 : out_tensor_dim_y;
+        const int32_t row_pixels = whole ? out_pixels : out_tensor_dim_x;
+
+        for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+        {
+            for (int32_t i_row = 0; i_row < num_rows; i_row++)
+            {
+                const int8_t *in_row = in_tensor + i_row * stride_y * in_tensor_dim_x * in_tensor_ch;
+                int8_t *out_row = out_tensor + i_row * out_tensor_dim_x * out_tensor_ch;
+
+                for (int32_t i_group = 0; i_group < groups; i_group++)
+                {
+                    const int32_t out_ch_base = i_group * out_ch_per_group;
+
+                    riscv_nn_mat_mult_nt_t_s8_core(in_row + i_group * ker_ch,
+                                                   ker_weight + out_ch_base * ker_ch,
+                                                   NULL,
+                                                   out_row + out_ch_base,
+                                                   out_scale + out_ch_base,
+                                                   out_shift + out_ch_base,
+                                                   row_pixels,
+                                                   out_ch_per_group,
+                                                   ker_ch,
+                                                   in_offset,
+                                                   out_offset,
+                                                   act_min,
+                                                   act_max,
+                                                   stride_x * in_tensor_ch,
+                                                   out_tensor_ch,
+                                                   contri_buf + out_ch_base,
+                                                   0);
+                }
+            }
+            in_tensor += (in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch);
+            out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
+        }
+        return 0;
+    }
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        for (int32_t i_pixel = 0; i_pixel < out_pixels; i_pixel += NN_CONV_IM2COL_PIXELS)
+        {
+            const int32_t pixels = MIN(NN_CONV_IM2COL_PIXELS, out_pixels - i_pixel);
+
+            for (int32_t i_group = 0; i_group < groups; i_group++)
+            {
+                const int32_t out_ch_base = i_group * out_ch_per_group;
+                int8_t *col = col_buf;
+
+                for (int32_t i = i_pixel; i < i_pixel + pixels; i++)
+                {
+                    const int32_t i_out_y = i / out_tensor_dim_x;
+                    const int32_t i_out_x = i - i_out_y * out_tensor_dim_x;
+
+                    riscv_nn_im2col_HWC_s8(in_tensor + i_group * ker_ch, in_tensor_dim_x, in_tensor_dim_y,
+                                           in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch,
+                                           stride_x * i_out_x - pad_x, stride_y * i_out_y - pad_y,
+                                           dilation_x, dilation_y, pad_val, col);
+                    col += col_size;
+                }
+
+                riscv_nn_mat_mult_nt_t_s8_core(col_buf,
+                                               ker_weight + out_ch_base * col_size,
+                                               NULL,
+                                               out_tensor + i_pixel * out_tensor_ch + out_ch_base,
+                                               out_scale + out_ch_base,
+                                               out_shift + out_ch_base,
+                                               pixels,
+                                               out_ch_per_group,
+                                               col_size,
+                                               in_offset,
+                                               out_offset,
+                                               act_min,
+                                               act_max,
+                                               col_size,
+                                               out_tensor_ch,
+                                               contri_buf + out_ch_base,
+                                               0);
+            }
+        }
+        in_tensor += (in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch);
+        out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
+    }
+
     /* Return to application */
     return 0;
 }
@@ -127,9 +275,5 @@ int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size(const u
                                                                          const uint16_t ker_dim_y,
                                                                          const uint16_t out_tensor_ch)
 {
-    (void)ker_ch;
-    (void)ker_dim_x;
-    (void)ker_dim_y;
-    (void)out_tensor_ch;
-    return 0;
+    return out_tensor_ch * sizeof(int32_t) + NN_CONV_IM2COL_PIXELS * ker_ch * ker_dim_x * ker_dim_y;
 }
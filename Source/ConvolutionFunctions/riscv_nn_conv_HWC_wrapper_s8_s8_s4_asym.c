@@ -58,7 +58,7 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym(const int8_t * in_tensor,
         && (dilation_x == 1)
         && (dilation_y == 1))
     {
-        return riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any(in_tensor,
+        return riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any(in_tensor,
                     in_tensor_dim_x,
                     in_tensor_dim_y,
                     in_tensor_ch,
@@ -161,7 +161,12 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_get_buffer_size(const int32_t in
         && (dilation_x == 1)
         && (dilation_y == 1))
     {
-        return riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(in_tensor_ch, out_tensor_ch);
+        return riscv_nn_conv_1x1_HWC_s8_s8_s4_asym_bias_fast_any_get_buffer_size(in_tensor_ch,
+                                                                                 out_tensor_ch,
+                                                                                 stride_x,
+                                                                                 stride_y,
+                                                                                 out_tensor_dim_x,
+                                                                                 out_tensor_dim_y);
     }
     else if ((out_tensor_dim_y == 1)
         && (in_tensor_dim_y == 1)
@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_convolution.h"
+
+// The s4 weights are unpacked to 8 bits and laid out exactly like the blob of
+// riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack, so that the packed s8 kernels
+// can be used as they are.
+#define PACKED_SUM_OFFSET(size) (((size) + 3) & ~3)
+
+// the idx-th 4-bit weight; the even ones are in the low nibbles
+__STATIC_FORCEINLINE int8_t get_s4(const int8_t *ker_weight, const int32_t idx)
+{
+    const int8_t packed = ker_weight[idx >> 1];
+
+    return (idx & 1) ? (int8_t)(packed >> 4) : (int8_t)((int8_t)(packed << 4) >> 4);
+}
+
+//// Convolution Functions
+int32_t riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack_get_size(const int32_t in_tensor_ch,
+                                                             const int32_t out_tensor_ch,
+                                                             const int32_t ker_dim_x,
+                                                             const int32_t ker_dim_y)
+{
+    return riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack_get_size(out_tensor_ch, ker_dim_x, ker_dim_y, in_tensor_ch);
+}
+
+int32_t riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack(const int8_t * ker_weight,
+                                                    const int32_t in_tensor_ch,
+                                                    const int32_t out_tensor_ch,
+                                                    const int32_t ker_dim_x,
+                                                    const int32_t ker_dim_y,
+                                                    int8_t * packed_weight)
+{
+    const int32_t ker_size = ker_dim_x * ker_dim_y * in_tensor_ch;
+    int32_t *ker_sum = (int32_t *)(packed_weight + PACKED_SUM_OFFSET(out_tensor_ch * ker_size));
+    int8_t *dst = packed_weight;
+    int32_t i_out_ch;
+
+    for (i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+    {
+        ker_sum[i_out_ch] = 0;
+    }
+
+    // groups of 4 output channels interleaved column by column
+    for (i_out_ch = 0; (i_out_ch + 4) <= out_tensor_ch; i_out_ch += 4)
+    {
+        for (int32_t k = 0; k < ker_size; k++)
+        {
+            for (int32_t j = 0; j < 4; j++)
+            {
+                const int8_t val = get_s4(ker_weight, (i_out_ch + j) * ker_size + k);
+
+                *dst++ = val;
+                ker_sum[i_out_ch + j] += val;
+            }
+        }
+    }
+
+    // left-over output channels in row order
+    for (; i_out_ch < out_tensor_ch; i_out_ch++)
+    {
+        for (int32_t k = 0; k < ker_size; k++)
+        {
+            const int8_t val = get_s4(ker_weight, i_out_ch * ker_size + k);
+
+            *dst++ = val;
+            ker_sum[i_out_ch] += val;
+        }
+    }
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed(const int8_t * in_tensor,
+                                                       const int32_t in_tensor_dim_x,
+                                                       const int32_t in_tensor_dim_y,
+                                                       const int32_t in_tensor_ch,
+                                                       const int32_t in_tensor_batch,
+                                                       const int8_t * packed_weight,
+                                                       const int32_t out_tensor_ch,
+                                                       const int32_t ker_dim_x,
+                                                       const int32_t ker_dim_y,
+                                                       const int32_t pad_x,
+                                                       const int32_t pad_y,
+                                                       const int32_t stride_x,
+                                                       const int32_t stride_y,
+                                                       const int32_t * bias,
+                                                       int8_t * out_tensor,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const int32_t out_offset,    //value is in the range of [-128, 127]
+                                                       const int32_t in_offset,     //value is in the range of [-127, 128]
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const int32_t out_tensor_dim_x,
+                                                       const int32_t out_tensor_dim_y,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y,
+                                                       int8_t * in_tmp_buf)
+{
+    return riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed(in_tensor,
+                in_tensor_dim_x,
+                in_tensor_dim_y,
+                in_tensor_ch,
+                in_tensor_batch,
+                packed_weight,
+                out_tensor_ch,
+                ker_dim_x,
+                ker_dim_y,
+                in_tensor_ch,
+                pad_x,
+                pad_y,
+                stride_x,
+                stride_y,
+                bias,
+                out_tensor,
+                out_shift,
+                out_scale,
+                out_offset,
+                in_offset,
+                act_min,
+                act_max,
+                out_tensor_dim_x,
+                out_tensor_dim_y,
+                dilation_x,
+                dilation_y,
+                (int16_t *)in_tmp_buf);
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed_get_buffer_size(const int32_t in_tensor_ch,
+                                                                       const int32_t out_tensor_ch,
+                                                                       const int32_t ker_dim_x,
+                                                                       const int32_t ker_dim_y)
+{
+    return riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed_get_buffer_size(out_tensor_ch, ker_dim_x, ker_dim_y,
+                                                                          in_tensor_ch);
+}
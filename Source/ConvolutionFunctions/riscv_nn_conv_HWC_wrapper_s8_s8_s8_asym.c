@@ -22,6 +22,12 @@
 #include "internal_nn_math.h"
 #include "riscv_nn_convolution.h"
 
+#ifdef ENA_CONV_WINOGRAD_IN_WRAPPER
+#define WINOGRAD_APPLICABLE(in_ch, ker_ch, ker_x, ker_y, s_x, s_y, d_x, d_y) \
+    ((ker_x) == 3 && (ker_y) == 3 && (s_x) == 1 && (s_y) == 1 && (d_x) == 1 && (d_y) == 1 \
+     && (in_ch) == (ker_ch) && (in_ch) <= NN_CONV_WINOGRAD_S8_MAX_CH)
+#endif
+
 //// Convolution Functions
 
 int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(const int8_t * in_tensor,
@@ -109,6 +115,35 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(const int8_t * in_tensor,
                     out_tensor_dim_x,
                     in_tmp_buf);
     }
+#ifdef ENA_CONV_WINOGRAD_IN_WRAPPER
+    else if (WINOGRAD_APPLICABLE(in_tensor_ch, ker_ch, ker_dim_x, ker_dim_y, stride_x, stride_y,
+                                 dilation_x, dilation_y) && (in_tmp_buf != NULL))
+    {
+        int16_t *wino_weight = in_tmp_buf;
+
+        riscv_nn_conv_HWC_3x3_winograd_s8_weight_transform(ker_weight, in_tensor_ch, out_tensor_ch, wino_weight);
+        return riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any(in_tensor,
+                    in_tensor_dim_x,
+                    in_tensor_dim_y,
+                    in_tensor_ch,
+                    in_tensor_batch,
+                    wino_weight,
+                    out_tensor_ch,
+                    pad_x,
+                    pad_y,
+                    bias,
+                    out_tensor,
+                    out_shift,
+                    out_scale,
+                    out_offset,
+                    in_offset,
+                    act_min,
+                    act_max,
+                    out_tensor_dim_x,
+                    out_tensor_dim_y,
+                    wino_weight + 16 * in_tensor_ch * out_tensor_ch);
+    }
+#endif
     else
     {
         return riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(in_tensor,
@@ -191,6 +226,14 @@ int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(const uint16_t i
                     stride_x,
                     out_tensor_dim_x);
     }
+#ifdef ENA_CONV_WINOGRAD_IN_WRAPPER
+    else if (WINOGRAD_APPLICABLE(in_tensor_ch, ker_ch, ker_dim_x, ker_dim_y, stride_x, stride_y,
+                                 dilation_x, dilation_y))
+    {
+        return 16 * in_tensor_ch * out_tensor_ch * sizeof(int16_t)
+               + riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any_get_buffer_size(in_tensor_ch);
+    }
+#endif
     else
     {
         return riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size(ker_ch,
@@ -0,0 +1,183 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+
+//// Convolution Functions
+
+// 1x1 layers at stride 1 without padding read their input pixels in place
+static int32_t conv_add_is_direct(const uint16_t in_tensor_ch,
+                                  const uint16_t ker_dim_x,
+                                  const uint16_t ker_dim_y,
+                                  const uint16_t ker_ch,
+                                  const uint16_t pad_x,
+                                  const uint16_t pad_y,
+                                  const uint16_t stride_x,
+                                  const uint16_t stride_y)
+{
+    return (ker_dim_x == 1) && (ker_dim_y == 1) && (pad_x == 0) && (pad_y == 0)
+           && (stride_x == 1) && (stride_y == 1) && (ker_ch == in_tensor_ch);
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add(const int8_t * in_tensor,
+                                                    const uint16_t in_tensor_dim_x,
+                                                    const uint16_t in_tensor_dim_y,
+                                                    const uint16_t in_tensor_ch,
+                                                    const uint16_t in_tensor_batch,
+                                                    const int8_t * ker_weight,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    const uint16_t pad_x,
+                                                    const uint16_t pad_y,
+                                                    const uint16_t stride_x,
+                                                    const uint16_t stride_y,
+                                                    const int32_t * bias,
+                                                    int8_t * out_tensor,
+                                                    const int32_t * out_shift,
+                                                    const int32_t * out_scale,
+                                                    const int32_t out_offset,
+                                                    const int32_t in_offset,
+                                                    const int32_t act_min,
+                                                    const int32_t act_max,
+                                                    const uint16_t out_tensor_dim_x,
+                                                    const uint16_t out_tensor_dim_y,
+                                                    const int32_t dilation_x,
+                                                    const int32_t dilation_y,
+                                                    const riscv_nn_residual_add_params * residual,
+                                                    int16_t * in_tmp_buf)
+{
+    const int32_t groups = in_tensor_ch / ker_ch;
+    const int32_t out_ch_per_group = out_tensor_ch / groups;
+    const int32_t col_size = ker_dim_x * ker_dim_y * ker_ch;
+    const int32_t row_size = out_tensor_dim_x * out_tensor_ch;
+    int8_t *col_buf = (int8_t *)in_tmp_buf;
+
+    if (residual == NULL)
+    {
+        return riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(in_tensor, in_tensor_dim_x, in_tensor_dim_y,
+                    in_tensor_ch, in_tensor_batch, ker_weight, out_tensor_ch, ker_dim_x, ker_dim_y,
+                    ker_ch, pad_x, pad_y, stride_x, stride_y, bias, out_tensor, out_shift, out_scale,
+                    out_offset, in_offset, act_min, act_max, out_tensor_dim_x, out_tensor_dim_y,
+                    dilation_x, dilation_y, in_tmp_buf);
+    }
+
+    if (in_tensor_ch % ker_ch != 0 || out_tensor_ch % groups != 0)
+    {
+        return -1;
+    }
+
+    // The residual is added in the requantization of the matrix
+    // multiplication, so the sums are stored to out_tensor once.
+    if (conv_add_is_direct(in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y))
+    {
+        // the input pixels are the rows of the lhs matrix already
+        const int32_t out_pixels = out_tensor_dim_x * out_tensor_dim_y * in_tensor_batch;
+
+        return riscv_nn_mat_mult_nt_t_s8_add(in_tensor, ker_weight, bias, out_tensor, out_scale, out_shift,
+                    out_pixels, out_tensor_ch, col_size, in_offset, out_offset, act_min, act_max,
+                    col_size, out_tensor_ch, residual, residual->in_tensor);
+    }
+
+    if (in_tmp_buf == NULL)
+    {
+        return -1;
+    }
+
+    // one output row of every group at a time is gathered into in_tmp_buf
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        const int8_t *in_batch = in_tensor + i_batch * in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch;
+        const int32_t out_batch = i_batch * out_tensor_dim_y * row_size;
+
+        for (int32_t i_out_y = 0; i_out_y < out_tensor_dim_y; i_out_y++)
+        {
+            const int32_t out_row = out_batch + i_out_y * row_size;
+
+            for (int32_t i_group = 0; i_group < groups; i_group++)
+            {
+                const int32_t out_ch_base = i_group * out_ch_per_group;
+                int8_t *col = col_buf;
+
+                for (int32_t i_out_x = 0; i_out_x < out_tensor_dim_x; i_out_x++)
+                {
+                    riscv_nn_im2col_HWC_s8(in_batch + i_group * ker_ch, in_tensor_dim_x, in_tensor_dim_y,
+                                           in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch,
+                                           stride_x * i_out_x - pad_x, stride_y * i_out_y - pad_y,
+                                           dilation_x, dilation_y, (int8_t)(-in_offset), col);
+                    col += col_size;
+                }
+
+                riscv_nn_mat_mult_nt_t_s8_add(col_buf,
+                                              ker_weight + out_ch_base * col_size,
+                                              (bias != NULL) ? bias + out_ch_base : NULL,
+                                              out_tensor + out_row + out_ch_base,
+                                              out_scale + out_ch_base,
+                                              out_shift + out_ch_base,
+                                              out_tensor_dim_x,
+                                              out_ch_per_group,
+                                              col_size,
+                                              in_offset,
+                                              out_offset,
+                                              act_min,
+                                              act_max,
+                                              col_size,
+                                              out_tensor_ch,
+                                              residual,
+                                              residual->in_tensor + out_row + out_ch_base);
+            }
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                    const uint16_t in_tensor_dim_y,
+                                                                    const uint16_t in_tensor_ch,
+                                                                    const uint16_t in_tensor_batch,
+                                                                    const uint16_t ker_dim_x,
+                                                                    const uint16_t ker_dim_y,
+                                                                    const uint16_t ker_ch,
+                                                                    const uint16_t pad_x,
+                                                                    const uint16_t pad_y,
+                                                                    const uint16_t stride_x,
+                                                                    const uint16_t stride_y,
+                                                                    const uint16_t out_tensor_dim_x,
+                                                                    const uint16_t out_tensor_dim_y,
+                                                                    const uint16_t out_tensor_ch,
+                                                                    const int32_t dilation_x,
+                                                                    const int32_t dilation_y)
+{
+    // the convolution alone (residual NULL) runs with the same buffer
+    const int32_t conv_size = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_dim_x,
+                in_tensor_dim_y, in_tensor_ch, in_tensor_batch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y,
+                stride_x, stride_y, out_tensor_dim_x, out_tensor_dim_y, out_tensor_ch, dilation_x, dilation_y);
+    int32_t col_size = 0;
+
+    if (!conv_add_is_direct(in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y))
+    {
+        col_size = out_tensor_dim_x * ker_dim_x * ker_dim_y * ker_ch;
+    }
+    return MAX(conv_size, col_size);
+}
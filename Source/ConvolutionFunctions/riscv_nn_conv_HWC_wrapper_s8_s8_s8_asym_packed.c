@@ -0,0 +1,183 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_util.h"
+
+// The packed blob holds the weights of every group reordered by
+// riscv_nn_mat_mult_nt_t_s8_pack_rhs, followed (at a 4-byte aligned offset)
+// by the int32 sum of the weights of every output channel.
+#define PACKED_SUM_OFFSET(size) (((size) + 3) & ~3)
+
+//// Convolution Functions
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack_get_size(const uint16_t out_tensor_ch,
+                                                             const uint16_t ker_dim_x,
+                                                             const uint16_t ker_dim_y,
+                                                             const uint16_t ker_ch)
+{
+    const int32_t ker_size = ker_dim_x * ker_dim_y * ker_ch;
+
+    return PACKED_SUM_OFFSET(out_tensor_ch * ker_size) + out_tensor_ch * sizeof(int32_t);
+}
+
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack(const int8_t * ker_weight,
+                                                    const uint16_t in_tensor_ch,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    int8_t * packed_weight)
+{
+    const int32_t ker_size = ker_dim_x * ker_dim_y * ker_ch;
+    const int32_t groups = in_tensor_ch / ker_ch;
+    int32_t *ker_sum = (int32_t *)(packed_weight + PACKED_SUM_OFFSET(out_tensor_ch * ker_size));
+
+    if (in_tensor_ch % ker_ch != 0 || out_tensor_ch % groups != 0)
+    {
+        return -1;
+    }
+
+    const int32_t out_ch_per_group = out_tensor_ch / groups;
+
+    for (int32_t i_group = 0; i_group < groups; i_group++)
+    {
+        const int32_t offset = i_group * out_ch_per_group * ker_size;
+
+        riscv_nn_mat_mult_nt_t_s8_pack_rhs(ker_weight + offset, out_ch_per_group, ker_size,
+                                           packed_weight + offset);
+    }
+    riscv_nn_kernel_sum_s8(ker_weight, NULL, out_tensor_ch, ker_size, 1, ker_sum);
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed(const int8_t * in_tensor,
+                                                       const uint16_t in_tensor_dim_x,
+                                                       const uint16_t in_tensor_dim_y,
+                                                       const uint16_t in_tensor_ch,
+                                                       const uint16_t in_tensor_batch,
+                                                       const int8_t * packed_weight,
+                                                       const uint16_t out_tensor_ch,
+                                                       const uint16_t ker_dim_x,
+                                                       const uint16_t ker_dim_y,
+                                                       const uint16_t ker_ch,
+                                                       const uint16_t pad_x,
+                                                       const uint16_t pad_y,
+                                                       const uint16_t stride_x,
+                                                       const uint16_t stride_y,
+                                                       const int32_t * bias,
+                                                       int8_t * out_tensor,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const int32_t out_offset,    //value is in the range of [-128, 127]
+                                                       const int32_t in_offset,     //value is in the range of [-127, 128]
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const uint16_t out_tensor_dim_x,
+                                                       const uint16_t out_tensor_dim_y,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y,
+                                                       int16_t * in_tmp_buf)
+{
+    const int32_t groups = in_tensor_ch / ker_ch;
+    const int32_t out_ch_per_group = out_tensor_ch / groups;
+    const int32_t col_size = ker_dim_x * ker_dim_y * ker_ch;
+    const int32_t out_pixels = out_tensor_dim_x * out_tensor_dim_y;
+    const int32_t *ker_sum = (const int32_t *)(packed_weight + PACKED_SUM_OFFSET(out_tensor_ch * col_size));
+    int32_t *contri_buf = (int32_t *)in_tmp_buf;
+    int8_t *col_buf = (int8_t *)(contri_buf + out_tensor_ch);
+
+    if (in_tensor_ch % ker_ch != 0 || out_tensor_ch % groups != 0)
+    {
+        return -1;
+    }
+
+    for (int32_t i = 0; i < out_tensor_ch; i++)
+    {
+        contri_buf[i] = ker_sum[i] * in_offset + ((bias != NULL) ? bias[i] : 0);
+    }
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        if ((ker_dim_x == 1) && (ker_dim_y == 1) && (pad_x == 0) && (pad_y == 0)
+            && (stride_x == 1) && (stride_y == 1) && (groups == 1))
+        {
+            // the input pixels are the rows of the lhs matrix already
+            riscv_nn_mat_mult_nt_t_s8_packed(in_tensor, packed_weight, contri_buf, out_tensor,
+                                             out_scale, out_shift, out_pixels, out_tensor_ch, col_size,
+                                             out_offset, act_min, act_max, col_size, out_tensor_ch);
+        }
+        else
+        {
+            for (int32_t i_pixel = 0; i_pixel < out_pixels; i_pixel += NN_CONV_IM2COL_PIXELS)
+            {
+                const int32_t pixels = MIN(NN_CONV_IM2COL_PIXELS, out_pixels - i_pixel);
+
+                for (int32_t i_group = 0; i_group < groups; i_group++)
+                {
+                    const int32_t out_ch_base = i_group * out_ch_per_group;
+                    int8_t *col = col_buf;
+
+                    for (int32_t i = i_pixel; i < i_pixel + pixels; i++)
+                    {
+                        const int32_t i_out_y = i / out_tensor_dim_x;
+                        const int32_t i_out_x = i - i_out_y * out_tensor_dim_x;
+
+                        riscv_nn_im2col_HWC_s8(in_tensor + i_group * ker_ch, in_tensor_dim_x, in_tensor_dim_y,
+                                               in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch,
+                                               stride_x * i_out_x - pad_x, stride_y * i_out_y - pad_y,
+                                               dilation_x, dilation_y, (int8_t)(-in_offset), col);
+                        col += col_size;
+                    }
+
+                    riscv_nn_mat_mult_nt_t_s8_packed(col_buf,
+                                                     packed_weight + out_ch_base * col_size,
+                                                     contri_buf + out_ch_base,
+                                                     out_tensor + i_pixel * out_tensor_ch + out_ch_base,
+                                                     out_scale + out_ch_base,
+                                                     out_shift + out_ch_base,
+                                                     pixels,
+                                                     out_ch_per_group,
+                                                     col_size,
+                                                     out_offset,
+                                                     act_min,
+                                                     act_max,
+                                                     col_size,
+                                                     out_tensor_ch);
+                }
+            }
+        }
+        in_tensor += (in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch);
+        out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
+    }
+
+    /* Return to application */
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed_get_buffer_size(const uint16_t out_tensor_ch,
+                                                                       const uint16_t ker_dim_x,
+                                                                       const uint16_t ker_dim_y,
+                                                                       const uint16_t ker_ch)
+{
+    return out_tensor_ch * sizeof(int32_t) + NN_CONV_IM2COL_PIXELS * ker_dim_x * ker_dim_y * ker_ch;
+}
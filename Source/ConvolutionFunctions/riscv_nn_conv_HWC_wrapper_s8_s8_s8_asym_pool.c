@@ -0,0 +1,163 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_pooling.h"
+
+//// Convolution Functions
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool(const int8_t * in_tensor,
+                                                     const uint16_t in_tensor_dim_x,
+                                                     const uint16_t in_tensor_dim_y,
+                                                     const uint16_t in_tensor_ch,
+                                                     const uint16_t in_tensor_batch,
+                                                     const int8_t * ker_weight,
+                                                     const uint16_t out_tensor_ch,
+                                                     const uint16_t ker_dim_x,
+                                                     const uint16_t ker_dim_y,
+                                                     const uint16_t ker_ch,
+                                                     const uint16_t pad_x,
+                                                     const uint16_t pad_y,
+                                                     const uint16_t stride_x,
+                                                     const uint16_t stride_y,
+                                                     const int32_t * bias,
+                                                     int8_t * out_tensor,
+                                                     const int32_t * out_shift,
+                                                     const int32_t * out_scale,
+                                                     const int32_t out_offset,
+                                                     const int32_t in_offset,
+                                                     const int32_t act_min,
+                                                     const int32_t act_max,
+                                                     const uint16_t out_tensor_dim_x,
+                                                     const uint16_t out_tensor_dim_y,
+                                                     const int32_t dilation_x,
+                                                     const int32_t dilation_y,
+                                                     const riscv_nn_pool_params * pool,
+                                                     int16_t * in_tmp_buf)
+{
+    const int32_t row_size = out_tensor_dim_x * out_tensor_ch;
+    const int32_t pool_row_size = pool->out_tensor_dim_x * out_tensor_ch;
+    int8_t *rows_buf;
+
+    // the slicing needs every convolution row to read at least one input row
+    if ((in_tmp_buf == NULL) || (stride_y * (out_tensor_dim_y - 1) - pad_y >= in_tensor_dim_y)
+        || (pool->stride_y <= 0))
+    {
+        return -1;
+    }
+
+    // in_tmp_buf holds the scratch of the convolution, then the convolution
+    // rows of the current pooling window: rows [held_start, held_end) of the
+    // convolution output, at most pool->ker_dim_y of them
+    rows_buf = (int8_t *)in_tmp_buf + riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(in_tensor_dim_x,
+                in_tensor_dim_y, in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x,
+                stride_y, out_tensor_dim_x, out_tensor_dim_y, out_tensor_ch, dilation_x, dilation_y);
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        const int8_t *in_batch = in_tensor + i_batch * in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch;
+        int8_t *out_batch = out_tensor + i_batch * pool->out_tensor_dim_y * pool_row_size;
+        int32_t held_start = 0;
+        int32_t held_end = 0;
+
+        for (int32_t i_pool_y = 0; i_pool_y < pool->out_tensor_dim_y; i_pool_y++)
+        {
+            const int32_t base_y = i_pool_y * pool->stride_y - pool->pad_y;
+            const int32_t row_start = MIN(MAX(base_y, 0), out_tensor_dim_y);
+            const int32_t row_end = MAX(MIN(base_y + pool->ker_dim_y, out_tensor_dim_y), row_start);
+
+            // drop the rows above the window and keep the ones it shares
+            // with the previous window
+            if (row_start >= held_end)
+            {
+                held_start = row_start;
+                held_end = row_start;
+            }
+            else if (row_start > held_start)
+            {
+                memmove(rows_buf, rows_buf + (row_start - held_start) * row_size,
+                        (held_end - row_start) * row_size);
+                held_start = row_start;
+            }
+
+            if (row_end > held_end)
+            {
+                if (riscv_nn_conv_HWC_s8_asym_rows(in_batch, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch,
+                            ker_weight, out_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y,
+                            stride_x, stride_y, bias, rows_buf + (held_end - held_start) * row_size,
+                            out_shift, out_scale, out_offset, in_offset, act_min, act_max,
+                            out_tensor_dim_x, held_end, row_end, dilation_x, dilation_y, in_tmp_buf) != 0)
+                {
+                    return -1;
+                }
+                held_end = row_end;
+            }
+
+            // pool the held rows as an input of (row_end - row_start) rows
+            // whose top padding is what the window has above row_start
+            if (pool->type == NN_POOL_MAX)
+            {
+                riscv_nn_maxpool_HWC_s8_any_act(1, row_end - row_start, out_tensor_dim_x, 1,
+                                                pool->out_tensor_dim_x, pool->stride_y, pool->stride_x,
+                                                pool->ker_dim_y, pool->ker_dim_x, row_start - base_y,
+                                                pool->pad_x, pool->act_min, pool->act_max, out_tensor_ch,
+                                                rows_buf, NULL, out_batch + i_pool_y * pool_row_size);
+            }
+            else
+            {
+                riscv_nn_avepool_HWC_s8_any_act(1, row_end - row_start, out_tensor_dim_x, 1,
+                                                pool->out_tensor_dim_x, pool->stride_y, pool->stride_x,
+                                                pool->ker_dim_y, pool->ker_dim_x, row_start - base_y,
+                                                pool->pad_x, pool->act_min, pool->act_max, out_tensor_ch,
+                                                rows_buf, NULL, out_batch + i_pool_y * pool_row_size);
+            }
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                     const uint16_t in_tensor_dim_y,
+                                                                     const uint16_t in_tensor_ch,
+                                                                     const uint16_t in_tensor_batch,
+                                                                     const uint16_t ker_dim_x,
+                                                                     const uint16_t ker_dim_y,
+                                                                     const uint16_t ker_ch,
+                                                                     const uint16_t pad_x,
+                                                                     const uint16_t pad_y,
+                                                                     const uint16_t stride_x,
+                                                                     const uint16_t stride_y,
+                                                                     const uint16_t out_tensor_dim_x,
+                                                                     const uint16_t out_tensor_dim_y,
+                                                                     const uint16_t out_tensor_ch,
+                                                                     const int32_t dilation_x,
+                                                                     const int32_t dilation_y,
+                                                                     const riscv_nn_pool_params * pool)
+{
+    (void)in_tensor_batch;
+
+    return riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch,
+                ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y, out_tensor_dim_x,
+                out_tensor_dim_y, out_tensor_ch, dilation_x, dilation_y)
+           + MIN(pool->ker_dim_y, out_tensor_dim_y) * out_tensor_dim_x * out_tensor_ch;
+}
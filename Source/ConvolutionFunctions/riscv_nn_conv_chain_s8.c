@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+
+//// Convolution Functions
+
+// Rows [*in_start, *in_end) of the layer input that output rows
+// [row_start, row_end) read.
+static void conv_chain_in_rows(const riscv_nn_conv_layer * l,
+                               const int32_t row_start,
+                               const int32_t row_end,
+                               int32_t * in_start,
+                               int32_t * in_end)
+{
+    const int32_t window = l->dilation_y * (l->ker_dim_y - 1) + 1;
+
+    *in_start = MAX(row_start * l->stride_y - l->pad_y, 0);
+    *in_end = MIN((row_end - 1) * l->stride_y - l->pad_y + window, l->in_dim_y);
+}
+
+// Output rows of layer idx needed for rows [row_start, row_end) of the last
+// layer, i.e. the tile with its halo at that depth.
+static void conv_chain_band(const riscv_nn_conv_layer * layers,
+                            const int32_t num_layers,
+                            const int32_t idx,
+                            const int32_t row_start,
+                            const int32_t row_end,
+                            int32_t * band_start,
+                            int32_t * band_end)
+{
+    int32_t i;
+
+    *band_start = row_start;
+    *band_end = row_end;
+    for (i = num_layers - 1; i > idx; i--)
+    {
+        conv_chain_in_rows(&layers[i], *band_start, *band_end, band_start, band_end);
+    }
+}
+
+static int32_t conv_chain_check(const riscv_nn_conv_layer * layers,
+                                const int32_t num_layers,
+                                const int32_t tile_rows)
+{
+    int32_t i;
+
+    if ((layers == NULL) || (num_layers <= 0) || (tile_rows <= 0))
+    {
+        return -1;
+    }
+    for (i = 0; i < num_layers; i++)
+    {
+        const riscv_nn_conv_layer *l = &layers[i];
+
+        // every output row has to read at least one input row so that any
+        // band of it can run as a layer of its own
+        if ((l->stride_y <= 0) || (l->dilation_y <= 0) || (l->out_dim_y <= 0)
+            || (l->stride_y * (l->out_dim_y - 1) - l->pad_y >= l->in_dim_y)
+            || ((l->type == NN_CONV_DEPTHWISE) && (l->ch_mult <= 0)))
+        {
+            return -1;
+        }
+        if ((i > 0) && ((l->in_dim_x != layers[i - 1].out_dim_x) || (l->in_dim_y != layers[i - 1].out_dim_y)
+            || (l->in_ch != layers[i - 1].out_ch)))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int32_t riscv_nn_conv_chain_s8_get_cost(const riscv_nn_conv_layer * layers,
+                                        const int32_t num_layers,
+                                        const int32_t tile_rows,
+                                        riscv_nn_conv_chain_cost * cost)
+{
+    const int32_t out_dim_y = (num_layers > 0) ? layers[num_layers - 1].out_dim_y : 0;
+    int32_t tile_size = 0;
+    int32_t scratch_size = 0;
+    int64_t needed_macs = 0;
+    int32_t i;
+
+    if ((cost == NULL) || (conv_chain_check(layers, num_layers, tile_rows) != 0))
+    {
+        return -1;
+    }
+    cost->macs = 0;
+
+    for (i = 0; i < num_layers; i++)
+    {
+        const riscv_nn_conv_layer *l = &layers[i];
+        const int32_t ker_ch = (l->type == NN_CONV_DEPTHWISE) ? 1 : l->ker_ch;
+        const int64_t row_macs = (int64_t)l->out_dim_x * l->out_ch * l->ker_dim_x * l->ker_dim_y * ker_ch;
+        int32_t max_rows = 0;
+        int32_t max_in_rows = 0;
+        int32_t row_start;
+
+        for (row_start = 0; row_start < out_dim_y; row_start += tile_rows)
+        {
+            int32_t band_start, band_end, in_start, in_end;
+
+            conv_chain_band(layers, num_layers, i, row_start, MIN(row_start + tile_rows, out_dim_y),
+                            &band_start, &band_end);
+            conv_chain_in_rows(l, band_start, band_end, &in_start, &in_end);
+            max_rows = MAX(max_rows, band_end - band_start);
+            max_in_rows = MAX(max_in_rows, in_end - in_start);
+            cost->macs += (band_end - band_start) * row_macs;
+        }
+        needed_macs += l->out_dim_y * row_macs;
+
+        if (i < num_layers - 1)
+        {
+            tile_size = MAX(tile_size, (max_rows * l->out_dim_x * l->out_ch + 3) & ~3);
+        }
+        if (l->type == NN_CONV_DEPTHWISE)
+        {
+            scratch_size = MAX(scratch_size, (riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(
+                               l->in_ch, l->ch_mult, l->ker_dim_x, l->ker_dim_y, l->pad_x) + 3) & ~3);
+        }
+        else
+        {
+            scratch_size = MAX(scratch_size, riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(l->in_dim_x,
+                               max_in_rows, l->in_ch, l->ker_dim_x, l->ker_dim_y, l->ker_ch, l->pad_x,
+                               l->pad_y, l->stride_x, l->stride_y, l->out_dim_x, max_rows, l->out_ch,
+                               l->dilation_x, l->dilation_y));
+        }
+    }
+
+    // two intermediate tiles, the input and the output of the current layer,
+    // are alive at a time
+    cost->tile_size = (num_layers > 1) ? 2 * tile_size : 0;
+    cost->buffer_size = cost->tile_size + scratch_size;
+    cost->recomputed_macs = cost->macs - needed_macs;
+    return 0;
+}
+
+int32_t riscv_nn_conv_chain_s8_get_buffer_size(const riscv_nn_conv_layer * layers,
+                                               const int32_t num_layers,
+                                               const int32_t tile_rows)
+{
+    riscv_nn_conv_chain_cost cost;
+
+    if (riscv_nn_conv_chain_s8_get_cost(layers, num_layers, tile_rows, &cost) != 0)
+    {
+        return -1;
+    }
+    return cost.buffer_size;
+}
+
+int32_t riscv_nn_conv_chain_s8(const int8_t * in_tensor,
+                               const int32_t in_tensor_batch,
+                               const riscv_nn_conv_layer * layers,
+                               const int32_t num_layers,
+                               int8_t * out_tensor,
+                               const int32_t tile_rows,
+                               int16_t * in_tmp_buf)
+{
+    riscv_nn_conv_chain_cost cost;
+    const riscv_nn_conv_layer *first, *last;
+    int8_t *tiles[2];
+    int16_t *scratch;
+
+    if ((in_tmp_buf == NULL) || (riscv_nn_conv_chain_s8_get_cost(layers, num_layers, tile_rows, &cost) != 0))
+    {
+        return -1;
+    }
+    first = &layers[0];
+    last = &layers[num_layers - 1];
+    tiles[0] = (int8_t *)in_tmp_buf;
+    tiles[1] = tiles[0] + cost.tile_size / 2;
+    scratch = (int16_t *)(tiles[0] + cost.tile_size);
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        const int8_t *in_batch = in_tensor + i_batch * first->in_dim_x * first->in_dim_y * first->in_ch;
+        int8_t *out_batch = out_tensor + i_batch * last->out_dim_x * last->out_dim_y * last->out_ch;
+
+        for (int32_t row_start = 0; row_start < last->out_dim_y; row_start += tile_rows)
+        {
+            const int32_t row_end = MIN(row_start + tile_rows, last->out_dim_y);
+            const int8_t *src = in_batch;
+            int32_t src_start = 0;
+
+            for (int32_t i = 0; i < num_layers; i++)
+            {
+                const riscv_nn_conv_layer *l = &layers[i];
+                const int32_t in_row_size = l->in_dim_x * l->in_ch;
+                int32_t band_start, band_end, in_start, in_end, pad_top, status;
+                int8_t *dst;
+
+                // run the band as a layer of its own: its input rows with the
+                // padding the band has above them
+                conv_chain_band(layers, num_layers, i, row_start, row_end, &band_start, &band_end);
+                conv_chain_in_rows(l, band_start, band_end, &in_start, &in_end);
+                pad_top = in_start - (band_start * l->stride_y - l->pad_y);
+                dst = (i == num_layers - 1) ? out_batch + band_start * l->out_dim_x * l->out_ch : tiles[i & 1];
+
+                if (l->type == NN_CONV_DEPTHWISE)
+                {
+                    status = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(src + (in_start - src_start) * in_row_size,
+                                l->in_dim_x, in_end - in_start, l->in_ch, l->ker_weight, l->out_ch, l->ch_mult,
+                                l->ker_dim_x, l->ker_dim_y, l->pad_x, pad_top, l->stride_x, l->stride_y,
+                                l->bias, dst, l->out_shift, l->out_scale, l->out_dim_x, band_end - band_start,
+                                l->out_offset, l->in_offset, l->act_min, l->act_max, l->dilation_x,
+                                l->dilation_y, scratch);
+                }
+                else
+                {
+                    status = riscv_nn_conv_HWC_s8_asym_rows(src + (in_start - src_start) * in_row_size,
+                                l->in_dim_x, in_end - in_start, l->in_ch, l->ker_weight, l->out_ch,
+                                l->ker_dim_x, l->ker_dim_y, l->ker_ch, l->pad_x, pad_top, l->stride_x,
+                                l->stride_y, l->bias, dst, l->out_shift, l->out_scale, l->out_offset,
+                                l->in_offset, l->act_min, l->act_max, l->out_dim_x, 0, band_end - band_start,
+                                l->dilation_x, l->dilation_y, scratch);
+                }
+                if (status != 0)
+                {
+                    return -1;
+                }
+                src = dst;
+                src_start = band_start;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_support.h"
+
+//// Convolution Functions
+
+int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
+                                                        const int32_t in_tensor_batch,
+                                                        const int32_t in_tensor_dim_x,
+                                                        const int32_t in_tensor_dim_y,
+                                                        const int32_t in_tensor_ch,
+                                                        const int8_t * ker_weight,
+                                                        const int32_t out_tensor_ch,
+                                                        const int32_t pad_x,
+                                                        const int32_t pad_y,
+                                                        const int32_t stride_x,
+                                                        const int32_t stride_y,
+                                                        const int32_t * bias,
+                                                        int8_t * out_tensor,
+                                                        const int32_t * out_shift,
+                                                        const int32_t * out_scale,
+                                                        const int32_t out_tensor_dim_x,
+                                                        const int32_t out_tensor_dim_y,
+                                                        const int32_t out_offset,
+                                                        const int32_t in_offset,
+                                                        const int32_t act_min,
+                                                        const int32_t act_max,
+                                                        const int32_t dilation_x,
+                                                        const int32_t dilation_y,
+                                                        int8_t * tmp_buf)
+{
+    if ((in_tensor_ch != out_tensor_ch) ||
+        (tmp_buf == NULL))
+    {
+        return -1;
+    }
+
+    // unpack the 3x3 filters once; every output pixel of every batch reuses
+    // them through the s8 kernel
+    const int32_t ker_size = 9 * in_tensor_ch;
+    const int32_t in_size = in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch;
+    const int32_t out_size = out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch;
+
+    for (int32_t i = 0; i < ker_size; i++)
+    {
+        const int8_t packed = ker_weight[i >> 1];
+        tmp_buf[i] = (i & 1) ? (int8_t)(packed >> 4) : (int8_t)((int8_t)(packed << 4) >> 4);
+    }
+
+    for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    {
+        riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(in_tensor + i_batch * in_size,
+                                                        in_tensor_dim_x,
+                                                        in_tensor_dim_y,
+                                                        in_tensor_ch,
+                                                        tmp_buf,
+                                                        out_tensor_ch,
+                                                        pad_x,
+                                                        pad_y,
+                                                        stride_x,
+                                                        stride_y,
+                                                        bias,
+                                                        out_tensor + i_batch * out_size,
+                                                        out_shift,
+                                                        out_scale,
+                                                        out_tensor_dim_x,
+                                                        out_tensor_dim_y,
+                                                        out_offset,
+                                                        in_offset,
+                                                        act_min,
+                                                        act_max,
+                                                        dilation_x,
+                                                        dilation_y,
+                                                        NULL);
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_t in_tensor_ch)
+{
+    return 9 * in_tensor_ch;
+}
@@ -53,22 +53,32 @@ int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(const int8_t * in_tensor
                                                         int16_t * tmp_buf)
 {
     // Check input constraints
-    if((in_tensor_ch != out_tensor_ch) || (pad_x > 1))
+    if(in_tensor_ch != out_tensor_ch)
     {
         return -1;
     }
 
-    (void)dilation_x;
-    (void)dilation_y;
     (void)tmp_buf;
 
+    const int32_t row_size = in_tensor_ch * in_tensor_dim_x;
+    const int32_t tap_step_x = in_tensor_ch * dilation_x;
+    const int32_t tap_step_y = row_size * dilation_y;
+
     for(int32_t in_y = -pad_y, out_y = 0; out_y < out_tensor_dim_y; in_y += stride_y, out_y++)
     {
-        int32_t ker_y_start = MAX(0, -in_y);
+        // taps [ker_y_start, ker_y_end) fall inside the input; the padded ones
+        // contribute nothing
+        const int32_t ker_y_start = (in_y < 0) ? (-in_y + dilation_y - 1) / dilation_y : 0;
+        const int32_t ker_y_end = MIN(3, MAX(0, (in_tensor_dim_y - in_y + dilation_y - 1) / dilation_y));
+
         for(int32_t in_x = -pad_x, out_x = 0; out_x < out_tensor_dim_x; in_x += stride_x, out_x++)
         {
             int32_t cur_ch = 0;
-            int32_t ker_x_start = MAX(0, -in_x);
+            const int32_t ker_x_start = (in_x < 0) ? (-in_x + dilation_x - 1) / dilation_x : 0;
+            const int32_t ker_x_end = MIN(3, MAX(0, (in_tensor_dim_x - in_x + dilation_x - 1) / dilation_x));
+            const int8_t *in_base = in_tensor + (in_y + ker_y_start * dilation_y) * row_size
+                                    + (in_x + ker_x_start * dilation_x) * in_tensor_ch;
+            const int8_t *ker_base = ker_weight + (ker_y_start * 3 + ker_x_start) * in_tensor_ch;
 
             for(; cur_ch <= (in_tensor_ch - 4); cur_ch += 4)
             {
@@ -84,38 +94,25 @@ int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(const int8_t * in_tensor
                     out_buff3 = bias[cur_ch + 3];
                 }
 
-                const int8_t *input_ptr  = in_tensor + (in_y + ker_y_start) * (in_tensor_ch * in_tensor_dim_x) + in_x * in_tensor_ch + cur_ch;
-                const int8_t *kernel_ptr = ker_weight + ker_y_start * (in_tensor_ch * 3) + cur_ch;
+                const int8_t *input_ptr  = in_base + cur_ch;
+                const int8_t *kernel_ptr = ker_base + cur_ch;
 
-                for(int32_t ker_y = ker_y_start; ker_y < MIN(3, in_tensor_dim_y - in_y); ++ker_y)
+                for(int32_t ker_y = ker_y_start; ker_y < ker_y_end; ++ker_y)
                 {
-                    if(ker_x_start == 0)
-                    {
-                        out_buff0 += (*input_ptr     + in_offset) * *kernel_ptr;
-                        out_buff1 += (*(input_ptr+1) + in_offset) * *(kernel_ptr+1);
-                        out_buff2 += (*(input_ptr+2) + in_offset) * *(kernel_ptr+2);
-                        out_buff3 += (*(input_ptr+3) + in_offset) * *(kernel_ptr+3);
-                    }
-
-                    int8_t *input_ptr2 = (int8_t *)(input_ptr + in_tensor_ch);
-                    int8_t *kernel_ptr2 = (int8_t *)(kernel_ptr + in_tensor_ch);
-
-                    out_buff0 += (*input_ptr2     + in_offset) * *kernel_ptr2;
-                    out_buff1 += (*(input_ptr2+1) + in_offset) * *(kernel_ptr2+1);
-                    out_buff2 += (*(input_ptr2+2) + in_offset) * *(kernel_ptr2+2);
-                    out_buff3 += (*(input_ptr2+3) + in_offset) * *(kernel_ptr2+3);
+                    const int8_t *input_ptr2 = input_ptr;
+                    const int8_t *kernel_ptr2 = kernel_ptr;
 
-                    if((in_tensor_dim_x - in_x) >= 3)
+                    for(int32_t ker_x = ker_x_start; ker_x < ker_x_end; ++ker_x)
                     {
-                        input_ptr2 = (int8_t *)(input_ptr + (in_tensor_ch * 2));
-                        kernel_ptr2 = (int8_t *)(kernel_ptr + (in_tensor_ch * 2));
-
                         out_buff0 += (*input_ptr2     + in_offset) * *kernel_ptr2;
                         out_buff1 += (*(input_ptr2+1) + in_offset) * *(kernel_ptr2+1);
                         out_buff2 += (*(input_ptr2+2) + in_offset) * *(kernel_ptr2+2);
                         out_buff3 += (*(input_ptr2+3) + in_offset) * *(kernel_ptr2+3);
+
+                        input_ptr2 += tap_step_x;
+                        kernel_ptr2 += in_tensor_ch;
                     }
-                    input_ptr  += (in_tensor_ch * in_tensor_dim_x);
+                    input_ptr  += tap_step_y;
                     kernel_ptr += (in_tensor_ch * 3);
                 }
 
@@ -149,24 +146,17 @@ int32_t riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(const int8_t * in_tensor
                     out_buff = bias[cur_ch];
                 }
 
-                const int8_t *input_ptr  = in_tensor + (in_y + ker_y_start) * (in_tensor_ch * in_tensor_dim_x) + in_x * in_tensor_ch + cur_ch;
-                const int8_t *kernel_ptr = ker_weight + ker_y_start * (in_tensor_ch * 3) + cur_ch;
+                const int8_t *input_ptr  = in_base + cur_ch;
+                const int8_t *kernel_ptr = ker_base + cur_ch;
 
-                for(int32_t ker_y = ker_y_start; ker_y < MIN(3, in_tensor_dim_y - in_y); ++ker_y)
+                for(int32_t ker_y = ker_y_start; ker_y < ker_y_end; ++ker_y)
                 {
-                    if(ker_x_start == 0)
-                    {
-                        out_buff += (*(input_ptr) + in_offset) * *(kernel_ptr);
-                    }
-
-                    out_buff += (*(input_ptr + in_tensor_ch) + in_offset) * *(kernel_ptr + in_tensor_ch);
-
-                    if((in_tensor_dim_x - in_x) >= 3)
+                    for(int32_t ker_x = 0; ker_x < ker_x_end - ker_x_start; ++ker_x)
                     {
-                        out_buff += (*(input_ptr + (in_tensor_ch << 1)) + in_offset) * *(kernel_ptr + (in_tensor_ch << 1));
+                        out_buff += (*(input_ptr + ker_x * tap_step_x) + in_offset) * *(kernel_ptr + ker_x * in_tensor_ch);
                     }
 
-                    input_ptr  += (in_tensor_ch * in_tensor_dim_x);
+                    input_ptr  += tap_step_y;
                     kernel_ptr += (in_tensor_ch * 3);
                 }
 
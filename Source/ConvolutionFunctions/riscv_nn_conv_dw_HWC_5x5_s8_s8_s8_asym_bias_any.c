@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+//// Convolution Functions
+
+int32_t riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
+                                                        const int32_t in_tensor_dim_x,
+                                                        const int32_t in_tensor_dim_y,
+                                                        const int32_t in_tensor_ch,
+                                                        const int8_t * ker_weight,
+                                                        const int32_t out_tensor_ch,
+                                                        const int32_t pad_x,
+                                                        const int32_t pad_y,
+                                                        const int32_t stride_x,
+                                                        const int32_t stride_y,
+                                                        const int32_t * bias,
+                                                        int8_t * out_tensor,
+                                                        const int32_t * out_shift,
+                                                        const int32_t * out_scale,
+                                                        const int32_t out_tensor_dim_x,
+                                                        const int32_t out_tensor_dim_y,
+                                                        const int32_t out_offset,  //value is in the range of [-127, 128]
+                                                        const int32_t in_offset,   //value is in the range of [-128, 127]
+                                                        const int32_t act_min,
+                                                        const int32_t act_max,
+                                                        const int32_t dilation_x,
+                                                        const int32_t dilation_y,
+                                                        int16_t * tmp_buf)
+{
+    // Check input constraints
+    if((in_tensor_ch != out_tensor_ch) || (dilation_x != 1) || (dilation_y != 1))
+    {
+        return -1;
+    }
+
+    (void)tmp_buf;
+
+    return riscv_nn_dw_conv_HWC_kxk_s8(in_tensor,
+                                       in_tensor_dim_x,
+                                       in_tensor_dim_y,
+                                       in_tensor_ch,
+                                       ker_weight,
+                                       5,
+                                       pad_x,
+                                       pad_y,
+                                       stride_x,
+                                       stride_y,
+                                       bias,
+                                       out_tensor,
+                                       out_shift,
+                                       out_scale,
+                                       out_tensor_dim_x,
+                                       out_tensor_dim_y,
+                                       out_offset,
+                                       in_offset,
+                                       act_min,
+                                       act_max);
+}
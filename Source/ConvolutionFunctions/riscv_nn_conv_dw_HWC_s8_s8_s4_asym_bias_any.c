@@ -20,6 +20,7 @@
 /** @file*/
 
 #include "internal_nn_math.h"
+#include "riscv_nn_convolution.h"
 #include "riscv_nn_support.h"
 
 //// Convolution Functions
@@ -478,7 +479,36 @@ int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any(const int8_t * in_tensor,
                                                     const int32_t dilation_y,
                                                     int8_t * tmp_buf)
 {
-    (void)tmp_buf;
+    if ((tmp_buf != NULL) &&
+        (ch_mult == 1) &&
+        (ker_dim_x == 3) &&
+        (ker_dim_y == 3))
+    {
+        return riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any(in_tensor,
+                                                               in_tensor_batch,
+                                                               in_tensor_dim_x,
+                                                               in_tensor_dim_y,
+                                                               in_tensor_ch,
+                                                               ker_weight,
+                                                               out_tensor_ch,
+                                                               pad_x,
+                                                               pad_y,
+                                                               stride_x,
+                                                               stride_y,
+                                                               bias,
+                                                               out_tensor,
+                                                               out_shift,
+                                                               out_scale,
+                                                               out_tensor_dim_x,
+                                                               out_tensor_dim_y,
+                                                               out_offset,
+                                                               in_offset,
+                                                               act_min,
+                                                               act_max,
+                                                               dilation_x,
+                                                               dilation_y,
+                                                               tmp_buf);
+    }
 
     nn_depthwise_conv_s4_generic(in_tensor,
                               in_tensor_batch,
@@ -515,9 +545,11 @@ int32_t riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(const int32_
                                                                     const int32_t ker_dim_y,
                                                                     const int32_t ch_mult)
 {
-    (void)in_tensor_ch;
-    (void)ker_dim_x;
-    (void)ker_dim_y;
+    if ((ch_mult == 1) &&
+        (ker_dim_x == 3) &&
+        (ker_dim_y == 3))
+    {
+        return riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any_get_buffer_size(in_tensor_ch);
+    }
     return 0;
-
 }
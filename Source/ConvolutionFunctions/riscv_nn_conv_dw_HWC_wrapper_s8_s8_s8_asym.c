@@ -53,11 +53,7 @@ int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(const int8_t * in_tensor,
 {
     if(ch_mult == 1)
     {
-        if((ker_dim_x == 3) &&
-           (ker_dim_y == 3) &&
-           (pad_x <= 1) &&
-           (dilation_x == 1) &&
-           (dilation_y == 1))
+        if((ker_dim_x == 3) && (ker_dim_y == 3))
         {
             return riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(in_tensor,
                 in_tensor_dim_x,
@@ -83,6 +79,58 @@ int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(const int8_t * in_tensor,
                 dilation_y,
                 tmp_buf);
         }
+        else if((ker_dim_x == 5) && (ker_dim_y == 5) && (dilation_x == 1) && (dilation_y == 1))
+        {
+            return riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any(in_tensor,
+                in_tensor_dim_x,
+                in_tensor_dim_y,
+                in_tensor_ch,
+                ker_weight,
+                out_tensor_ch,
+                pad_x,
+                pad_y,
+                stride_x,
+                stride_y,
+                bias,
+                out_tensor,
+                out_shift,
+                out_scale,
+                out_tensor_dim_x,
+                out_tensor_dim_y,
+                out_offset,
+                in_offset,
+                act_min,
+                act_max,
+                dilation_x,
+                dilation_y,
+                tmp_buf);
+        }
+        else if((ker_dim_x == 7) && (ker_dim_y == 7) && (dilation_x == 1) && (dilation_y == 1))
+        {
+            return riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any(in_tensor,
+                in_tensor_dim_x,
+                in_tensor_dim_y,
+                in_tensor_ch,
+                ker_weight,
+                out_tensor_ch,
+                pad_x,
+                pad_y,
+                stride_x,
+                stride_y,
+                bias,
+                out_tensor,
+                out_shift,
+                out_scale,
+                out_tensor_dim_x,
+                out_tensor_dim_y,
+                out_offset,
+                in_offset,
+                act_min,
+                act_max,
+                dilation_x,
+                dilation_y,
+                tmp_buf);
+        }
         else
         {
             return riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any(in_tensor,
@@ -153,7 +201,9 @@ int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(const uint16_
 
     if(ch_mult == 1)
     {
-        if(!((ker_dim_x == 3) && (ker_dim_y == 3) && (pad_x <= 1)))
+        // 5x5 and 7x7 layers still reserve the buffer of the fast_any kernel,
+        // as the dilation that decides their route is not an argument here
+        if(!((ker_dim_x == 3) && (ker_dim_y == 3)))
         {
             size = riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size(in_tensor_ch, ker_dim_x, ker_dim_y);
         }
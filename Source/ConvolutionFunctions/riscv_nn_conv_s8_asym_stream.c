@@ -0,0 +1,341 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+
+//// Convolution Functions
+
+// Number of input rows an output row spans.
+static int32_t conv_stream_window(const int32_t ker_dim_y, const int32_t dilation_y)
+{
+    return dilation_y * (ker_dim_y - 1) + 1;
+}
+
+// Number of slots of the input row ring; a window never holds more rows.
+static int32_t conv_stream_ring(const int32_t in_tensor_dim_y,
+                                const int32_t ker_dim_y,
+                                const int32_t dilation_y)
+{
+    return MIN(conv_stream_window(ker_dim_y, dilation_y), in_tensor_dim_y);
+}
+
+// Size of the input row ring at the front of the stream buffer. Input row r
+// goes to slot r % ring and, but for the last slot, again ring slots further
+// on, so the rows of any window lie next to each other from the slot of its
+// first row and the convolution reads them in place.
+static int32_t conv_stream_rows_size(const int32_t in_tensor_dim_x,
+                                     const int32_t in_tensor_dim_y,
+                                     const int32_t in_tensor_ch,
+                                     const int32_t ker_dim_y,
+                                     const int32_t dilation_y)
+{
+    const int32_t ring = conv_stream_ring(in_tensor_dim_y, ker_dim_y, dilation_y);
+
+    return ((2 * ring - 1) * in_tensor_dim_x * in_tensor_ch + 3) & ~3;
+}
+
+// Fill the fields shared by both layer types and check that every output row
+// reads at least one input row.
+static int32_t conv_stream_init(riscv_nn_conv_stream * stream,
+                                const int32_t in_tensor_dim_x,
+                                const int32_t in_tensor_dim_y,
+                                const int32_t in_tensor_ch,
+                                const int8_t * ker_weight,
+                                const int32_t out_tensor_ch,
+                                const int32_t ch_mult,
+                                const int32_t ker_dim_x,
+                                const int32_t ker_dim_y,
+                                const int32_t ker_ch,
+                                const int32_t pad_x,
+                                const int32_t pad_y,
+                                const int32_t stride_x,
+                                const int32_t stride_y,
+                                const int32_t * bias,
+                                const int32_t * out_shift,
+                                const int32_t * out_scale,
+                                const int32_t out_offset,
+                                const int32_t in_offset,
+                                const int32_t act_min,
+                                const int32_t act_max,
+                                const int32_t out_tensor_dim_x,
+                                const int32_t out_tensor_dim_y,
+                                const int32_t dilation_x,
+                                const int32_t dilation_y,
+                                int8_t * stream_buf)
+{
+    const int32_t window = conv_stream_window(ker_dim_y, dilation_y);
+    int32_t first_last;
+
+    if ((stream == NULL) || (stream_buf == NULL) || (stride_y <= 0) || (dilation_y <= 0)
+        || (out_tensor_dim_y <= 0) || (stride_y * (out_tensor_dim_y - 1) - pad_y >= in_tensor_dim_y))
+    {
+        return -1;
+    }
+
+    stream->ker_weight = ker_weight;
+    stream->bias = bias;
+    stream->out_shift = out_shift;
+    stream->out_scale = out_scale;
+    stream->rows = stream_buf;
+    stream->tmp_buf = (int16_t *)(stream_buf + conv_stream_rows_size(in_tensor_dim_x, in_tensor_dim_y,
+                                  in_tensor_ch, ker_dim_y, dilation_y));
+    stream->in_dim_x = in_tensor_dim_x;
+    stream->in_dim_y = in_tensor_dim_y;
+    stream->in_ch = in_tensor_ch;
+    stream->out_ch = out_tensor_ch;
+    stream->ch_mult = ch_mult;
+    stream->ker_dim_x = ker_dim_x;
+    stream->ker_dim_y = ker_dim_y;
+    stream->ker_ch = ker_ch;
+    stream->pad_x = pad_x;
+    stream->pad_y = pad_y;
+    stream->stride_x = stride_x;
+    stream->stride_y = stride_y;
+    stream->dilation_x = dilation_x;
+    stream->dilation_y = dilation_y;
+    stream->out_offset = out_offset;
+    stream->in_offset = in_offset;
+    stream->act_min = act_min;
+    stream->act_max = act_max;
+    stream->out_dim_x = out_tensor_dim_x;
+    stream->out_dim_y = out_tensor_dim_y;
+
+    // every output row is returned by the push of the last input row its
+    // window covers; only the last input row completes more than one
+    first_last = 0;
+    while ((first_last < out_tensor_dim_y)
+           && (first_last * stride_y - pad_y + window - 1 < in_tensor_dim_y - 1))
+    {
+        first_last++;
+    }
+    stream->max_out_rows = MAX(out_tensor_dim_y - first_last, 1);
+
+    stream->rows_in = 0;
+    stream->rows_out = 0;
+    stream->held_start = 0;
+    stream->held = 0;
+
+    return 0;
+}
+
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init(riscv_nn_conv_stream * stream,
+                                                    const uint16_t in_tensor_dim_x,
+                                                    const uint16_t in_tensor_dim_y,
+                                                    const uint16_t in_tensor_ch,
+                                                    const int8_t * ker_weight,
+                                                    const uint16_t out_tensor_ch,
+                                                    const uint16_t ker_dim_x,
+                                                    const uint16_t ker_dim_y,
+                                                    const uint16_t ker_ch,
+                                                    const uint16_t pad_x,
+                                                    const uint16_t pad_y,
+                                                    const uint16_t stride_x,
+                                                    const uint16_t stride_y,
+                                                    const int32_t * bias,
+                                                    const int32_t * out_shift,
+                                                    const int32_t * out_scale,
+                                                    const int32_t out_offset,
+                                                    const int32_t in_offset,
+                                                    const int32_t act_min,
+                                                    const int32_t act_max,
+                                                    const uint16_t out_tensor_dim_x,
+                                                    const uint16_t out_tensor_dim_y,
+                                                    const int32_t dilation_x,
+                                                    const int32_t dilation_y,
+                                                    int8_t * stream_buf)
+{
+    return conv_stream_init(stream, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_weight,
+                            out_tensor_ch, 0, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x,
+                            stride_y, bias, out_shift, out_scale, out_offset, in_offset, act_min,
+                            act_max, out_tensor_dim_x, out_tensor_dim_y, dilation_x, dilation_y,
+                            stream_buf);
+}
+
+int32_t riscv_nn_conv_HWC_s8_s8_s8_asym_stream_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                               const uint16_t in_tensor_dim_y,
+                                                               const uint16_t in_tensor_ch,
+                                                               const uint16_t ker_dim_x,
+                                                               const uint16_t ker_dim_y,
+                                                               const uint16_t ker_ch,
+                                                               const uint16_t pad_x,
+                                                               const uint16_t pad_y,
+                                                               const uint16_t stride_x,
+                                                               const uint16_t stride_y,
+                                                               const uint16_t out_tensor_dim_x,
+                                                               const uint16_t out_tensor_ch,
+                                                               const int32_t dilation_x,
+                                                               const int32_t dilation_y)
+{
+    const int32_t window = MIN(conv_stream_window(ker_dim_y, dilation_y), in_tensor_dim_y);
+
+    // the convolution only ever sees the window and computes one row of it
+    return conv_stream_rows_size(in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_dim_y, dilation_y)
+           + riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(in_tensor_dim_x, window, in_tensor_ch,
+                   ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y, out_tensor_dim_x, 1,
+                   out_tensor_ch, dilation_x, dilation_y);
+}
+
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init(riscv_nn_conv_stream * stream,
+                                                       const uint16_t in_tensor_dim_x,
+                                                       const uint16_t in_tensor_dim_y,
+                                                       const uint16_t in_tensor_ch,
+                                                       const int8_t * ker_weight,
+                                                       const uint16_t out_tensor_ch,
+                                                       const uint16_t ch_mult,
+                                                       const uint16_t ker_dim_x,
+                                                       const uint16_t ker_dim_y,
+                                                       const uint16_t pad_x,
+                                                       const uint16_t pad_y,
+                                                       const uint16_t stride_x,
+                                                       const uint16_t stride_y,
+                                                       const int32_t * bias,
+                                                       const int32_t * out_shift,
+                                                       const int32_t * out_scale,
+                                                       const uint16_t out_tensor_dim_x,
+                                                       const uint16_t out_tensor_dim_y,
+                                                       const int32_t out_offset,
+                                                       const int32_t in_offset,
+                                                       const int32_t act_min,
+                                                       const int32_t act_max,
+                                                       const uint16_t dilation_x,
+                                                       const uint16_t dilation_y,
+                                                       int8_t * stream_buf)
+{
+    if (ch_mult == 0)
+    {
+        return -1;
+    }
+
+    return conv_stream_init(stream, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_weight,
+                            out_tensor_ch, ch_mult, ker_dim_x, ker_dim_y, 1, pad_x, pad_y, stride_x,
+                            stride_y, bias, out_shift, out_scale, out_offset, in_offset, act_min,
+                            act_max, out_tensor_dim_x, out_tensor_dim_y, dilation_x, dilation_y,
+                            stream_buf);
+}
+
+int32_t riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                  const uint16_t in_tensor_dim_y,
+                                                                  const uint16_t in_tensor_ch,
+                                                                  const uint16_t ch_mult,
+                                                                  const uint16_t ker_dim_x,
+                                                                  const uint16_t ker_dim_y,
+                                                                  const uint16_t pad_x,
+                                                                  const uint16_t dilation_y)
+{
+    return conv_stream_rows_size(in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_dim_y, dilation_y)
+           + riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_ch, ch_mult, ker_dim_x,
+                   ker_dim_y, pad_x);
+}
+
+int32_t riscv_nn_conv_stream_push_row_s8(riscv_nn_conv_stream * stream,
+                                         const int8_t * in_row,
+                                         int8_t * out_rows)
+{
+    const int32_t in_row_size = stream->in_dim_x * stream->in_ch;
+    const int32_t out_row_size = stream->out_dim_x * stream->out_ch;
+    const int32_t window = conv_stream_window(stream->ker_dim_y, stream->dilation_y);
+    const int32_t ring = conv_stream_ring(stream->in_dim_y, stream->ker_dim_y, stream->dilation_y);
+    const int32_t row = stream->rows_in;
+    int32_t num_out = 0;
+
+    if (row >= stream->in_dim_y)
+    {
+        return -1;
+    }
+    stream->rows_in++;
+
+    // keep the row unless it lies in the gap between two windows of a
+    // stride larger than the kernel
+    if (row >= stream->rows_out * stream->stride_y - stream->pad_y)
+    {
+        const int32_t slot = row % ring;
+
+        if (stream->held == 0)
+        {
+            stream->held_start = row;
+        }
+        memcpy(stream->rows + slot * in_row_size, in_row, in_row_size);
+        if (slot < ring - 1)
+        {
+            memcpy(stream->rows + (slot + ring) * in_row_size, in_row, in_row_size);
+        }
+        stream->held++;
+    }
+
+    while (stream->rows_out < stream->out_dim_y)
+    {
+        const int32_t base_y = stream->rows_out * stream->stride_y - stream->pad_y;
+        const int8_t *held_rows = stream->rows + (stream->held_start % ring) * in_row_size;
+        int32_t next_base_y, drop, status;
+
+        if (MIN(base_y + window - 1, stream->in_dim_y - 1) > row)
+        {
+            break;
+        }
+
+        // the held rows are the whole window but its padding, so run them as
+        // an input of stream->held rows with the padding the window has above
+        if (stream->ch_mult == 0)
+        {
+            status = riscv_nn_conv_HWC_s8_asym_rows(held_rows, stream->in_dim_x, stream->held,
+                        stream->in_ch, stream->ker_weight, stream->out_ch, stream->ker_dim_x,
+                        stream->ker_dim_y, stream->ker_ch, stream->pad_x, stream->held_start - base_y,
+                        stream->stride_x, stream->stride_y, stream->bias, out_rows + num_out * out_row_size,
+                        stream->out_shift, stream->out_scale, stream->out_offset, stream->in_offset,
+                        stream->act_min, stream->act_max, stream->out_dim_x, 0, 1, stream->dilation_x,
+                        stream->dilation_y, stream->tmp_buf);
+        }
+        else
+        {
+            status = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(held_rows, stream->in_dim_x,
+                        stream->held, stream->in_ch, stream->ker_weight, stream->out_ch, stream->ch_mult,
+                        stream->ker_dim_x, stream->ker_dim_y, stream->pad_x, stream->held_start - base_y,
+                        stream->stride_x, stream->stride_y, stream->bias, out_rows + num_out * out_row_size,
+                        stream->out_shift, stream->out_scale, stream->out_dim_x, 1, stream->out_offset,
+                        stream->in_offset, stream->act_min, stream->act_max, stream->dilation_x,
+                        stream->dilation_y, stream->tmp_buf);
+        }
+        if (status != 0)
+        {
+            return -1;
+        }
+        num_out++;
+        stream->rows_out++;
+
+        // drop the rows above the next window; their slots are reused
+        next_base_y = stream->rows_out * stream->stride_y - stream->pad_y;
+        drop = MIN(MAX(next_base_y - stream->held_start, 0), stream->held);
+        stream->held -= drop;
+        stream->held_start += drop;
+    }
+
+    // the last input row completes the frame; start over for the next one
+    if (stream->rows_in == stream->in_dim_y)
+    {
+        stream->rows_in = 0;
+        stream->rows_out = 0;
+        stream->held_start = 0;
+        stream->held = 0;
+    }
+
+    return num_out;
+}
@@ -24,6 +24,30 @@
 
 //// Convolution Functions
 
+// Gather form: every output element accumulates, in int64, the input taps that
+// scatter into it (ker_x = (i_out_x + pad_x) % stride_x + k * stride_x, reading
+// input (i_out_x + pad_x - ker_x) / stride_x) and is written out directly.
+
+// int16 x int8 products fit 23 bits, so up to 256 of them are summed in
+// int32 before being added to the 64-bit accumulator.
+static inline int64_t conv_trans_dot_s16(const int16_t *in, const int8_t *wt, const int32_t size)
+{
+    int64_t sum = 0;
+
+    for (int32_t i = 0; i < size; i += 256)
+    {
+        const int32_t len = MIN(256, size - i);
+        int32_t part = 0;
+
+        for (int32_t j = 0; j < len; j++)
+        {
+            part += in[i + j] * wt[i + j];
+        }
+        sum += part;
+    }
+    return sum;
+}
+
 int32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_tensor,
                                                              const int32_t in_tensor_dim_x,
                                                              const int32_t in_tensor_ch,
@@ -46,59 +70,50 @@ int32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any(const int16_t * in_
 {
     (void)in_offset;
     (void)out_offset;
+    (void)in_tmp_buf;
     int i_batch;
 
-    int64_t *out_tmp_buf = (int64_t*)in_tmp_buf;
-    uint32_t out_tensor_len = out_tensor_dim_x * out_tensor_ch;
+    const int32_t ker_size = ker_dim_x * in_tensor_ch;
 
     for (i_batch = 0; i_batch < in_tensor_batch; i_batch++)
     {
-        riscv_nn_set_zero_s8((int8_t*)out_tmp_buf, sizeof(*out_tmp_buf) * out_tensor_len);
-
-        for (int i_in_x = 0; i_in_x < in_tensor_dim_x; ++i_in_x)
+        for (int i_out_x = 0; i_out_x < out_tensor_dim_x; ++i_out_x)
         {
-            for (int i_in_channel = 0; i_in_channel < in_tensor_ch; ++i_in_channel)
-            {
-                // Loop through the output elements it will influence.
-                const int out_x_origin = (i_in_x * stride_x) - pad_x;
+            // ker_x range whose input lies in [0, in_tensor_dim_x); the input
+            // steps down by one for every stride_x taps
+            const int pos_x = i_out_x + pad_x;
+            const int ker_x_start = MAX(pos_x % stride_x, pos_x - (in_tensor_dim_x - 1) * stride_x);
+            const int ker_x_end = MIN(ker_dim_x, pos_x + 1);
+            const int in_x_start = (pos_x - ker_x_start) / stride_x;
 
-                for (int i_ker_x = 0; i_ker_x < ker_dim_x; ++i_ker_x)
-                {
-                    for (int i_out_channel = 0; i_out_channel < out_tensor_ch; ++i_out_channel)
-                    {
-                        // Compute output element location.
-                        const int i_out_x = out_x_origin + i_ker_x;
-
-                        // We cannot accumulate out of bounds.
-                        // ker_weight: {O,W,I}
-                        if ((i_out_x >= 0) && (i_out_x < out_tensor_dim_x))
-                        {
-                            int16_t input_value = in_tensor[i_in_x * in_tensor_ch + i_in_channel];
-                            int8_t filter_value = ker_weight[i_out_channel * in_tensor_ch * ker_dim_x + i_ker_x * in_tensor_ch + i_in_channel];
-
-                            out_tmp_buf[i_out_x * out_tensor_ch + i_out_channel] += (input_value /*+ in_offset*/) * filter_value;
-                        }
-                    }
-                }
-            }
-        }
+            int16_t *out = out_tensor + i_out_x * out_tensor_ch;
+            const int8_t *wt = ker_weight;
 
-        for (int i_out_x = 0; i_out_x < out_tensor_dim_x; ++i_out_x)
-        {
             for (int i_out_channel = 0; i_out_channel < out_tensor_ch; ++i_out_channel)
             {
-                int64_t acc = out_tmp_buf[i_out_x * out_tensor_ch + i_out_channel];
-                const int32_t reduced_scale = REDUCE_MULTIPLIER(out_scale[i_out_channel]);
+                // ker_weight: {O,W,I}
+                const int16_t *in_ptr = in_tensor + in_x_start * in_tensor_ch;
+                const int8_t *wt_ptr = wt + ker_x_start * in_tensor_ch;
+                int64_t acc = 0;
 
                 if (bias)
                 {
-                    acc += bias[i_out_channel];
+                    acc = bias[i_out_channel];
                 }
 
+                for (int i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x += stride_x)
+                {
+                    acc += conv_trans_dot_s16(in_ptr, wt_ptr, in_tensor_ch);
+                    in_ptr -= in_tensor_ch;
+                    wt_ptr += stride_x * in_tensor_ch;
+                }
+
+                const int32_t reduced_scale = REDUCE_MULTIPLIER(out_scale[i_out_channel]);
                 int32_t conv_out = riscv_nn_requantize_s64(acc, reduced_scale, out_shift[i_out_channel]);
                 conv_out = MAX(conv_out, act_min);
                 conv_out = MIN(conv_out, act_max);
-                out_tensor[i_out_channel + i_out_x * out_tensor_ch] = (int16_t)conv_out;
+                out[i_out_channel] = (int16_t)conv_out;
+                wt += ker_size;
             }
         }
 
@@ -119,15 +134,14 @@ uint32_t riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any_get_buffer_size(co
 {
     // return the required buffer size (in byte)
     (void)in_tensor_dim_x;
+    (void)in_tensor_ch;
     (void)in_tensor_batch;
+    (void)out_tensor_ch;
+    (void)ker_dim_x;
     (void)pad_x;
     (void)stride_x;
+    (void)out_tensor_dim_x;
 
-    uint32_t buf_size = 0;
-
-    // Note. the element of partial results is 8 byte)
-    // temporary buffer to keep the partial results
-    buf_size = (out_tensor_ch * out_tensor_dim_x) * sizeof(int64_t);
-
-    return buf_size;
+    // the outputs are accumulated in registers; no partial-result buffer
+    return 0;
 }
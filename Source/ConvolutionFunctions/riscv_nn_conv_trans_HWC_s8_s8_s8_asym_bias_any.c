@@ -21,10 +21,22 @@
 
 #include "internal_nn_math.h"
 #include "riscv_nn_support.h"
-
+#include "riscv_nn_util.h"
 
 //// Convolution Functions
 
+// The transposed convolution is computed in gather form: every output pixel
+// collects the input taps that scatter into it. Output pixels sharing the same
+// (oy + pad_y) % stride_y and (ox + pad_x) % stride_x see the same sub-kernel
+// (the taps ker_y = ry + jy * stride_y, ker_x = rx + jx * stride_x), applied
+// to the input at (by - jy, bx - jx). Each of these stride_x * stride_y phases
+// is then a plain convolution, run by im2col and the s8 matmul core.
+
+static inline int32_t conv_trans_phase_taps(const int32_t ker_dim, const int32_t phase, const int32_t stride)
+{
+    return (phase < ker_dim) ? (ker_dim - phase + stride - 1) / stride : 0;
+}
+
 int32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
                                                        const uint16_t in_tensor_dim_x,
                                                        const uint16_t in_tensor_dim_y,
@@ -55,68 +67,107 @@ int32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(const int8_t * in_tensor,
     (void)pad_offset_x;
     (void)pad_offset_y;
 
-    int32_t *out_tmp_buf = (int32_t*)tmp_buf;
-
-    for (int i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+    // tmp_buf holds the per-channel bias + in_offset * sum(sub-kernel), the
+    // sub-kernel of the current phase and NN_CONV_IM2COL_PIXELS gathered
+    // columns. Taps outside the input are filled with -in_offset.
+    const int32_t max_taps = conv_trans_phase_taps(ker_dim_y, 0, stride_y) * conv_trans_phase_taps(ker_dim_x, 0, stride_x);
+    const int32_t in_size = in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch;
+    const int32_t out_size = out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch;
+    const int8_t pad_val = (int8_t)(-in_offset);
+    int32_t *contri_buf = (int32_t *)tmp_buf;
+    int8_t *wt_buf = (int8_t *)(contri_buf + out_tensor_ch);
+    int8_t *col_buf = wt_buf + out_tensor_ch * max_taps * in_tensor_ch;
+
+    for (int32_t ry = 0; ry < stride_y; ry++)
     {
-        riscv_nn_set_zero_s8((int8_t*)out_tmp_buf, sizeof(*out_tmp_buf) * out_tensor_dim_y * out_tensor_dim_x * out_tensor_ch);
+        const int32_t taps_y = conv_trans_phase_taps(ker_dim_y, ry, stride_y);
+        const int32_t first_y = ((ry - pad_y) % stride_y + stride_y) % stride_y;
 
-        for (int i_in_y = 0; i_in_y < in_tensor_dim_y; i_in_y++)
+        for (int32_t rx = 0; rx < stride_x; rx++)
         {
-            for (int i_in_x = 0; i_in_x < in_tensor_dim_x; i_in_x++)
+            const int32_t taps_x = conv_trans_phase_taps(ker_dim_x, rx, stride_x);
+            const int32_t first_x = ((rx - pad_x) % stride_x + stride_x) % stride_x;
+            const int32_t col_size = taps_y * taps_x * in_tensor_ch;
+
+            // Pack the sub-kernel of this phase as [out_ch][jy][jx][in_ch].
+            int8_t *wt_dst = wt_buf;
+            for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
             {
-                for (int i_in_ch = 0; i_in_ch < in_tensor_ch; i_in_ch++)
+                for (int32_t jy = 0; jy < taps_y; jy++)
                 {
-                    const int out_x_origin = (i_in_x * stride_x) - pad_x;
-                    const int out_y_origin = (i_in_y * stride_y) - pad_y;
+                    for (int32_t jx = 0; jx < taps_x; jx++)
+                    {
+                        const int32_t i_ker = (ry + jy * stride_y) * ker_dim_x + rx + jx * stride_x;
+                        memcpy(wt_dst, ker_weight + (i_out_ch * ker_dim_y * ker_dim_x + i_ker) * in_tensor_ch, in_tensor_ch);
+                        wt_dst += in_tensor_ch;
+                    }
+                }
+            }
+            riscv_nn_kernel_sum_s8(wt_buf, bias, out_tensor_ch, col_size, in_offset, contri_buf);
+
+            for (int32_t i_batch = 0; i_batch < in_tensor_batch; i_batch++)
+            {
+                const int8_t *in_batch = in_tensor + i_batch * in_size;
+                int8_t *out_batch = out_tensor + i_batch * out_size;
 
-                    for (int i_ker_y = 0; i_ker_y < ker_dim_y; i_ker_y++)
+                for (int32_t i_out_y = first_y; i_out_y < out_tensor_dim_y; i_out_y += stride_y)
+                {
+                    const int32_t base_y = (i_out_y + pad_y - ry) / stride_y;
+
+                    for (int32_t i_out_x = first_x; i_out_x < out_tensor_dim_x; i_out_x += NN_CONV_IM2COL_PIXELS * stride_x)
                     {
-                        for (int i_ker_x = 0; i_ker_x < ker_dim_x; i_ker_x++)
+                        const int32_t pixels = MIN(NN_CONV_IM2COL_PIXELS, (out_tensor_dim_x - i_out_x + stride_x - 1) / stride_x);
+                        int8_t *out = out_batch + (i_out_y * out_tensor_dim_x + i_out_x) * out_tensor_ch;
+
+                        if (col_size == 0)
                         {
-                            for (int i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+                            // No tap reaches these pixels; only the bias is left.
+                            for (int32_t i = 0; i < pixels; i++)
                             {
-                                const int i_out_x = out_x_origin + i_ker_x;
-                                const int i_out_y = out_y_origin + i_ker_y;
-
-                                if ((i_out_x >= 0) && (i_out_x < out_tensor_dim_x) && (i_out_y >= 0) && (i_out_y < out_tensor_dim_y))
+                                for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
                                 {
-                                    int8_t in_val  = in_tensor[(i_in_y * in_tensor_dim_x + i_in_x) * in_tensor_ch + i_in_ch];
-                                    int8_t wt_val = ker_weight[i_out_ch * in_tensor_ch * ker_dim_y * ker_dim_x + (i_ker_y * ker_dim_x + i_ker_x) * in_tensor_ch + i_in_ch];
-
-                                    out_tmp_buf[(i_out_y * out_tensor_dim_x + i_out_x) * out_tensor_ch + i_out_ch] += (in_val + in_offset) * wt_val;
-
+                                    int32_t acc = riscv_nn_requantize(contri_buf[i_out_ch], out_scale[i_out_ch], out_shift[i_out_ch]);
+                                    acc += out_offset;
+                                    acc = MAX(acc, act_min);
+                                    acc = MIN(acc, act_max);
+                                    out[i * stride_x * out_tensor_ch + i_out_ch] = (int8_t)acc;
                                 }
                             }
+                            continue;
                         }
-                    }
-                }
-            }
-        }
 
-        for (int i_out_y = 0; i_out_y < out_tensor_dim_y; ++i_out_y)
-        {
-            for (int i_out_x = 0; i_out_x < out_tensor_dim_x; ++i_out_x)
-            {
-                for (int i_out_ch = 0; i_out_ch < out_tensor_ch; ++i_out_ch)
-                {
-                    int32_t acc = out_tmp_buf[(i_out_y * out_tensor_dim_x + i_out_x) * out_tensor_ch + i_out_ch];
-                    if (bias)
-                    {
-                        acc += bias[i_out_ch];
-                    }
+                        int8_t *col = col_buf;
+                        for (int32_t i = 0; i < pixels; i++)
+                        {
+                            const int32_t base_x = (i_out_x + i * stride_x + pad_x - rx) / stride_x;
+
+                            riscv_nn_im2col_HWC_s8(in_batch, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch,
+                                                   taps_x, taps_y, in_tensor_ch, base_x, base_y, -1, -1,
+                                                   pad_val, col);
+                            col += col_size;
+                        }
 
-                    acc = riscv_nn_requantize(acc, out_scale[i_out_ch], out_shift[i_out_ch]);
-                    acc += out_offset;
-                    acc = MAX(acc, act_min);
-                    acc = MIN(acc, act_max);
-                    out_tensor[i_out_ch + (i_out_y * out_tensor_dim_x + i_out_x) * out_tensor_ch] = (int8_t)acc;
+                        riscv_nn_mat_mult_nt_t_s8_core(col_buf,
+                                                       wt_buf,
+                                                       NULL,
+                                                       out,
+                                                       out_scale,
+                                                       out_shift,
+                                                       pixels,
+                                                       out_tensor_ch,
+                                                       col_size,
+                                                       in_offset,
+                                                       out_offset,
+                                                       act_min,
+                                                       act_max,
+                                                       col_size,
+                                                       stride_x * out_tensor_ch,
+                                                       contri_buf,
+                                                       0);
+                    }
                 }
             }
         }
-
-        in_tensor += (in_tensor_dim_x * in_tensor_dim_y * in_tensor_ch);
-        out_tensor += (out_tensor_dim_x * out_tensor_dim_y * out_tensor_ch);
     }
 
     return 0;
@@ -142,14 +193,12 @@ uint32_t riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(const ui
     (void)in_tensor_batch;
     (void)pad_x;
     (void)pad_y;
-    (void)stride_x;
-    (void)stride_y;
-
-    uint32_t buf_size = 0;
+    (void)out_tensor_dim_x;
+    (void)out_tensor_dim_y;
 
-    //Note. the element of partial results is 4 byte)
-    //temporary buffer to keep the partial results
-    buf_size = (out_tensor_ch * out_tensor_dim_y * out_tensor_dim_x) * sizeof(int32_t);
+    const uint32_t col_size = conv_trans_phase_taps(ker_dim_y, 0, stride_y) * conv_trans_phase_taps(ker_dim_x, 0, stride_x) * in_tensor_ch;
 
-    return buf_size;
+    // per-channel offset terms, the largest sub-kernel and the gathered
+    // columns; the sub-kernel makes it scale with the weights
+    return out_tensor_ch * sizeof(int32_t) + (out_tensor_ch + NN_CONV_IM2COL_PIXELS) * col_size;
 }
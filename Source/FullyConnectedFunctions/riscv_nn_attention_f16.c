@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include <float.h>
+#include "internal_nn_math.h"
+
+//// FullyConnected Functions
+
+int32_t riscv_nn_attention_f16(const float16_t * q,
+                               const float16_t * k,
+                               const float16_t * v,
+                               const uint8_t * kv_mask,
+                               float16_t * dst,
+                               const int32_t batch,
+                               const int32_t q_heads,
+                               const int32_t kv_heads,
+                               const int32_t q_len,
+                               const int32_t kv_len,
+                               const int32_t head_dim,
+                               const float16_t scale,
+                               const int32_t causal,
+                               float32_t * tmp_buf)
+{
+    if ((kv_heads <= 0) || (q_heads % kv_heads != 0) || (tmp_buf == NULL))
+    {
+        return -1;
+    }
+
+    const int32_t group = q_heads / kv_heads;
+    const int32_t causal_shift = kv_len - q_len;
+    const float32_t scale_f32 = scale;
+    float32_t scores[NN_ATTENTION_Q_TILE * NN_ATTENTION_KV_BLOCK];
+    float32_t row_max[NN_ATTENTION_Q_TILE];
+    float32_t row_sum[NN_ATTENTION_Q_TILE];
+
+    for (int32_t b = 0; b < batch; b++)
+    {
+        const uint8_t *mask = (kv_mask != NULL) ? kv_mask + b * kv_len : NULL;
+
+        for (int32_t h = 0; h < q_heads; h++)
+        {
+            const float16_t *q_head = q + (b * q_heads + h) * q_len * head_dim;
+            const float16_t *k_head = k + (b * kv_heads + h / group) * kv_len * head_dim;
+            const float16_t *v_head = v + (b * kv_heads + h / group) * kv_len * head_dim;
+            float16_t *dst_head = dst + (b * q_heads + h) * q_len * head_dim;
+
+            for (int32_t row = 0; row < q_len; row += NN_ATTENTION_Q_TILE)
+            {
+                const int32_t rows = MIN(NN_ATTENTION_Q_TILE, q_len - row);
+                const int32_t key_end = causal ? MIN(kv_len, row + rows + causal_shift) : kv_len;
+
+                for (int32_t i = 0; i < rows; i++)
+                {
+                    row_max[i] = -FLT_MAX;
+                    row_sum[i] = 0.0f;
+                }
+                memset(tmp_buf, 0, sizeof(float32_t) * rows * head_dim);
+
+                for (int32_t key = 0; key < key_end; key += NN_ATTENTION_KV_BLOCK)
+                {
+                    const int32_t cols = MIN(NN_ATTENTION_KV_BLOCK, key_end - key);
+
+                    for (int32_t i = 0; i < rows; i++)
+                    {
+                        const float16_t *q_row = q_head + (row + i) * head_dim;
+                        const int32_t end = causal ? MIN(cols, row + i + causal_shift + 1 - key) : cols;
+                        float32_t *s = scores + i * NN_ATTENTION_KV_BLOCK;
+                        float32_t *acc = tmp_buf + i * head_dim;
+                        float32_t max = -FLT_MAX;
+
+                        for (int32_t j = 0; j < end; j++)
+                        {
+                            const float16_t *k_row = k_head + (key + j) * head_dim;
+                            float32_t dot = 0.0f;
+
+                            if ((mask != NULL) && !mask[key + j])
+                            {
+                                s[j] = -FLT_MAX;
+                                continue;
+                            }
+                            for (int32_t c = 0; c < head_dim; c++)
+                            {
+                                dot += (float32_t)q_row[c] * (float32_t)k_row[c];
+                            }
+                            s[j] = dot * scale_f32;
+                            max = (s[j] > max) ? s[j] : max;
+                        }
+                        if (max == -FLT_MAX)
+                        {
+                            continue;
+                        }
+
+                        if (max > row_max[i])
+                        {
+                            const float32_t f = exp_f32(row_max[i] - max);
+
+                            row_sum[i] *= f;
+                            for (int32_t c = 0; c < head_dim; c++)
+                            {
+                                acc[c] *= f;
+                            }
+                            row_max[i] = max;
+                        }
+
+                        for (int32_t j = 0; j < end; j++)
+                        {
+                            const float16_t *v_row = v_head + (key + j) * head_dim;
+                            float32_t e;
+
+                            if (s[j] == -FLT_MAX)
+                            {
+                                continue;
+                            }
+                            e = exp_f32(s[j] - row_max[i]);
+                            row_sum[i] += e;
+                            for (int32_t c = 0; c < head_dim; c++)
+                            {
+                                acc[c] += e * (float32_t)v_row[c];
+                            }
+                        }
+                    }
+                }
+
+                for (int32_t i = 0; i < rows; i++)
+                {
+                    const float32_t inv = (row_sum[i] > 0.0f) ? 1.0f / row_sum[i] : 0.0f;
+                    const float32_t *acc = tmp_buf + i * head_dim;
+                    float16_t *out = dst_head + (row + i) * head_dim;
+
+                    for (int32_t c = 0; c < head_dim; c++)
+                    {
+                        out[c] = (float16_t)(acc[c] * inv);
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_attention_f16_get_buffer_size(const int32_t head_dim)
+{
+    return NN_ATTENTION_Q_TILE * head_dim * sizeof(float32_t);
+}
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+#define ATTENTION_NO_MAX (-256)
+
+// scores[rows][NN_ATTENTION_KV_BLOCK] = q x k^T requantized to int8. The GEMM
+// has no rhs offset term, so a non-zero k_offset runs the plain loops.
+static void attention_scores_s8(const int8_t *q,
+                                const int8_t *k,
+                                int8_t *scores,
+                                const int32_t rows,
+                                const int32_t cols,
+                                const int32_t head_dim,
+                                const int32_t q_offset,
+                                const int32_t k_offset,
+                                const int32_t qk_scale,
+                                const int32_t qk_shift)
+{
+    if (k_offset == 0)
+    {
+        riscv_nn_mat_mult_nt_t_s8_per_tensor(q, k, NULL, scores, qk_scale, qk_shift, rows, cols, head_dim,
+                                             q_offset, 0, Q7_MIN, Q7_MAX, head_dim, NN_ATTENTION_KV_BLOCK);
+        return;
+    }
+
+    for (int32_t i = 0; i < rows; i++)
+    {
+        for (int32_t j = 0; j < cols; j++)
+        {
+            const int8_t *q_ptr = q + i * head_dim;
+            const int8_t *k_ptr = k + j * head_dim;
+            int32_t acc = 0;
+
+            for (int32_t c = 0; c < head_dim; c++)
+            {
+                acc += (q_ptr[c] + q_offset) * (k_ptr[c] + k_offset);
+            }
+            acc = riscv_nn_requantize(acc, qk_scale, qk_shift);
+            scores[i * NN_ATTENTION_KV_BLOCK + j] = (int8_t)riscv_nn_clip_any(acc, (int32_t)Q7_MIN,
+                                                                              (int32_t)Q7_MAX);
+        }
+    }
+}
+
+int32_t riscv_nn_attention_s8_s8_s8(const int8_t * q,
+                                    const int8_t * k,
+                                    const int8_t * v,
+                                    const uint8_t * kv_mask,
+                                    int8_t * dst,
+                                    const int32_t batch,
+                                    const int32_t q_heads,
+                                    const int32_t kv_heads,
+                                    const int32_t q_len,
+                                    const int32_t kv_len,
+                                    const int32_t head_dim,
+                                    const int16_t q_offset,
+                                    const int16_t k_offset,
+                                    const int16_t v_offset,
+                                    const int32_t qk_scale,
+                                    const int32_t qk_shift,
+                                    const int32_t sm_scale,
+                                    const int32_t sm_lshift,
+                                    const int32_t diff_min,
+                                    const int16_t out_offset,
+                                    const int32_t out_scale,
+                                    const int32_t out_shift,
+                                    const int32_t act_min,
+                                    const int32_t act_max,
+                                    const int32_t causal,
+                                    int16_t * tmp_buf)
+{
+    if ((kv_heads <= 0) || (q_heads % kv_heads != 0) || (tmp_buf == NULL))
+    {
+        return -1;
+    }
+
+    const int32_t group = q_heads / kv_heads;
+    // query row i sees the keys up to i + causal_shift, which aligns the last
+    // query with the last key when the keys include earlier context
+    const int32_t causal_shift = kv_len - q_len;
+    // the weighted values of one key block fit 32 bits (Q15 weights times
+    // 9-bit values over NN_ATTENTION_KV_BLOCK keys) and are then added to the
+    // 64-bit row accumulators
+    int64_t *row_acc = (int64_t *)tmp_buf;
+    int32_t *block_acc = (int32_t *)(row_acc + NN_ATTENTION_Q_TILE * head_dim);
+    int32_t lut[256];
+    int8_t scores[NN_ATTENTION_Q_TILE * NN_ATTENTION_KV_BLOCK];
+    int32_t row_max[NN_ATTENTION_Q_TILE];
+    int64_t row_sum[NN_ATTENTION_Q_TILE];
+
+    riscv_nn_attention_exp_lut_s8(lut, 0, 256, sm_scale, sm_lshift, diff_min);
+
+    for (int32_t b = 0; b < batch; b++)
+    {
+        const uint8_t *mask = (kv_mask != NULL) ? kv_mask + b * kv_len : NULL;
+
+        for (int32_t h = 0; h < q_heads; h++)
+        {
+            const int8_t *q_head = q + (b * q_heads + h) * q_len * head_dim;
+            const int8_t *k_head = k + (b * kv_heads + h / group) * kv_len * head_dim;
+            const int8_t *v_head = v + (b * kv_heads + h / group) * kv_len * head_dim;
+            int8_t *dst_head = dst + (b * q_heads + h) * q_len * head_dim;
+
+            for (int32_t row = 0; row < q_len; row += NN_ATTENTION_Q_TILE)
+            {
+                const int32_t rows = MIN(NN_ATTENTION_Q_TILE, q_len - row);
+                const int32_t key_end = causal ? MIN(kv_len, row + rows + causal_shift) : kv_len;
+
+                for (int32_t i = 0; i < rows; i++)
+                {
+                    row_max[i] = ATTENTION_NO_MAX;
+                    row_sum[i] = 0;
+                }
+                memset(row_acc, 0, sizeof(int64_t) * rows * head_dim);
+
+                // online softmax: each key block rescales the running sums
+                // to its new row maximum before its weights are added
+                for (int32_t key = 0; key < key_end; key += NN_ATTENTION_KV_BLOCK)
+                {
+                    const int32_t cols = MIN(NN_ATTENTION_KV_BLOCK, key_end - key);
+
+                    attention_scores_s8(q_head + row * head_dim, k_head + key * head_dim, scores, rows, cols,
+                                        head_dim, q_offset, k_offset, qk_scale, qk_shift);
+
+                    for (int32_t i = 0; i < rows; i++)
+                    {
+                        const int8_t *s = scores + i * NN_ATTENTION_KV_BLOCK;
+                        const int32_t end = causal ? MIN(cols, row + i + causal_shift + 1 - key) : cols;
+                        int64_t *acc = row_acc + i * head_dim;
+                        int32_t max = ATTENTION_NO_MAX;
+
+                        for (int32_t j = 0; j < end; j++)
+                        {
+                            if ((mask == NULL) || mask[key + j])
+                            {
+                                max = MAX(max, s[j]);
+                            }
+                        }
+                        if (max == ATTENTION_NO_MAX)
+                        {
+                            continue;
+                        }
+
+                        if (max > row_max[i])
+                        {
+                            if (row_max[i] != ATTENTION_NO_MAX)
+                            {
+                                const int32_t f = lut[max - row_max[i]];
+
+                                row_sum[i] = (row_sum[i] * f + (1 << 14)) >> 15;
+                                for (int32_t c = 0; c < head_dim; c++)
+                                {
+                                    acc[c] = (acc[c] * f + (1 << 14)) >> 15;
+                                }
+                            }
+                            row_max[i] = max;
+                        }
+
+                        memset(block_acc, 0, sizeof(int32_t) * head_dim);
+                        for (int32_t j = 0; j < end; j++)
+                        {
+                            const int8_t *v_row = v_head + (key + j) * head_dim;
+
+                            // masked keys may score above row_max, so they
+                            // must be skipped before indexing the table
+                            if ((mask != NULL) && !mask[key + j])
+                            {
+                                continue;
+                            }
+
+                            const int32_t e = lut[row_max[i] - s[j]];
+
+                            if (e == 0)
+                            {
+                                continue;
+                            }
+                            row_sum[i] += e;
+                            for (int32_t c = 0; c < head_dim; c++)
+                            {
+                                block_acc[c] += e * (v_row[c] + v_offset);
+                            }
+                        }
+                        for (int32_t c = 0; c < head_dim; c++)
+                        {
+                            acc[c] += block_acc[c];
+                        }
+                    }
+                }
+
+                // dst = (acc / sum) in units of v, requantized; rows without
+                // any visible key produce out_offset
+                for (int32_t i = 0; i < rows; i++)
+                {
+                    const int64_t sum = row_sum[i];
+                    const int64_t *acc = row_acc + i * head_dim;
+                    int8_t *out = dst_head + (row + i) * head_dim;
+
+                    for (int32_t c = 0; c < head_dim; c++)
+                    {
+                        int32_t res = out_offset;
+
+                        if (sum > 0)
+                        {
+                            const int64_t num = acc[c] * 65536;
+                            const int32_t ratio = (int32_t)((num + (num >= 0 ? sum / 2 : -sum / 2)) / sum);
+
+                            res += riscv_nn_requantize(ratio, out_scale, out_shift - 16);
+                        }
+                        res = MAX(res, act_min);
+                        res = MIN(res, act_max);
+                        out[c] = (int8_t)res;
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_attention_s8_s8_s8_get_buffer_size(const int32_t head_dim)
+{
+    return NN_ATTENTION_Q_TILE * head_dim * sizeof(int64_t) + head_dim * sizeof(int32_t);
+}
@@ -57,30 +57,31 @@ int32_t riscv_nn_batch_matmul_s16_s16_s16(const int16_t * in_lhs,
     const int32_t outer_rhs_diff = rhs_dim_n >= lhs_dim_n ? (rhs_rows * rhs_cols) - inner_rhs_diff
                                                                           : -inner_rhs_diff * rhs_dim_h;
 
-    const int32_t reduced_multiplier = REDUCE_MULTIPLIER(out_scale);
+    // see riscv_nn_batch_matmul_s8_s8_s8: matrices sharing one rhs over
+    // contiguous lhs matrices run as one taller GEMM
+    const int16_t *run_lhs = in_lhs;
+    const int16_t *run_rhs = in_rhs;
+    int16_t *run_dst = dst;
+    int32_t run_rows = 0;
 
     for (int i_out_batch = 0; i_out_batch < output_batch; i_out_batch++)
     {
         for (int i_out_height = 0; i_out_height < output_height; i_out_height++)
         {
-            for (int j = 0; j < lhs_rows; j++)
+            if ((in_rhs != run_rhs) || (in_lhs != run_lhs + run_rows * rhs_cols))
             {
-                nn_vec_mat_mult_t_s16_s16_s16(in_lhs,
-                                              in_rhs,
-                                              lhs_offset,
-                                              rhs_offset,
-                                              bias,
-                                              dst,
-                                              out_offset,
-                                              reduced_multiplier,
-                                              out_shift,
-                                              rhs_cols,
-                                              rhs_rows,
-                                              act_min,
-                                              act_max);
-                in_lhs += rhs_cols;
-                dst += rhs_rows;
+                nn_mat_mat_mult_t_s16_s16_s16(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst,
+                                              out_offset, out_scale, out_shift, run_rows, rhs_cols,
+                                              rhs_rows, act_min, act_max);
+                run_lhs = in_lhs;
+                run_rhs = in_rhs;
+                run_dst = dst;
+                run_rows = 0;
             }
+            run_rows += lhs_rows;
+
+            in_lhs += lhs_rows * rhs_cols;
+            dst += lhs_rows * rhs_rows;
             in_lhs -= inner_lhs_diff;
             in_rhs += inner_rhs_diff;
         }
@@ -88,5 +89,8 @@ int32_t riscv_nn_batch_matmul_s16_s16_s16(const int16_t * in_lhs,
         in_rhs += outer_rhs_diff;
     }
 
+    nn_mat_mat_mult_t_s16_s16_s16(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst, out_offset,
+                                  out_scale, out_shift, run_rows, rhs_cols, rhs_rows, act_min, act_max);
+
     return 0;
 }
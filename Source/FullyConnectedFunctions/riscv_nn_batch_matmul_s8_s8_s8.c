@@ -22,6 +22,51 @@
 #include "internal_nn_math.h"
 #include "riscv_nn_support.h"
 
+// lhs_rows x rhs_rows outputs of one rhs matrix. The GEMM core has no rhs
+// offset term, so a non-zero rhs_offset keeps the vector-matrix products.
+static void batch_matmul_rows_s8(const int8_t * lhs,
+                                 const int8_t * rhs,
+                                 const int16_t lhs_offset,
+                                 const int16_t rhs_offset,
+                                 const int32_t * bias,
+                                 int8_t * dst,
+                                 const int16_t out_offset,
+                                 const int32_t out_scale,
+                                 const int32_t out_shift,
+                                 const int32_t lhs_rows,
+                                 const int32_t rhs_rows,
+                                 const int32_t rhs_cols,
+                                 const int32_t act_min,
+                                 const int32_t act_max)
+{
+    if (rhs_offset == 0)
+    {
+        riscv_nn_mat_mult_nt_t_s8_per_tensor(lhs, rhs, bias, dst, out_scale, out_shift, lhs_rows,
+                                             rhs_rows, rhs_cols, lhs_offset, out_offset, act_min,
+                                             act_max, rhs_cols, rhs_rows);
+        return;
+    }
+
+    for (int j = 0; j < lhs_rows; j++)
+    {
+        riscv_nn_vec_mat_mult_t_s8(lhs,
+                                   rhs,
+                                   bias,
+                                   dst,
+                                   lhs_offset,
+                                   rhs_offset,
+                                   out_offset,
+                                   out_scale,
+                                   out_shift,
+                                   rhs_cols,
+                                   rhs_rows,
+                                   act_min,
+                                   act_max);
+        lhs += rhs_cols;
+        dst += rhs_rows;
+    }
+}
+
 int32_t riscv_nn_batch_matmul_s8_s8_s8(const int8_t * in_lhs,
                                        const int8_t * in_rhs,
                                        const int16_t lhs_offset,
@@ -57,36 +102,41 @@ int32_t riscv_nn_batch_matmul_s8_s8_s8(const int8_t * in_lhs,
     const int32_t outer_rhs_diff = rhs_dim_n >= lhs_dim_n ? (rhs_rows * rhs_cols) - inner_rhs_diff
                                                                           : -inner_rhs_diff * rhs_dim_h;
 
+    // Consecutive matrices that broadcast the same rhs over contiguous lhs
+    // matrices form one taller GEMM instead of one call per matrix. The
+    // outputs are always contiguous.
+    const int8_t *run_lhs = in_lhs;
+    const int8_t *run_rhs = in_rhs;
+    int8_t *run_dst = dst;
+    int32_t run_rows = 0;
+
     for (int i_out_batch = 0; i_out_batch < output_batch; i_out_batch++)
     {
         for (int i_out_height = 0; i_out_height < output_height; i_out_height++)
         {
-            for (int j = 0; j < lhs_rows; j++)
+            if ((in_rhs != run_rhs) || (in_lhs != run_lhs + run_rows * rhs_cols))
             {
-                riscv_nn_vec_mat_mult_t_s8(in_lhs,
-                                           in_rhs,
-                                           bias,
-                                           dst,
-                                           lhs_offset,
-                                           rhs_offset,
-                                           out_offset,
-                                           out_scale,
-                                           out_shift,
-                                           rhs_dim_c,
-                                           rhs_rows,
-                                           act_min,
-                                           act_max);
-
-                in_lhs += rhs_cols;
-                dst += rhs_rows;
+                batch_matmul_rows_s8(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst,
+                                     out_offset, out_scale, out_shift, run_rows, rhs_rows, rhs_cols,
+                                     act_min, act_max);
+                run_lhs = in_lhs;
+                run_rhs = in_rhs;
+                run_dst = dst;
+                run_rows = 0;
             }
+            run_rows += lhs_rows;
+
+            in_lhs += lhs_rows * rhs_cols;
+            dst += lhs_rows * rhs_rows;
             in_lhs -= inner_lhs_diff;
             in_rhs += inner_rhs_diff;
-
         }
         in_lhs += outer_lhs_diff;
         in_rhs += outer_rhs_diff;
     }
 
+    batch_matmul_rows_s8(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst, out_offset,
+                         out_scale, out_shift, run_rows, rhs_rows, rhs_cols, act_min, act_max);
+
     return 0;
 }
@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+#define BATCH_MATMUL_RHS_NT_STRIP 32
+
+// lhs_rows x rhs_cols outputs of one non-transposed rhs matrix. The GEMM has
+// no rhs offset term, so a non-zero rhs_offset accumulates column strips.
+static void batch_matmul_rhs_nt_rows_s8(const int8_t * lhs,
+                                        const int8_t * rhs,
+                                        const int16_t lhs_offset,
+                                        const int16_t rhs_offset,
+                                        const int32_t * bias,
+                                        int8_t * dst,
+                                        const int16_t out_offset,
+                                        const int32_t out_scale,
+                                        const int32_t out_shift,
+                                        const int32_t lhs_rows,
+                                        const int32_t rhs_rows,
+                                        const int32_t rhs_cols,
+                                        const int32_t act_min,
+                                        const int32_t act_max)
+{
+    if (rhs_offset == 0)
+    {
+        riscv_nn_mat_mult_nt_nt_s8_per_tensor(lhs, rhs, bias, dst, out_scale, out_shift, lhs_rows,
+                                              rhs_rows, rhs_cols, lhs_offset, out_offset, act_min,
+                                              act_max, rhs_rows, rhs_cols);
+        return;
+    }
+
+    // accumulate a strip of adjacent columns per lhs row so that every rhs
+    // row is read with unit stride
+    for (int i = 0; i < lhs_rows; i++)
+    {
+        for (int col = 0; col < rhs_cols; col += BATCH_MATMUL_RHS_NT_STRIP)
+        {
+            const int32_t cols = MIN(BATCH_MATMUL_RHS_NT_STRIP, rhs_cols - col);
+            const int8_t *rhs_ptr = rhs + col;
+            int32_t acc[BATCH_MATMUL_RHS_NT_STRIP];
+
+            for (int j = 0; j < cols; j++)
+            {
+                acc[j] = bias ? bias[col + j] : 0;
+            }
+            for (int k = 0; k < rhs_rows; k++)
+            {
+                const int32_t lhs_val = lhs[k] + lhs_offset;
+
+                for (int j = 0; j < cols; j++)
+                {
+                    acc[j] += lhs_val * (rhs_ptr[j] + rhs_offset);
+                }
+                rhs_ptr += rhs_cols;
+            }
+            for (int j = 0; j < cols; j++)
+            {
+                int32_t out = riscv_nn_requantize(acc[j], out_scale, out_shift);
+                out += out_offset;
+                out = MAX(out, act_min);
+                out = MIN(out, act_max);
+                dst[col + j] = (int8_t)out;
+            }
+        }
+        lhs += rhs_rows;
+        dst += rhs_cols;
+    }
+}
+
+int32_t riscv_nn_batch_matmul_s8_s8_s8_rhs_nt(const int8_t * in_lhs,
+                                              const int8_t * in_rhs,
+                                              const int16_t lhs_offset,
+                                              const int16_t rhs_offset,
+                                              const int32_t * bias,
+                                              int8_t * dst,
+                                              const int16_t out_offset,
+                                              const int32_t out_scale,
+                                              const int32_t out_shift,
+                                              const int32_t lhs_dim_n,
+                                              const int32_t lhs_dim_h,
+                                              const int32_t lhs_dim_w,
+                                              const int32_t rhs_dim_n,
+                                              const int32_t rhs_dim_h,
+                                              const int32_t rhs_dim_w,
+                                              const int32_t rhs_dim_c,
+                                              const int32_t out_dim_n,
+                                              const int32_t out_dim_h,
+                                              const int32_t act_min,
+                                              const int32_t act_max)
+{
+    const int32_t output_batch = out_dim_n;
+    const int32_t output_height = out_dim_h;
+    const int32_t lhs_rows = lhs_dim_w;
+    const int32_t rhs_rows = rhs_dim_w;
+    const int32_t rhs_cols = rhs_dim_c;
+
+    const int32_t inner_lhs_diff = lhs_dim_h >= rhs_dim_h ? 0 : lhs_rows * rhs_rows;
+    const int32_t inner_rhs_diff = rhs_dim_h >= lhs_dim_h ? rhs_rows * rhs_cols : 0;
+    const int32_t outer_lhs_diff = lhs_dim_n >= rhs_dim_n
+        ? inner_lhs_diff
+        : -((lhs_rows * rhs_rows) - inner_lhs_diff) * lhs_dim_h;
+    const int32_t outer_rhs_diff = rhs_dim_n >= lhs_dim_n ? (rhs_rows * rhs_cols) - inner_rhs_diff
+                                                                          : -inner_rhs_diff * rhs_dim_h;
+
+    // matrices sharing one rhs over contiguous lhs matrices run as one GEMM,
+    // as in riscv_nn_batch_matmul_s8_s8_s8
+    const int8_t *run_lhs = in_lhs;
+    const int8_t *run_rhs = in_rhs;
+    int8_t *run_dst = dst;
+    int32_t run_rows = 0;
+
+    for (int i_out_batch = 0; i_out_batch < output_batch; i_out_batch++)
+    {
+        for (int i_out_height = 0; i_out_height < output_height; i_out_height++)
+        {
+            if ((in_rhs != run_rhs) || (in_lhs != run_lhs + run_rows * rhs_rows))
+            {
+                batch_matmul_rhs_nt_rows_s8(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst,
+                                            out_offset, out_scale, out_shift, run_rows, rhs_rows,
+                                            rhs_cols, act_min, act_max);
+                run_lhs = in_lhs;
+                run_rhs = in_rhs;
+                run_dst = dst;
+                run_rows = 0;
+            }
+            run_rows += lhs_rows;
+
+            in_lhs += lhs_rows * rhs_rows;
+            dst += lhs_rows * rhs_cols;
+            in_lhs -= inner_lhs_diff;
+            in_rhs += inner_rhs_diff;
+        }
+        in_lhs += outer_lhs_diff;
+        in_rhs += outer_rhs_diff;
+    }
+
+    batch_matmul_rhs_nt_rows_s8(run_lhs, run_rhs, lhs_offset, rhs_offset, bias, run_dst, out_offset,
+                                out_scale, out_shift, run_rows, rhs_rows, rhs_cols, act_min, act_max);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include <float.h>
+#include "internal_nn_math.h"
+#include "riscv_nn_types.h"
+
+//// FullyConnected Functions
+
+int32_t riscv_nn_decode_attention_f16(const float16_t * q,
+                                      const riscv_nn_kv_cache_f16 * cache,
+                                      float16_t * dst,
+                                      const int32_t q_heads,
+                                      const float16_t scale,
+                                      float32_t * tmp_buf)
+{
+    if ((cache->kv_heads <= 0) || (q_heads % cache->kv_heads != 0) || (tmp_buf == NULL))
+    {
+        return -1;
+    }
+
+    const int32_t head_dim = cache->head_dim;
+    const int32_t capacity = cache->capacity;
+    const int32_t len = cache->len;
+    const int32_t group = q_heads / cache->kv_heads;
+    const int32_t first = MIN(len, capacity - cache->start);
+    const float32_t scale_f32 = scale;
+    float32_t *acc = tmp_buf;
+    float32_t *scores = acc + head_dim;
+
+    for (int32_t h = 0; h < q_heads; h++)
+    {
+        const float16_t *q_row = q + h * head_dim;
+        const float16_t *k_head = cache->k + (h / group) * capacity * head_dim;
+        const float16_t *v_head = cache->v + (h / group) * capacity * head_dim;
+        float16_t *out = dst + h * head_dim;
+        float32_t max = -FLT_MAX;
+        float32_t sum = 0.0f;
+
+        // two passes over the ring, oldest token first (see
+        // riscv_nn_decode_attention_s8_s8_s8)
+        for (int32_t t = 0; t < len; t++)
+        {
+            const int32_t slot = (t < first) ? cache->start + t : t - first;
+            const float16_t *k_row = k_head + slot * head_dim;
+            float32_t dot = 0.0f;
+
+            for (int32_t c = 0; c < head_dim; c++)
+            {
+                dot += (float32_t)q_row[c] * (float32_t)k_row[c];
+            }
+            scores[t] = dot * scale_f32;
+            max = (scores[t] > max) ? scores[t] : max;
+        }
+
+        memset(acc, 0, sizeof(float32_t) * head_dim);
+        for (int32_t t = 0; t < len; t++)
+        {
+            const int32_t slot = (t < first) ? cache->start + t : t - first;
+            const float16_t *v_row = v_head + slot * head_dim;
+            const float32_t e = exp_f32(scores[t] - max);
+
+            sum += e;
+            for (int32_t c = 0; c < head_dim; c++)
+            {
+                acc[c] += e * (float32_t)v_row[c];
+            }
+        }
+
+        const float32_t inv = (sum > 0.0f) ? 1.0f / sum : 0.0f;
+        for (int32_t c = 0; c < head_dim; c++)
+        {
+            out[c] = (float16_t)(acc[c] * inv);
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_decode_attention_f16_get_buffer_size(const int32_t head_dim,
+                                                      const int32_t capacity)
+{
+    return (head_dim + capacity) * sizeof(float32_t);
+}
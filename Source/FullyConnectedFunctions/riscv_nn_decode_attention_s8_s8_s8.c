@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_types.h"
+
+int32_t riscv_nn_decode_attention_s8_s8_s8(const int8_t * q,
+                                           const riscv_nn_kv_cache_s8 * cache,
+                                           int8_t * dst,
+                                           const int32_t q_heads,
+                                           const int16_t q_offset,
+                                           const int32_t sm_scale,
+                                           const int32_t sm_lshift,
+                                           const int32_t diff_min,
+                                           const int16_t out_offset,
+                                           const int32_t act_min,
+                                           const int32_t act_max,
+                                           int16_t * tmp_buf)
+{
+    if ((cache->kv_heads <= 0) || (q_heads % cache->kv_heads != 0) || (tmp_buf == NULL))
+    {
+        return -1;
+    }
+
+    const int32_t head_dim = cache->head_dim;
+    const int32_t capacity = cache->capacity;
+    const int32_t len = cache->len;
+    const int32_t group = q_heads / cache->kv_heads;
+    // the cached tokens of a head are at most two runs of the ring: from the
+    // oldest slot to the end, then from slot 0
+    const int32_t first = MIN(len, capacity - cache->start);
+    int64_t *acc = (int64_t *)tmp_buf;
+    int32_t *block_acc = (int32_t *)(acc + head_dim);
+    int8_t *scores = (int8_t *)(block_acc + head_dim);
+    // the exponentials are only evaluated up to the largest score range met
+    // so far, since a short cache needs few of them
+    int32_t lut[256];
+    int32_t lut_len = 0;
+
+    for (int32_t h = 0; h < q_heads; h++)
+    {
+        const int32_t kv_h = h / group;
+        const int8_t *q_row = q + h * head_dim;
+        const int8_t *k_head = cache->k + kv_h * capacity * head_dim;
+        const int8_t *v_head = cache->v + kv_h * capacity * head_dim;
+        const riscv_nn_scaling qk = cache->qk_scaling[kv_h];
+        const riscv_nn_scaling out_scaling = cache->out_scaling[kv_h];
+        const int32_t k_offset = (cache->k_offset != NULL) ? cache->k_offset[kv_h] : 0;
+        const int32_t v_offset = (cache->v_offset != NULL) ? cache->v_offset[kv_h] : 0;
+        int8_t *out = dst + h * head_dim;
+        int64_t sum = 0;
+        int32_t max = Q7_MIN;
+        int32_t min = Q7_MAX;
+
+        // scores of every cached token in age order, read in place
+        riscv_nn_vec_mat_mult_t_s8(q_row, k_head + cache->start * head_dim, NULL, scores, q_offset, k_offset, 0,
+                                   qk.multiplier, qk.shift, head_dim, first, Q7_MIN, Q7_MAX);
+        riscv_nn_vec_mat_mult_t_s8(q_row, k_head, NULL, scores + first, q_offset, k_offset, 0,
+                                   qk.multiplier, qk.shift, head_dim, len - first, Q7_MIN, Q7_MAX);
+        for (int32_t t = 0; t < len; t++)
+        {
+            max = MAX(max, scores[t]);
+            min = MIN(min, scores[t]);
+        }
+        if (max - min >= lut_len)
+        {
+            riscv_nn_attention_exp_lut_s8(lut, lut_len, max - min + 1, sm_scale, sm_lshift, diff_min);
+            lut_len = max - min + 1;
+        }
+
+        // the weighted values of NN_ATTENTION_KV_BLOCK tokens fit 32 bits, as
+        // in riscv_nn_attention_s8_s8_s8
+        memset(acc, 0, sizeof(int64_t) * head_dim);
+        for (int32_t t = 0; t < len; t += NN_ATTENTION_KV_BLOCK)
+        {
+            const int32_t end = MIN(len, t + NN_ATTENTION_KV_BLOCK);
+
+            memset(block_acc, 0, sizeof(int32_t) * head_dim);
+            for (int32_t j = t; j < end; j++)
+            {
+                const int32_t slot = (j < first) ? cache->start + j : j - first;
+                const int8_t *v_row = v_head + slot * head_dim;
+                const int32_t e = lut[max - scores[j]];
+
+                if (e == 0)
+                {
+                    continue;
+                }
+                sum += e;
+                for (int32_t c = 0; c < head_dim; c++)
+                {
+                    block_acc[c] += e * (v_row[c] + v_offset);
+                }
+            }
+            for (int32_t c = 0; c < head_dim; c++)
+            {
+                acc[c] += block_acc[c];
+            }
+        }
+
+        for (int32_t c = 0; c < head_dim; c++)
+        {
+            int32_t res = out_offset;
+
+            if (sum > 0)
+            {
+                const int64_t num = acc[c] * 65536;
+                const int32_t ratio = (int32_t)((num + (num >= 0 ? sum / 2 : -sum / 2)) / sum);
+
+                res += riscv_nn_requantize(ratio, out_scaling.multiplier, out_scaling.shift - 16);
+            }
+            res = MAX(res, act_min);
+            res = MIN(res, act_max);
+            out[c] = (int8_t)res;
+        }
+    }
+
+    return 0;
+}
+
+int32_t riscv_nn_decode_attention_s8_s8_s8_get_buffer_size(const int32_t head_dim,
+                                                           const int32_t capacity)
+{
+    return head_dim * (sizeof(int64_t) + sizeof(int32_t)) + capacity;
+}
@@ -40,6 +40,27 @@ int32_t riscv_nn_fc_s8_s8_s8_asym_bias(const int8_t * in_vec,
 {
     (void)tmp_buf;
 
+    if ((in_vec_batch >= NN_FC_GEMM_MIN_BATCH) && (wt_offset == 0))
+    {
+        // all input vectors are the lhs of one GEMM, so every weight row is
+        // loaded once per pair of input vectors instead of once per vector
+        return riscv_nn_mat_mult_nt_t_s8_per_tensor(in_vec,
+                                                    wt_mat,
+                                                    bias,
+                                                    out_vec,
+                                                    out_scale,
+                                                    out_shift,
+                                                    in_vec_batch,
+                                                    wt_mat_row,
+                                                    in_vec_col,
+                                                    in_offset,
+                                                    out_offset,
+                                                    act_min,
+                                                    act_max,
+                                                    in_vec_col,
+                                                    wt_mat_row);
+    }
+
     uint16_t batch_cnt = in_vec_batch;
 
     while (batch_cnt)
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_types.h"
+
+//// FullyConnected Functions
+
+int32_t riscv_nn_kv_cache_f16_init(riscv_nn_kv_cache_f16 * cache,
+                                   float16_t * k_buf,
+                                   float16_t * v_buf,
+                                   const int32_t kv_heads,
+                                   const int32_t head_dim,
+                                   const int32_t capacity)
+{
+    if ((cache == NULL) || (k_buf == NULL) || (v_buf == NULL) || (kv_heads <= 0) || (head_dim <= 0) ||
+        (capacity <= 0))
+    {
+        return -1;
+    }
+
+    cache->k = k_buf;
+    cache->v = v_buf;
+    cache->kv_heads = kv_heads;
+    cache->head_dim = head_dim;
+    cache->capacity = capacity;
+    cache->start = 0;
+    cache->len = 0;
+
+    return 0;
+}
+
+// same ring layout as riscv_nn_kv_cache_s8_append
+int32_t riscv_nn_kv_cache_f16_append(riscv_nn_kv_cache_f16 * cache,
+                                     const float16_t * k,
+                                     const float16_t * v,
+                                     const int32_t tokens)
+{
+    if ((tokens < 0) || (cache->len + tokens > cache->capacity))
+    {
+        return -1;
+    }
+
+    const int32_t head_dim = cache->head_dim;
+    const int32_t capacity = cache->capacity;
+    const int32_t slot = (cache->start + cache->len) % capacity;
+    const int32_t first = MIN(tokens, capacity - slot);
+
+    for (int32_t h = 0; h < cache->kv_heads; h++)
+    {
+        float16_t *k_head = cache->k + h * capacity * head_dim;
+        float16_t *v_head = cache->v + h * capacity * head_dim;
+        const float16_t *k_src = k + h * tokens * head_dim;
+        const float16_t *v_src = v + h * tokens * head_dim;
+
+        memcpy(k_head + slot * head_dim, k_src, sizeof(float16_t) * first * head_dim);
+        memcpy(v_head + slot * head_dim, v_src, sizeof(float16_t) * first * head_dim);
+        memcpy(k_head, k_src + first * head_dim, sizeof(float16_t) * (tokens - first) * head_dim);
+        memcpy(v_head, v_src + first * head_dim, sizeof(float16_t) * (tokens - first) * head_dim);
+    }
+    cache->len += tokens;
+
+    return 0;
+}
+
+int32_t riscv_nn_kv_cache_f16_evict(riscv_nn_kv_cache_f16 * cache,
+                                    const int32_t tokens)
+{
+    if ((tokens < 0) || (tokens > cache->len))
+    {
+        return -1;
+    }
+
+    cache->start = (cache->start + tokens) % cache->capacity;
+    cache->len -= tokens;
+
+    return 0;
+}
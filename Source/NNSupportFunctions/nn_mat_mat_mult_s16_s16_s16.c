@@ -0,0 +1,215 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+__STATIC_FORCEINLINE int16_t mat_mult_out_s16(int64_t val,
+                                              const int64_t *bias,
+                                              const int32_t reduced_multiplier,
+                                              const int32_t shift,
+                                              const int32_t act_min,
+                                              const int32_t act_max)
+{
+    int32_t result;
+
+    if (bias)
+    {
+        val += *bias;
+    }
+    result = riscv_nn_requantize_s64(val, reduced_multiplier, shift);
+    result = MAX(result, act_min);
+    result = MIN(result, act_max);
+    return (int16_t)result;
+}
+
+// dst[lhs_rows][rhs_cols] = lhs[lhs_rows][rhs_rows] x rhs[rhs_rows][rhs_cols]
+// for a non-transposed rhs, rounded as nn_mat_mat_mult_t_s16_s16_s16. Each
+// group of 4 rhs columns is copied into a transposed panel first when it fits
+// NN_MAT_MULT_PANEL_K, so the 2x4 register tile reads unit-stride rows;
+// deeper products read the 4 adjacent rhs values of each row in place.
+int32_t nn_mat_mat_mult_s16_s16_s16(const int16_t *lhs,
+                                    const int16_t *rhs,
+                                    const int32_t lhs_offset,
+                                    const int32_t rhs_offset,
+                                    const int64_t *bias,
+                                    int16_t *dst,
+                                    const int32_t out_offset,
+                                    const int32_t out_scale,
+                                    const int32_t out_shift,
+                                    const int32_t lhs_rows,
+                                    const int32_t rhs_rows,
+                                    const int32_t rhs_cols,
+                                    const int32_t act_min,
+                                    const int32_t act_max)
+{
+    (void)lhs_offset;
+    (void)rhs_offset;
+    (void)out_offset;
+
+    const int32_t reduced_multiplier = REDUCE_MULTIPLIER(out_scale);
+    const int32_t use_panel = rhs_rows <= NN_MAT_MULT_PANEL_K;
+    int16_t panel[4 * NN_MAT_MULT_PANEL_K];
+    int32_t col = 0;
+
+    for (; (col + 4) <= rhs_cols; col += 4)
+    {
+        const int64_t *bias_ptr = bias ? bias + col : NULL;
+        int32_t lhs_rows_idx = 0;
+
+        if (use_panel)
+        {
+            const int16_t *rhs_ptr = rhs + col;
+            int16_t *p0 = panel;
+            int16_t *p1 = p0 + rhs_rows;
+            int16_t *p2 = p1 + rhs_rows;
+            int16_t *p3 = p2 + rhs_rows;
+
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                p0[k] = rhs_ptr[0];
+                p1[k] = rhs_ptr[1];
+                p2[k] = rhs_ptr[2];
+                p3[k] = rhs_ptr[3];
+                rhs_ptr += rhs_cols;
+            }
+
+            for (; (lhs_rows_idx + 2) <= lhs_rows; lhs_rows_idx += 2)
+            {
+                const int16_t *lhs_0 = lhs + lhs_rows_idx * rhs_rows;
+                const int16_t *lhs_1 = lhs_0 + rhs_rows;
+                int16_t *dst_0 = dst + lhs_rows_idx * rhs_cols + col;
+                int16_t *dst_1 = dst_0 + rhs_cols;
+                int64_t acc[8] = {0};
+
+                for (int32_t k = 0; k < rhs_rows; k++)
+                {
+                    const int32_t l0 = lhs_0[k];
+                    const int32_t l1 = lhs_1[k];
+                    const int32_t r0 = p0[k];
+                    const int32_t r1 = p1[k];
+                    const int32_t r2 = p2[k];
+                    const int32_t r3 = p3[k];
+
+                    acc[0] += l0 * r0;
+                    acc[1] += l0 * r1;
+                    acc[2] += l0 * r2;
+                    acc[3] += l0 * r3;
+                    acc[4] += l1 * r0;
+                    acc[5] += l1 * r1;
+                    acc[6] += l1 * r2;
+                    acc[7] += l1 * r3;
+                }
+
+                for (int32_t j = 0; j < 4; j++)
+                {
+                    const int64_t *b = bias_ptr ? bias_ptr + j : NULL;
+                    dst_0[j] = mat_mult_out_s16(acc[j], b, reduced_multiplier, out_shift, act_min, act_max);
+                    dst_1[j] = mat_mult_out_s16(acc[4 + j], b, reduced_multiplier, out_shift, act_min,
+                                                act_max);
+                }
+            }
+        }
+
+        for (; (lhs_rows_idx + 2) <= lhs_rows; lhs_rows_idx += 2)
+        {
+            const int16_t *lhs_0 = lhs + lhs_rows_idx * rhs_rows;
+            const int16_t *lhs_1 = lhs_0 + rhs_rows;
+            const int16_t *rhs_ptr = rhs + col;
+            int16_t *dst_0 = dst + lhs_rows_idx * rhs_cols + col;
+            int16_t *dst_1 = dst_0 + rhs_cols;
+            int64_t acc[8] = {0};
+
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                const int32_t l0 = lhs_0[k];
+                const int32_t l1 = lhs_1[k];
+                const int32_t r0 = rhs_ptr[0];
+                const int32_t r1 = rhs_ptr[1];
+                const int32_t r2 = rhs_ptr[2];
+                const int32_t r3 = rhs_ptr[3];
+
+                acc[0] += l0 * r0;
+                acc[1] += l0 * r1;
+                acc[2] += l0 * r2;
+                acc[3] += l0 * r3;
+                acc[4] += l1 * r0;
+                acc[5] += l1 * r1;
+                acc[6] += l1 * r2;
+                acc[7] += l1 * r3;
+                rhs_ptr += rhs_cols;
+            }
+
+            for (int32_t j = 0; j < 4; j++)
+            {
+                const int64_t *b = bias_ptr ? bias_ptr + j : NULL;
+                dst_0[j] = mat_mult_out_s16(acc[j], b, reduced_multiplier, out_shift, act_min, act_max);
+                dst_1[j] = mat_mult_out_s16(acc[4 + j], b, reduced_multiplier, out_shift, act_min, act_max);
+            }
+        }
+
+        if (lhs_rows_idx < lhs_rows)
+        {
+            const int16_t *lhs_0 = lhs + lhs_rows_idx * rhs_rows;
+            const int16_t *rhs_ptr = rhs + col;
+            int16_t *dst_0 = dst + lhs_rows_idx * rhs_cols + col;
+            int64_t acc[4] = {0};
+
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                const int32_t l0 = lhs_0[k];
+
+                acc[0] += l0 * rhs_ptr[0];
+                acc[1] += l0 * rhs_ptr[1];
+                acc[2] += l0 * rhs_ptr[2];
+                acc[3] += l0 * rhs_ptr[3];
+                rhs_ptr += rhs_cols;
+            }
+
+            for (int32_t j = 0; j < 4; j++)
+            {
+                dst_0[j] = mat_mult_out_s16(acc[j], bias_ptr ? bias_ptr + j : NULL, reduced_multiplier,
+                                            out_shift, act_min, act_max);
+            }
+        }
+    }
+
+    // left-over columns
+    for (; col < rhs_cols; col++)
+    {
+        for (int32_t lhs_rows_idx = 0; lhs_rows_idx < lhs_rows; lhs_rows_idx++)
+        {
+            const int16_t *lhs_0 = lhs + lhs_rows_idx * rhs_rows;
+            const int16_t *rhs_ptr = rhs + col;
+            int64_t acc = 0;
+
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                acc += (int32_t)lhs_0[k] * *rhs_ptr;
+                rhs_ptr += rhs_cols;
+            }
+            dst[lhs_rows_idx * rhs_cols + col] =
+                mat_mult_out_s16(acc, bias ? bias + col : NULL, reduced_multiplier, out_shift, act_min,
+                                 act_max);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+void riscv_nn_attention_exp_lut_s8(int32_t *lut,
+                                   const int32_t first,
+                                   const int32_t last,
+                                   const int32_t scale,
+                                   const int32_t lshift,
+                                   const int32_t diff_min)
+{
+    const int32_t mask = (1 << lshift);
+
+    for (int32_t d = first; d < last; d++)
+    {
+        if (-d >= diff_min)
+        {
+            const int32_t e = EXP_ON_NEG(MUL_SAT(-d * mask, scale));
+            lut[d] = (int32_t)(((int64_t)e + (1 << 15)) >> 16);
+        }
+        else
+        {
+            lut[d] = 0;
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+
+int32_t riscv_nn_conv_HWC_s8_asym_rows(const int8_t * in_tensor,
+                                       const int32_t in_tensor_dim_x,
+                                       const int32_t in_tensor_dim_y,
+                                       const int32_t in_tensor_ch,
+                                       const int8_t * ker_weight,
+                                       const int32_t out_tensor_ch,
+                                       const int32_t ker_dim_x,
+                                       const int32_t ker_dim_y,
+                                       const int32_t ker_ch,
+                                       const int32_t pad_x,
+                                       const int32_t pad_y,
+                                       const int32_t stride_x,
+                                       const int32_t stride_y,
+                                       const int32_t * bias,
+                                       int8_t * out_rows,
+                                       const int32_t * out_shift,
+                                       const int32_t * out_scale,
+                                       const int32_t out_offset,
+                                       const int32_t in_offset,
+                                       const int32_t act_min,
+                                       const int32_t act_max,
+                                       const int32_t out_tensor_dim_x,
+                                       const int32_t row_start,
+                                       const int32_t row_end,
+                                       const int32_t dilation_x,
+                                       const int32_t dilation_y,
+                                       int16_t * in_tmp_buf)
+{
+    // The rows are run as a batch-1 convolution on exactly the input rows
+    // they read, as kernels such as the 1x1 one size their output from the
+    // input height. The top padding of the slice is what remains of pad_y
+    // above its first window; windows past the slice end only reach into the
+    // bottom padding.
+    const int32_t v = stride_y * row_start - pad_y;
+    const int32_t in_start = MAX(v, 0);
+    const int32_t in_end = MIN(stride_y * (row_end - 1) - pad_y + (ker_dim_y - 1) * dilation_y + 1,
+                               in_tensor_dim_y);
+
+    return riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(in_tensor + in_start * in_tensor_dim_x * in_tensor_ch,
+                in_tensor_dim_x,
+                in_end - in_start,
+                in_tensor_ch,
+                1,
+                ker_weight,
+                out_tensor_ch,
+                ker_dim_x,
+                ker_dim_y,
+                ker_ch,
+                pad_x,
+                in_start - v,
+                stride_x,
+                stride_y,
+                bias,
+                out_rows,
+                out_shift,
+                out_scale,
+                out_offset,
+                in_offset,
+                act_min,
+                act_max,
+                out_tensor_dim_x,
+                row_end - row_start,
+                dilation_x,
+                dilation_y,
+                in_tmp_buf);
+}
+
+int32_t riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(const int32_t in_tensor_dim_x,
+                                                       const int32_t in_tensor_dim_y,
+                                                       const int32_t in_tensor_ch,
+                                                       const int32_t ker_dim_x,
+                                                       const int32_t ker_dim_y,
+                                                       const int32_t ker_ch,
+                                                       const int32_t pad_x,
+                                                       const int32_t pad_y,
+                                                       const int32_t stride_x,
+                                                       const int32_t stride_y,
+                                                       const int32_t out_tensor_dim_x,
+                                                       const int32_t out_tensor_dim_y,
+                                                       const int32_t out_tensor_ch,
+                                                       const int32_t dilation_x,
+                                                       const int32_t dilation_y)
+{
+    // a one-row slice may take the 1xn route of the wrapper
+    int32_t size = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_dim_x,
+                        in_tensor_dim_y, in_tensor_ch, 1, ker_dim_x, ker_dim_y, ker_ch,
+                        pad_x, pad_y, stride_x, stride_y, out_tensor_dim_x, out_tensor_dim_y,
+                        out_tensor_ch, dilation_x, dilation_y);
+    int32_t size_row = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_dim_x,
+                        1, in_tensor_ch, 1, ker_dim_x, ker_dim_y, ker_ch,
+                        pad_x, 0, stride_x, stride_y, out_tensor_dim_x, 1,
+                        out_tensor_ch, dilation_x, dilation_y);
+
+    return (MAX(size, size_row) + 3) & ~3;
+}
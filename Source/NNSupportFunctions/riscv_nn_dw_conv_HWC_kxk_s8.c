@@ -0,0 +1,246 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+//// Support Functions
+
+// One output channel of one output pixel whose kernel taps are clipped to
+// [ker_x_start, ker_x_end) x [ker_y_start, ker_y_end) by the padding.
+static inline int32_t dw_kxk_pixel(const int8_t * in_ptr,
+                                   const int8_t * ker_ptr,
+                                   const int32_t row_size,
+                                   const int32_t in_ch,
+                                   const int32_t ker_size,
+                                   const int32_t ker_x_start,
+                                   const int32_t ker_x_end,
+                                   const int32_t ker_y_start,
+                                   const int32_t ker_y_end,
+                                   const int32_t in_offset,
+                                   int32_t acc)
+{
+    for (int32_t ker_y = ker_y_start; ker_y < ker_y_end; ker_y++)
+    {
+        const int8_t * in_row = in_ptr + ker_y * row_size;
+        const int8_t * ker_row = ker_ptr + ker_y * ker_size * in_ch;
+
+        for (int32_t ker_x = ker_x_start; ker_x < ker_x_end; ker_x++)
+        {
+            acc += (in_row[ker_x * in_ch] + in_offset) * ker_row[ker_x * in_ch];
+        }
+    }
+    return acc;
+}
+
+// Four horizontally adjacent output pixels of one channel, all of whose taps
+// are inside the input horizontally. Each kernel row is loaded once into
+// registers and, at stride 1, each input once for the up to four windows
+// that contain it.
+static inline __attribute__((always_inline)) void dw_kxk_block4(const int8_t * in_ptr,
+                                                                const int8_t * ker_ptr,
+                                                                const int32_t row_size,
+                                                                const int32_t in_ch,
+                                                                const int32_t ker_size,
+                                                                const int32_t stride_x,
+                                                                const int32_t ker_y_start,
+                                                                const int32_t ker_y_end,
+                                                                const int32_t in_offset,
+                                                                int32_t * acc)
+{
+    int32_t acc0 = acc[0], acc1 = acc[1], acc2 = acc[2], acc3 = acc[3];
+
+    for (int32_t ker_y = ker_y_start; ker_y < ker_y_end; ker_y++)
+    {
+        const int8_t * in_row = in_ptr + ker_y * row_size;
+        const int8_t * ker_row = ker_ptr + ker_y * ker_size * in_ch;
+        int32_t w[7];
+
+        for (int32_t ker_x = 0; ker_x < ker_size; ker_x++)
+        {
+            w[ker_x] = ker_row[ker_x * in_ch];
+        }
+
+        if (stride_x == 1)
+        {
+            for (int32_t t = 0; t < ker_size + 3; t++)
+            {
+                const int32_t v = in_row[t * in_ch] + in_offset;
+
+                if (t < ker_size)
+                {
+                    acc0 += v * w[t];
+                }
+                if ((t >= 1) && (t - 1 < ker_size))
+                {
+                    acc1 += v * w[t - 1];
+                }
+                if ((t >= 2) && (t - 2 < ker_size))
+                {
+                    acc2 += v * w[t - 2];
+                }
+                if (t >= 3)
+                {
+                    acc3 += v * w[t - 3];
+                }
+            }
+        }
+        else
+        {
+            const int32_t step = stride_x * in_ch;
+
+            for (int32_t ker_x = 0; ker_x < ker_size; ker_x++)
+            {
+                const int8_t * in_tap = in_row + ker_x * in_ch;
+
+                acc0 += (in_tap[0]        + in_offset) * w[ker_x];
+                acc1 += (in_tap[step]     + in_offset) * w[ker_x];
+                acc2 += (in_tap[2 * step] + in_offset) * w[ker_x];
+                acc3 += (in_tap[3 * step] + in_offset) * w[ker_x];
+            }
+        }
+    }
+
+    acc[0] = acc0;
+    acc[1] = acc1;
+    acc[2] = acc2;
+    acc[3] = acc3;
+}
+
+static inline __attribute__((always_inline)) void dw_kxk_s8(const int8_t * in_tensor,
+                                                            const int32_t in_tensor_dim_x,
+                                                            const int32_t in_tensor_dim_y,
+                                                            const int32_t in_tensor_ch,
+                                                            const int8_t * ker_weight,
+                                                            const int32_t ker_size,
+                                                            const int32_t pad_x,
+                                                            const int32_t pad_y,
+                                                            const int32_t stride_x,
+                                                            const int32_t stride_y,
+                                                            const int32_t * bias,
+                                                            int8_t * out_tensor,
+                                                            const int32_t * out_shift,
+                                                            const int32_t * out_scale,
+                                                            const int32_t out_tensor_dim_x,
+                                                            const int32_t out_tensor_dim_y,
+                                                            const int32_t out_offset,
+                                                            const int32_t in_offset,
+                                                            const int32_t act_min,
+                                                            const int32_t act_max)
+{
+    const int32_t row_size = in_tensor_dim_x * in_tensor_ch;
+
+    // output columns [out_x_lo, out_x_hi) have all their taps inside the
+    // input horizontally
+    const int32_t out_x_lo = MIN((pad_x + stride_x - 1) / stride_x, out_tensor_dim_x);
+    const int32_t out_x_hi = (in_tensor_dim_x + pad_x < ker_size) ? out_x_lo :
+                             MAX(out_x_lo, MIN((in_tensor_dim_x + pad_x - ker_size) / stride_x + 1, out_tensor_dim_x));
+
+    for (int32_t out_y = 0; out_y < out_tensor_dim_y; out_y++)
+    {
+        const int32_t in_y = out_y * stride_y - pad_y;
+        const int32_t ker_y_start = MAX(0, -in_y);
+        const int32_t ker_y_end = MIN(ker_size, in_tensor_dim_y - in_y);
+        int8_t * out_row = out_tensor + out_y * out_tensor_dim_x * in_tensor_ch;
+        int32_t out_x = 0;
+
+        while (out_x < out_tensor_dim_x)
+        {
+            const int32_t in_x = out_x * stride_x - pad_x;
+            const int8_t * in_ptr = in_tensor + in_y * row_size + in_x * in_tensor_ch;
+
+            if ((out_x >= out_x_lo) && (out_x + 4 <= out_x_hi))
+            {
+                for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+                {
+                    const int32_t b = (bias != NULL) ? bias[ch] : 0;
+                    int32_t acc[4] = {b, b, b, b};
+
+                    dw_kxk_block4(in_ptr + ch, ker_weight + ch, row_size, in_tensor_ch, ker_size, stride_x,
+                                  ker_y_start, ker_y_end, in_offset, acc);
+
+                    for (int32_t i = 0; i < 4; i++)
+                    {
+                        int32_t val = riscv_nn_requantize(acc[i], out_scale[ch], out_shift[ch]);
+                        val += out_offset;
+                        out_row[(out_x + i) * in_tensor_ch + ch] = (int8_t)MIN(MAX(val, act_min), act_max);
+                    }
+                }
+                out_x += 4;
+            }
+            else
+            {
+                const int32_t ker_x_start = MAX(0, -in_x);
+                const int32_t ker_x_end = MIN(ker_size, in_tensor_dim_x - in_x);
+
+                for (int32_t ch = 0; ch < in_tensor_ch; ch++)
+                {
+                    int32_t val = dw_kxk_pixel(in_ptr + ch, ker_weight + ch, row_size, in_tensor_ch,
+                                               ker_size, ker_x_start, ker_x_end, ker_y_start, ker_y_end,
+                                               in_offset, (bias != NULL) ? bias[ch] : 0);
+
+                    val = riscv_nn_requantize(val, out_scale[ch], out_shift[ch]);
+                    val += out_offset;
+                    out_row[out_x * in_tensor_ch + ch] = (int8_t)MIN(MAX(val, act_min), act_max);
+                }
+                out_x++;
+            }
+        }
+    }
+}
+
+int32_t riscv_nn_dw_conv_HWC_kxk_s8(const int8_t * in_tensor,
+                                    const int32_t in_tensor_dim_x,
+                                    const int32_t in_tensor_dim_y,
+                                    const int32_t in_tensor_ch,
+                                    const int8_t * ker_weight,
+                                    const int32_t ker_size,
+                                    const int32_t pad_x,
+                                    const int32_t pad_y,
+                                    const int32_t stride_x,
+                                    const int32_t stride_y,
+                                    const int32_t * bias,
+                                    int8_t * out_tensor,
+                                    const int32_t * out_shift,
+                                    const int32_t * out_scale,
+                                    const int32_t out_tensor_dim_x,
+                                    const int32_t out_tensor_dim_y,
+                                    const int32_t out_offset,
+                                    const int32_t in_offset,
+                                    const int32_t act_min,
+                                    const int32_t act_max)
+{
+    // the kernel size is made a constant for the compiler to unroll the taps
+    switch (ker_size)
+    {
+    case 5:
+        dw_kxk_s8(in_tensor, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_weight, 5, pad_x, pad_y,
+                  stride_x, stride_y, bias, out_tensor, out_shift, out_scale, out_tensor_dim_x,
+                  out_tensor_dim_y, out_offset, in_offset, act_min, act_max);
+        return 0;
+    case 7:
+        dw_kxk_s8(in_tensor, in_tensor_dim_x, in_tensor_dim_y, in_tensor_ch, ker_weight, 7, pad_x, pad_y,
+                  stride_x, stride_y, bias, out_tensor, out_shift, out_scale, out_tensor_dim_x,
+                  out_tensor_dim_y, out_offset, in_offset, act_min, act_max);
+        return 0;
+    default:
+        return -1;
+    }
+}
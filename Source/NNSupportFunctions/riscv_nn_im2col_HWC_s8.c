@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+
+void riscv_nn_im2col_HWC_s8(const int8_t * in_tensor,
+                            const int32_t in_tensor_dim_x,
+                            const int32_t in_tensor_dim_y,
+                            const int32_t in_tensor_ch,
+                            const int32_t ker_dim_x,
+                            const int32_t ker_dim_y,
+                            const int32_t ker_ch,
+                            const int32_t base_idx_x,
+                            const int32_t base_idx_y,
+                            const int32_t dilation_x,
+                            const int32_t dilation_y,
+                            const int8_t pad_val,
+                            int8_t * col)
+{
+    for (int32_t i_ker_y = 0; i_ker_y < ker_dim_y; i_ker_y++)
+    {
+        const int32_t in_row = base_idx_y + dilation_y * i_ker_y;
+
+        for (int32_t i_ker_x = 0; i_ker_x < ker_dim_x; i_ker_x++)
+        {
+            const int32_t in_col = base_idx_x + dilation_x * i_ker_x;
+
+            if (in_row < 0 || in_row >= in_tensor_dim_y || in_col < 0 || in_col >= in_tensor_dim_x)
+            {
+                memset(col, pad_val, ker_ch);
+            }
+            else
+            {
+                memcpy(col, in_tensor + (in_row * in_tensor_dim_x + in_col) * in_tensor_ch, ker_ch);
+            }
+            col += ker_ch;
+        }
+    }
+}
@@ -18,44 +18,126 @@
  ******************************************************************************/
 
 #include "internal_nn_math.h"
+#include "riscv_nn_support.h"
 
-int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
-                                   const q7_t *rhs,
-                                   const q31_t *bias,
-                                   q7_t *dst,
-                                   const int32_t *dst_multipliers,
-                                   const int32_t *dst_shifts,
-                                   const int32_t lhs_rows,
-                                   const int32_t rhs_rows,
-                                   const int32_t rhs_cols,
-                                   const int32_t lhs_offset,    //value is in the range of [-127, 128]
-                                   const int32_t dst_offset,    //value is in the range of [-128, 127]
-                                   const int32_t activation_min,
-                                   const int32_t activation_max,
-                                   const int32_t lhs_cols_offset)
+// rhs rows per riscv_nn_mat_mult_nt_t_s8_core call in
+// riscv_nn_mat_mult_nt_t_s8_per_tensor
+#define MAT_MULT_PER_TENSOR_ROWS 64
+
+// lhs rows of the register tile on packed panels when the shape picks it. The
+// 4x4 tile keeps its 16 accumulators in registers on RV32; the 32 of the 8x4
+// tile do not fit, so it runs only when a caller asks for it.
+#define MAT_MULT_TILE_ROWS 4
+
+// Requantize one accumulator and clamp it to the activation range.
+__STATIC_FORCEINLINE q7_t mat_mult_out_s8(q31_t val,
+                                          const int32_t dst_multiplier,
+                                          const int32_t dst_shift,
+                                          const int32_t dst_offset,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max)
 {
-    for (int32_t rhs_rows_idx = 0; (rhs_rows_idx + 2) <= rhs_rows; rhs_rows_idx += 2)
-    {
-        const q7_t *lhs_ptr = &lhs[0];
-        q7_t       *dst_ptr = &dst[0];
+    val = riscv_nn_requantize(val, dst_multiplier, dst_shift);
+    val += dst_offset;
+    val = MAX(val, activation_min);
+    val = MIN(val, activation_max);
+    return (q7_t)val;
+}
+
+// Requantize one accumulator as mat_mult_out_s8 and add the residual element
+// res to it as riscv_nn_ew_add_s8_asym does, with the product as in_vec1.
+__STATIC_FORCEINLINE q7_t mat_mult_out_add_s8(const q31_t val,
+                                              const int32_t dst_multiplier,
+                                              const int32_t dst_shift,
+                                              const int32_t dst_offset,
+                                              const int32_t activation_min,
+                                              const int32_t activation_max,
+                                              const riscv_nn_residual_add_params *residual,
+                                              const q7_t res)
+{
+    q31_t in1 = mat_mult_out_s8(val, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+    q31_t in2 = res;
+    q31_t out;
+
+    in1 = (in1 + residual->layer_offset) << residual->lshift;
+    in2 = (in2 + residual->in_offset) << residual->lshift;
+    in1 = riscv_nn_requantize_ns(in1, residual->layer_scale, -residual->layer_rshift);
+    in2 = riscv_nn_requantize_ns(in2, residual->in_scale, -residual->in_rshift);
+
+    out = riscv_nn_requantize_ns(in1 + in2, residual->out_scale, -residual->out_rshift);
+    out += residual->out_offset;
+    out = MAX(out, residual->act_min);
+    out = MIN(out, residual->act_max);
+    return (q7_t)out;
+}
 
-        q31_t lhs_offset_contribution0 = 0;
-        q31_t lhs_offset_contribution1 = 0;
+// Return bias[idx] + lhs_offset * sum(rhs_row) for one rhs row, or
+// contri_buf[idx] when the caller has precomputed it.
+__STATIC_FORCEINLINE q31_t mat_mult_contribution_s8(const q7_t *rhs_row,
+                                                    const int32_t *bias,
+                                                    const int32_t *contri_buf,
+                                                    const int32_t idx,
+                                                    const int32_t rhs_cols,
+                                                    const int32_t lhs_offset)
+{
+    q31_t contribution = 0;
+
+    if (contri_buf != NULL)
+    {
+        return contri_buf[idx];
+    }
 
+    // The pass over the weights is skipped when the caller has already
+    // folded the offset into the bias (see riscv_nn_kernel_sum_s8).
+    if (lhs_offset != 0)
+    {
         for (int32_t x = 0; x < rhs_cols; ++x)
         {
-            lhs_offset_contribution0 += rhs[x];
-            lhs_offset_contribution1 += rhs[x + rhs_cols];
+            contribution += rhs_row[x];
         }
+        contribution *= lhs_offset;
+    }
+    if (bias != NULL)
+    {
+        contribution += bias[idx];
+    }
+    return contribution;
+}
 
-        lhs_offset_contribution0 *= lhs_offset;
-        lhs_offset_contribution1 *= lhs_offset;
+// 2 lhs rows x 2 rhs rows per inner loop. Used for small shapes and for the
+// rhs rows left over by the 4-row panels.
+static void mat_mult_nt_t_s8_2x2(const q7_t *lhs,
+                                 const q7_t *rhs,
+                                 const q31_t *bias,
+                                 q7_t *dst,
+                                 const int32_t *dst_multipliers,
+                                 const int32_t *dst_shifts,
+                                 const int32_t lhs_rows,
+                                 const int32_t rhs_rows,
+                                 const int32_t rhs_cols,
+                                 const int32_t lhs_offset,
+                                 const int32_t dst_offset,
+                                 const int32_t activation_min,
+                                 const int32_t activation_max,
+                                 const int32_t lhs_cols_offset,
+                                 const int32_t dst_stride,
+                                 const int32_t *contri_buf)
+{
+    int32_t rhs_rows_idx;
 
-        if (bias != NULL)
-        {
-            lhs_offset_contribution0 += bias[rhs_rows_idx];
-            lhs_offset_contribution1 += bias[rhs_rows_idx + 1];
-        }
+    for (rhs_rows_idx = 0; (rhs_rows_idx + 2) <= rhs_rows; rhs_rows_idx += 2)
+    {
+        const q7_t *lhs_ptr = &lhs[0];
+        q7_t       *dst_ptr = &dst[0];
+        const int32_t mult0 = dst_multipliers[rhs_rows_idx];
+        const int32_t mult1 = dst_multipliers[rhs_rows_idx + 1];
+        const int32_t shift0 = dst_shifts[rhs_rows_idx];
+        const int32_t shift1 = dst_shifts[rhs_rows_idx + 1];
+
+        const q31_t lhs_offset_contribution0 =
+            mat_mult_contribution_s8(rhs, bias, contri_buf, rhs_rows_idx, rhs_cols, lhs_offset);
+        const q31_t lhs_offset_contribution1 =
+            mat_mult_contribution_s8(rhs + rhs_cols, bias, contri_buf, rhs_rows_idx + 1, rhs_cols, lhs_offset);
 
         int32_t lhs_rows_idx = lhs_rows >> 1;
 
@@ -85,34 +167,12 @@ int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                 ++lhs_ptr;
             }
 
-            // Quantize down
-            res00 = riscv_nn_requantize(res00, dst_multipliers[rhs_rows_idx],     dst_shifts[rhs_rows_idx]);
-            res01 = riscv_nn_requantize(res01, dst_multipliers[rhs_rows_idx + 1], dst_shifts[rhs_rows_idx + 1]);
-            res10 = riscv_nn_requantize(res10, dst_multipliers[rhs_rows_idx],     dst_shifts[rhs_rows_idx]);
-            res11 = riscv_nn_requantize(res11, dst_multipliers[rhs_rows_idx + 1], dst_shifts[rhs_rows_idx + 1]);
-
-            // Add offset
-            res00 += dst_offset;
-            res01 += dst_offset;
-            res10 += dst_offset;
-            res11 += dst_offset;
-
-            // Clamp the result
-            res00 = MAX(res00, activation_min);
-            res00 = MIN(res00, activation_max);
-            res01 = MAX(res01, activation_min);
-            res01 = MIN(res01, activation_max);
-            res10 = MAX(res10, activation_min);
-            res10 = MIN(res10, activation_max);
-            res11 = MAX(res11, activation_min);
-            res11 = MIN(res11, activation_max);
-
-            dst_ptr[0] = (q7_t)res00;
-            dst_ptr[1] = (q7_t)res01;
-            dst_ptr += rhs_rows;
-            dst_ptr[0] = (q7_t)res10;
-            dst_ptr[1] = (q7_t)res11;
-            dst_ptr += rhs_rows;
+            dst_ptr[0] = mat_mult_out_s8(res00, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = mat_mult_out_s8(res01, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr += dst_stride;
+            dst_ptr[0] = mat_mult_out_s8(res10, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = mat_mult_out_s8(res11, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr += dst_stride;
 
             lhs_ptr -= rhs_cols;
             lhs_ptr += 2 * lhs_cols_offset;
@@ -141,22 +201,8 @@ int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                 ++lhs_ptr;
             }
 
-            // Quantize down
-            res00 = riscv_nn_requantize(res00, dst_multipliers[rhs_rows_idx],     dst_shifts[rhs_rows_idx]);
-            res01 = riscv_nn_requantize(res01, dst_multipliers[rhs_rows_idx + 1], dst_shifts[rhs_rows_idx + 1]);
-
-            // Add offset
-            res00 += dst_offset;
-            res01 += dst_offset;
-
-            // Clamp the result
-            res00 = MAX(res00, activation_min);
-            res00 = MIN(res00, activation_max);
-            res01 = MAX(res01, activation_min);
-            res01 = MIN(res01, activation_max);
-
-            dst_ptr[0] = (q7_t)res00;
-            dst_ptr[1] = (q7_t)res01;
+            dst_ptr[0] = mat_mult_out_s8(res00, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = mat_mult_out_s8(res01, mult1, shift1, dst_offset, activation_min, activation_max);
         }
 
         rhs += 2 * rhs_cols;
@@ -167,47 +213,951 @@ int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
     {
         const q7_t *lhs_ptr = &lhs[0];
         q7_t *dst_ptr = &dst[0];
+        const q31_t lhs_offset_contribution0 =
+            mat_mult_contribution_s8(rhs, bias, contri_buf, rhs_rows_idx, rhs_cols, lhs_offset);
 
         for (int32_t lhs_rows_idx = 0; lhs_rows_idx < lhs_rows; ++lhs_rows_idx)
         {
-            const q7_t *rhs_ptr = &rhs[0];
-            q31_t res00 = 0;
-            if (bias != NULL)
+            q31_t res00 = lhs_offset_contribution0;
+
+            for (int32_t rhs_cols_idx = 0; rhs_cols_idx < rhs_cols; ++rhs_cols_idx)
             {
-                res00 = bias[rhs_rows - 1];
+                res00 += (q31_t)lhs_ptr[rhs_cols_idx] * rhs[rhs_cols_idx];
             }
 
-            for (int32_t rhs_cols_idx = 0; rhs_cols_idx < rhs_cols; ++rhs_cols_idx)
+            dst_ptr[0] = mat_mult_out_s8(res00, dst_multipliers[rhs_rows_idx], dst_shifts[rhs_rows_idx],
+                                         dst_offset, activation_min, activation_max);
+            dst_ptr += dst_stride;
+            lhs_ptr += lhs_cols_offset;
+        }
+    }
+}
+
+// Interleave kc columns of 4 consecutive rhs rows so that the micro-kernels
+// read the 4 weights of one column with a single contiguous access:
+// panel[4 * k + j] = rhs[j][k]. rhs[j][k] is at j * row_stride + k * col_stride,
+// so a non-transposed rhs (row_stride 1) is packed from the same code.
+static void mat_mult_pack_panel_s8(const q7_t *rhs,
+                                   const int32_t row_stride,
+                                   const int32_t col_stride,
+                                   const int32_t kc,
+                                   q7_t *panel)
+{
+    const q7_t *rhs0 = rhs;
+    const q7_t *rhs1 = rhs + row_stride;
+    const q7_t *rhs2 = rhs + 2 * row_stride;
+    const q7_t *rhs3 = rhs + 3 * row_stride;
+
+    for (int32_t k = 0; k < kc; ++k)
+    {
+        panel[0] = *rhs0;
+        panel[1] = *rhs1;
+        panel[2] = *rhs2;
+        panel[3] = *rhs3;
+        rhs0 += col_stride;
+        rhs1 += col_stride;
+        rhs2 += col_stride;
+        rhs3 += col_stride;
+        panel += 4;
+    }
+}
+
+// acc[4 * i + j] += sum(lhs[i][k] * panel[4 * k + j]) for k < kc and the 8 lhs
+// rows of the tile.
+__STATIC_FORCEINLINE void mat_mult_kernel_8x4(const q7_t *lhs,
+                                              const int32_t lhs_stride,
+                                              const q7_t *panel,
+                                              const int32_t kc,
+                                              q31_t *acc)
+{
+    const q7_t *lhs0 = lhs;
+    const q7_t *lhs1 = lhs + lhs_stride;
+    const q7_t *lhs2 = lhs + 2 * lhs_stride;
+    const q7_t *lhs3 = lhs + 3 * lhs_stride;
+    const q7_t *lhs4 = lhs + 4 * lhs_stride;
+    const q7_t *lhs5 = lhs + 5 * lhs_stride;
+    const q7_t *lhs6 = lhs + 6 * lhs_stride;
+    const q7_t *lhs7 = lhs + 7 * lhs_stride;
+    q31_t res00 = acc[0];
+    q31_t res01 = acc[1];
+    q31_t res02 = acc[2];
+    q31_t res03 = acc[3];
+    q31_t res10 = acc[4];
+    q31_t res11 = acc[5];
+    q31_t res12 = acc[6];
+    q31_t res13 = acc[7];
+    q31_t res20 = acc[8];
+    q31_t res21 = acc[9];
+    q31_t res22 = acc[10];
+    q31_t res23 = acc[11];
+    q31_t res30 = acc[12];
+    q31_t res31 = acc[13];
+    q31_t res32 = acc[14];
+    q31_t res33 = acc[15];
+    q31_t res40 = acc[16];
+    q31_t res41 = acc[17];
+    q31_t res42 = acc[18];
+    q31_t res43 = acc[19];
+    q31_t res50 = acc[20];
+    q31_t res51 = acc[21];
+    q31_t res52 = acc[22];
+    q31_t res53 = acc[23];
+    q31_t res60 = acc[24];
+    q31_t res61 = acc[25];
+    q31_t res62 = acc[26];
+    q31_t res63 = acc[27];
+    q31_t res70 = acc[28];
+    q31_t res71 = acc[29];
+    q31_t res72 = acc[30];
+    q31_t res73 = acc[31];
+
+    for (int32_t k = 0; k < kc; ++k)
+    {
+        const q31_t rhs_value0 = panel[0];
+        const q31_t rhs_value1 = panel[1];
+        const q31_t rhs_value2 = panel[2];
+        const q31_t rhs_value3 = panel[3];
+        q31_t lhs_value;
+
+        lhs_value = lhs0[k];
+        res00 += lhs_value * rhs_value0;
+        res01 += lhs_value * rhs_value1;
+        res02 += lhs_value * rhs_value2;
+        res03 += lhs_value * rhs_value3;
+
+        lhs_value = lhs1[k];
+        res10 += lhs_value * rhs_value0;
+        res11 += lhs_value * rhs_value1;
+        res12 += lhs_value * rhs_value2;
+        res13 += lhs_value * rhs_value3;
+
+        lhs_value = lhs2[k];
+        res20 += lhs_value * rhs_value0;
+        res21 += lhs_value * rhs_value1;
+        res22 += lhs_value * rhs_value2;
+        res23 += lhs_value * rhs_value3;
+
+        lhs_value = lhs3[k];
+        res30 += lhs_value * rhs_value0;
+        res31 += lhs_value * rhs_value1;
+        res32 += lhs_value * rhs_value2;
+        res33 += lhs_value * rhs_value3;
+
+        lhs_value = lhs4[k];
+        res40 += lhs_value * rhs_value0;
+        res41 += lhs_value * rhs_value1;
+        res42 += lhs_value * rhs_value2;
+        res43 += lhs_value * rhs_value3;
+
+        lhs_value = lhs5[k];
+        res50 += lhs_value * rhs_value0;
+        res51 += lhs_value * rhs_value1;
+        res52 += lhs_value * rhs_value2;
+        res53 += lhs_value * rhs_value3;
+
+        lhs_value = lhs6[k];
+        res60 += lhs_value * rhs_value0;
+        res61 += lhs_value * rhs_value1;
+        res62 += lhs_value * rhs_value2;
+        res63 += lhs_value * rhs_value3;
+
+        lhs_value = lhs7[k];
+        res70 += lhs_value * rhs_value0;
+        res71 += lhs_value * rhs_value1;
+        res72 += lhs_value * rhs_value2;
+        res73 += lhs_value * rhs_value3;
+
+        panel += 4;
+    }
+
+    acc[0] = res00;
+    acc[1] = res01;
+    acc[2] = res02;
+    acc[3] = res03;
+    acc[4] = res10;
+    acc[5] = res11;
+    acc[6] = res12;
+    acc[7] = res13;
+    acc[8] = res20;
+    acc[9] = res21;
+    acc[10] = res22;
+    acc[11] = res23;
+    acc[12] = res30;
+    acc[13] = res31;
+    acc[14] = res32;
+    acc[15] = res33;
+    acc[16] = res40;
+    acc[17] = res41;
+    acc[18] = res42;
+    acc[19] = res43;
+    acc[20] = res50;
+    acc[21] = res51;
+    acc[22] = res52;
+    acc[23] = res53;
+    acc[24] = res60;
+    acc[25] = res61;
+    acc[26] = res62;
+    acc[27] = res63;
+    acc[28] = res70;
+    acc[29] = res71;
+    acc[30] = res72;
+    acc[31] = res73;
+}
+
+// acc[4 * i + j] += sum(lhs[i][k] * panel[4 * k + j]) for k < kc and the 4 lhs
+// rows of the tile.
+__STATIC_FORCEINLINE void mat_mult_kernel_4x4(const q7_t *lhs,
+                                              const int32_t lhs_stride,
+                                              const q7_t *panel,
+                                              const int32_t kc,
+                                              q31_t *acc)
+{
+    const q7_t *lhs0 = lhs;
+    const q7_t *lhs1 = lhs + lhs_stride;
+    const q7_t *lhs2 = lhs + 2 * lhs_stride;
+    const q7_t *lhs3 = lhs + 3 * lhs_stride;
+    q31_t res00 = acc[0];
+    q31_t res01 = acc[1];
+    q31_t res02 = acc[2];
+    q31_t res03 = acc[3];
+    q31_t res10 = acc[4];
+    q31_t res11 = acc[5];
+    q31_t res12 = acc[6];
+    q31_t res13 = acc[7];
+    q31_t res20 = acc[8];
+    q31_t res21 = acc[9];
+    q31_t res22 = acc[10];
+    q31_t res23 = acc[11];
+    q31_t res30 = acc[12];
+    q31_t res31 = acc[13];
+    q31_t res32 = acc[14];
+    q31_t res33 = acc[15];
+
+    for (int32_t k = 0; k < kc; ++k)
+    {
+        const q31_t rhs_value0 = panel[0];
+        const q31_t rhs_value1 = panel[1];
+        const q31_t rhs_value2 = panel[2];
+        const q31_t rhs_value3 = panel[3];
+        q31_t lhs_value;
+
+        lhs_value = lhs0[k];
+        res00 += lhs_value * rhs_value0;
+        res01 += lhs_value * rhs_value1;
+        res02 += lhs_value * rhs_value2;
+        res03 += lhs_value * rhs_value3;
+
+        lhs_value = lhs1[k];
+        res10 += lhs_value * rhs_value0;
+        res11 += lhs_value * rhs_value1;
+        res12 += lhs_value * rhs_value2;
+        res13 += lhs_value * rhs_value3;
+
+        lhs_value = lhs2[k];
+        res20 += lhs_value * rhs_value0;
+        res21 += lhs_value * rhs_value1;
+        res22 += lhs_value * rhs_value2;
+        res23 += lhs_value * rhs_value3;
+
+        lhs_value = lhs3[k];
+        res30 += lhs_value * rhs_value0;
+        res31 += lhs_value * rhs_value1;
+        res32 += lhs_value * rhs_value2;
+        res33 += lhs_value * rhs_value3;
+
+        panel += 4;
+    }
+
+    acc[0] = res00;
+    acc[1] = res01;
+    acc[2] = res02;
+    acc[3] = res03;
+    acc[4] = res10;
+    acc[5] = res11;
+    acc[6] = res12;
+    acc[7] = res13;
+    acc[8] = res20;
+    acc[9] = res21;
+    acc[10] = res22;
+    acc[11] = res23;
+    acc[12] = res30;
+    acc[13] = res31;
+    acc[14] = res32;
+    acc[15] = res33;
+}
+
+// acc[4 * i + j] += sum(lhs[i][k] * panel[4 * k + j]) for k < kc and the 1 lhs
+// row of the tile.
+__STATIC_FORCEINLINE void mat_mult_kernel_1x4(const q7_t *lhs,
+                                              const int32_t lhs_stride,
+                                              const q7_t *panel,
+                                              const int32_t kc,
+                                              q31_t *acc)
+{
+    (void)lhs_stride;
+    const q7_t *lhs0 = lhs;
+    q31_t res00 = acc[0];
+    q31_t res01 = acc[1];
+    q31_t res02 = acc[2];
+    q31_t res03 = acc[3];
+
+    for (int32_t k = 0; k < kc; ++k)
+    {
+        const q31_t rhs_value0 = panel[0];
+        const q31_t rhs_value1 = panel[1];
+        const q31_t rhs_value2 = panel[2];
+        const q31_t rhs_value3 = panel[3];
+        q31_t lhs_value;
+
+        lhs_value = lhs0[k];
+        res00 += lhs_value * rhs_value0;
+        res01 += lhs_value * rhs_value1;
+        res02 += lhs_value * rhs_value2;
+        res03 += lhs_value * rhs_value3;
+
+        panel += 4;
+    }
+
+    acc[0] = res00;
+    acc[1] = res01;
+    acc[2] = res02;
+    acc[3] = res03;
+}
+
+// Multiply all lhs rows with one panel of 4 rhs rows. The lhs rows are taken
+// NN_MAT_MULT_PANEL_ROWS at a time and, within those, tile_rows (8 or 4) at a
+// time, then 4 and finally 1 at a time. The rhs rows are packed into panel
+// here unless packed_rhs already holds them in the panel layout for all
+// rhs_cols columns; rhs[j][k] is read from j * rhs_row_stride +
+// k * rhs_col_stride. With a residual, res holds its elements laid out as
+// dst and they are added to the outputs before they are stored.
+static void mat_mult_nt_t_s8_panel(const q7_t *lhs,
+                                   const q7_t *rhs,
+                                   const q31_t *contribution,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t rhs_row_stride,
+                                   const int32_t rhs_col_stride,
+                                   const int32_t dst_offset,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t lhs_cols_offset,
+                                   const int32_t dst_stride,
+                                   const int32_t tile_rows,
+                                   const q7_t *packed_rhs,
+                                   q7_t *panel,
+                                   const riscv_nn_residual_add_params *residual,
+                                   const q7_t *res)
+{
+    // pack the panel once when all columns fit, otherwise each column block
+    // once per chunk of lhs rows, whose sums are kept in acc meanwhile
+    const int32_t panel_once = (packed_rhs != NULL) || (rhs_cols <= NN_MAT_MULT_PANEL_K);
+    q31_t acc[NN_MAT_MULT_PANEL_ROWS * 4];
+
+    if (packed_rhs == NULL && panel_once)
+    {
+        mat_mult_pack_panel_s8(rhs, rhs_row_stride, rhs_col_stride, rhs_cols, panel);
+    }
+
+    for (int32_t chunk_idx = 0; chunk_idx < lhs_rows; chunk_idx += NN_MAT_MULT_PANEL_ROWS)
+    {
+        const int32_t chunk_rows = MIN(NN_MAT_MULT_PANEL_ROWS, lhs_rows - chunk_idx);
+        const q7_t *lhs_chunk = lhs + chunk_idx * lhs_cols_offset;
+        q7_t *dst_ptr = dst + chunk_idx * dst_stride;
+
+        for (int32_t i = 0; i < chunk_rows; i++)
+        {
+            acc[4 * i] = contribution[0];
+            acc[4 * i + 1] = contribution[1];
+            acc[4 * i + 2] = contribution[2];
+            acc[4 * i + 3] = contribution[3];
+        }
+
+        for (int32_t k = 0; k < rhs_cols; k += NN_MAT_MULT_PANEL_K)
+        {
+            const int32_t kc = MIN(NN_MAT_MULT_PANEL_K, rhs_cols - k);
+            const q7_t *panel_ptr = (packed_rhs != NULL) ? packed_rhs + 4 * k : panel;
+            int32_t lhs_rows_idx = 0;
+
+            if (!panel_once)
             {
-                q31_t rhs_value = rhs_ptr[0];
-                q31_t lhs_value = lhs_ptr[0] + lhs_offset;
+                mat_mult_pack_panel_s8(rhs + k * rhs_col_stride, rhs_row_stride, rhs_col_stride, kc, panel);
+            }
 
-                res00 += lhs_value * rhs_value;
+            while (lhs_rows_idx < chunk_rows)
+            {
+                const int32_t rows_left = chunk_rows - lhs_rows_idx;
+                const int32_t rows = (rows_left >= tile_rows) ? tile_rows : (rows_left >= 4) ? 4 : 1;
+                const q7_t *lhs_ptr = lhs_chunk + lhs_rows_idx * lhs_cols_offset + k;
 
-                ++rhs_ptr;
-                ++lhs_ptr;
+                if (rows == 8)
+                {
+                    mat_mult_kernel_8x4(lhs_ptr, lhs_cols_offset, panel_ptr, kc, acc + 4 * lhs_rows_idx);
+                }
+                else if (rows == 4)
+                {
+                    mat_mult_kernel_4x4(lhs_ptr, lhs_cols_offset, panel_ptr, kc, acc + 4 * lhs_rows_idx);
+                }
+                else
+                {
+                    mat_mult_kernel_1x4(lhs_ptr, lhs_cols_offset, panel_ptr, kc, acc + 4 * lhs_rows_idx);
+                }
+                lhs_rows_idx += rows;
             }
+        }
 
-            lhs_ptr -= rhs_cols;
-            lhs_ptr += lhs_cols_offset;
+        if (residual == NULL)
+        {
+            for (int32_t i = 0; i < chunk_rows; i++)
+            {
+                for (int32_t j = 0; j < 4; j++)
+                {
+                    dst_ptr[j] = mat_mult_out_s8(acc[4 * i + j], dst_multipliers[j], dst_shifts[j],
+                                                 dst_offset, activation_min, activation_max);
+                }
+                dst_ptr += dst_stride;
+            }
+        }
+        else
+        {
+            const q7_t *res_ptr = res + chunk_idx * dst_stride;
 
-            // Quantize down
-            res00 = riscv_nn_requantize(res00, dst_multipliers[rhs_rows - 1], dst_shifts[rhs_rows - 1]);
+            for (int32_t i = 0; i < chunk_rows; i++)
+            {
+                for (int32_t j = 0; j < 4; j++)
+                {
+                    dst_ptr[j] = mat_mult_out_add_s8(acc[4 * i + j], dst_multipliers[j], dst_shifts[j],
+                                                     dst_offset, activation_min, activation_max,
+                                                     residual, res_ptr[j]);
+                }
+                dst_ptr += dst_stride;
+                res_ptr += dst_stride;
+            }
+        }
+    }
+}
 
-            // Add offset
-            res00 += dst_offset;
+int32_t riscv_nn_mat_mult_nt_t_s8_core(const int8_t *lhs,
+                                       const int8_t *rhs,
+                                       const int32_t *bias,
+                                       int8_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,    //value is in the range of [-127, 128]
+                                       const int32_t dst_offset,    //value is in the range of [-128, 127]
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const int32_t lhs_cols_offset,
+                                       const int32_t dst_stride,
+                                       const int32_t *contri_buf,
+                                       const int32_t tile_rows)
+{
+    // tile_rows 0 selects the tile by shape: the 4x4 tile once both operands
+    // fill it, the 2x2 loop otherwise
+    const int32_t tile = (tile_rows != 0) ? tile_rows : (lhs_rows >= 4) ? MAT_MULT_TILE_ROWS : 2;
+    int32_t rhs_rows_idx = 0;
+
+    if ((tile >= 4) && (rhs_rows >= 4))
+    {
+        q7_t panel[4 * NN_MAT_MULT_PANEL_K];
 
-            // Clamp the result
-            res00 = MAX(res00, activation_min);
-            res00 = MIN(res00, activation_max);
+        for (; (rhs_rows_idx + 4) <= rhs_rows; rhs_rows_idx += 4)
+        {
+            const q7_t *rhs_ptr = rhs + rhs_rows_idx * rhs_cols;
+            q31_t contribution[4];
 
-            dst_ptr[0] = (q7_t)res00;
-            dst_ptr += rhs_rows;
+            for (int32_t j = 0; j < 4; j++)
+            {
+                contribution[j] = mat_mult_contribution_s8(rhs_ptr + j * rhs_cols, bias, contri_buf,
+                                                           rhs_rows_idx + j, rhs_cols, lhs_offset);
+            }
+
+            mat_mult_nt_t_s8_panel(lhs,
+                                   rhs_ptr,
+                                   contribution,
+                                   dst + rhs_rows_idx,
+                                   dst_multipliers + rhs_rows_idx,
+                                   dst_shifts + rhs_rows_idx,
+                                   lhs_rows,
+                                   rhs_cols,
+                                   rhs_cols,
+                                   1,
+                                   dst_offset,
+                                   activation_min,
+                                   activation_max,
+                                   lhs_cols_offset,
+                                   dst_stride,
+                                   tile,
+                                   NULL,
+                                   panel,
+                                   NULL,
+                                   NULL);
         }
     }
+
+    if (rhs_rows_idx < rhs_rows)
+    {
+        mat_mult_nt_t_s8_2x2(lhs,
+                             rhs + rhs_rows_idx * rhs_cols,
+                             (bias != NULL) ? bias + rhs_rows_idx : NULL,
+                             dst + rhs_rows_idx,
+                             dst_multipliers + rhs_rows_idx,
+                             dst_shifts + rhs_rows_idx,
+                             lhs_rows,
+                             rhs_rows - rhs_rows_idx,
+                             rhs_cols,
+                             lhs_offset,
+                             dst_offset,
+                             activation_min,
+                             activation_max,
+                             lhs_cols_offset,
+                             dst_stride,
+                             (contri_buf != NULL) ? contri_buf + rhs_rows_idx : NULL);
+    }
     return 0;
 }
 
+void riscv_nn_mat_mult_nt_t_s8_pack_rhs(const int8_t *rhs,
+                                         const int32_t rhs_rows,
+                                         const int32_t rhs_cols,
+                                         int8_t *packed_rhs)
+{
+    int32_t rhs_rows_idx;
+
+    for (rhs_rows_idx = 0; (rhs_rows_idx + 4) <= rhs_rows; rhs_rows_idx += 4)
+    {
+        mat_mult_pack_panel_s8(rhs, rhs_cols, 1, rhs_cols, packed_rhs);
+        rhs += 4 * rhs_cols;
+        packed_rhs += 4 * rhs_cols;
+    }
+    // the left-over rows stay in row order
+    memcpy(packed_rhs, rhs, (rhs_rows - rhs_rows_idx) * rhs_cols);
+}
+
+int32_t riscv_nn_mat_mult_nt_t_s8_packed(const int8_t *lhs,
+                                         const int8_t *packed_rhs,
+                                         const int32_t *contri_buf,
+                                         int8_t *dst,
+                                         const int32_t *dst_multipliers,
+                                         const int32_t *dst_shifts,
+                                         const int32_t lhs_rows,
+                                         const int32_t rhs_rows,
+                                         const int32_t rhs_cols,
+                                         const int32_t dst_offset,
+                                         const int32_t activation_min,
+                                         const int32_t activation_max,
+                                         const int32_t lhs_cols_offset,
+                                         const int32_t dst_stride)
+{
+    int32_t rhs_rows_idx;
+
+    for (rhs_rows_idx = 0; (rhs_rows_idx + 4) <= rhs_rows; rhs_rows_idx += 4)
+    {
+        mat_mult_nt_t_s8_panel(lhs,
+                               NULL,
+                               contri_buf + rhs_rows_idx,
+                               dst + rhs_rows_idx,
+                               dst_multipliers + rhs_rows_idx,
+                               dst_shifts + rhs_rows_idx,
+                               lhs_rows,
+                               rhs_cols,
+                               rhs_cols,
+                               1,
+                               dst_offset,
+                               activation_min,
+                               activation_max,
+                               lhs_cols_offset,
+                               dst_stride,
+                               MAT_MULT_TILE_ROWS,
+                               packed_rhs + rhs_rows_idx * rhs_cols,
+                               NULL,
+                               NULL,
+                               NULL);
+    }
+
+    if (rhs_rows_idx < rhs_rows)
+    {
+        mat_mult_nt_t_s8_2x2(lhs,
+                             packed_rhs + rhs_rows_idx * rhs_cols,
+                             NULL,
+                             dst + rhs_rows_idx,
+                             dst_multipliers + rhs_rows_idx,
+                             dst_shifts + rhs_rows_idx,
+                             lhs_rows,
+                             rhs_rows - rhs_rows_idx,
+                             rhs_cols,
+                             0,
+                             dst_offset,
+                             activation_min,
+                             activation_max,
+                             lhs_cols_offset,
+                             dst_stride,
+                             contri_buf + rhs_rows_idx);
+    }
+    return 0;
+}
+
+int32_t riscv_nn_mat_mult_nt_t_s8_add(const int8_t *lhs,
+                                      const int8_t *rhs,
+                                      const int32_t *bias,
+                                      int8_t *dst,
+                                      const int32_t *dst_multipliers,
+                                      const int32_t *dst_shifts,
+                                      const int32_t lhs_rows,
+                                      const int32_t rhs_rows,
+                                      const int32_t rhs_cols,
+                                      const int32_t lhs_offset,    //value is in the range of [-127, 128]
+                                      const int32_t dst_offset,    //value is in the range of [-128, 127]
+                                      const int32_t activation_min,
+                                      const int32_t activation_max,
+                                      const int32_t lhs_cols_offset,
+                                      const int32_t dst_stride,
+                                      const riscv_nn_residual_add_params *residual,
+                                      const int8_t *res)
+{
+    q7_t panel[4 * NN_MAT_MULT_PANEL_K];
+    int32_t rhs_rows_idx;
+
+    for (rhs_rows_idx = 0; (rhs_rows_idx + 4) <= rhs_rows; rhs_rows_idx += 4)
+    {
+        const q7_t *rhs_ptr = rhs + rhs_rows_idx * rhs_cols;
+        q31_t contribution[4];
+
+        for (int32_t j = 0; j < 4; j++)
+        {
+            contribution[j] = mat_mult_contribution_s8(rhs_ptr + j * rhs_cols, bias, NULL,
+                                                       rhs_rows_idx + j, rhs_cols, lhs_offset);
+        }
+
+        mat_mult_nt_t_s8_panel(lhs,
+                               rhs_ptr,
+                               contribution,
+                               dst + rhs_rows_idx,
+                               dst_multipliers + rhs_rows_idx,
+                               dst_shifts + rhs_rows_idx,
+                               lhs_rows,
+                               rhs_cols,
+                               rhs_cols,
+                               1,
+                               dst_offset,
+                               activation_min,
+                               activation_max,
+                               lhs_cols_offset,
+                               dst_stride,
+                               MAT_MULT_TILE_ROWS,
+                               NULL,
+                               panel,
+                               residual,
+                               res + rhs_rows_idx);
+    }
+
+    // left-over rhs rows
+    for (; rhs_rows_idx < rhs_rows; rhs_rows_idx++)
+    {
+        const q7_t *rhs_ptr = rhs + rhs_rows_idx * rhs_cols;
+        const q31_t contribution = mat_mult_contribution_s8(rhs_ptr, bias, NULL, rhs_rows_idx, rhs_cols,
+                                                            lhs_offset);
+
+        for (int32_t i = 0; i < lhs_rows; i++)
+        {
+            const q7_t *lhs_ptr = lhs + i * lhs_cols_offset;
+            q31_t sum = contribution;
+
+            for (int32_t k = 0; k < rhs_cols; k++)
+            {
+                sum += (q31_t)lhs_ptr[k] * rhs_ptr[k];
+            }
+
+            dst[i * dst_stride + rhs_rows_idx] = mat_mult_out_add_s8(sum, dst_multipliers[rhs_rows_idx],
+                        dst_shifts[rhs_rows_idx], dst_offset, activation_min, activation_max, residual,
+                        res[i * dst_stride + rhs_rows_idx]);
+        }
+    }
+    return 0;
+}
+
+// riscv_nn_mat_mult_nt_t_s8_core with one multiplier and shift for all rhs
+// rows, as used by fully-connected and batch matmul layers. The rhs rows are
+// handled in chunks so the broadcast quantization arrays fit on the stack.
+int32_t riscv_nn_mat_mult_nt_t_s8_per_tensor(const int8_t *lhs,
+                                             const int8_t *rhs,
+                                             const int32_t *bias,
+                                             int8_t *dst,
+                                             const int32_t dst_multiplier,
+                                             const int32_t dst_shift,
+                                             const int32_t lhs_rows,
+                                             const int32_t rhs_rows,
+                                             const int32_t rhs_cols,
+                                             const int32_t lhs_offset,
+                                             const int32_t dst_offset,
+                                             const int32_t activation_min,
+                                             const int32_t activation_max,
+                                             const int32_t lhs_cols_offset,
+                                             const int32_t dst_stride)
+{
+    int32_t mults[MAT_MULT_PER_TENSOR_ROWS];
+    int32_t shifts[MAT_MULT_PER_TENSOR_ROWS];
+    int32_t row;
+
+    for (row = 0; row < MAT_MULT_PER_TENSOR_ROWS; row++)
+    {
+        mults[row] = dst_multiplier;
+        shifts[row] = dst_shift;
+    }
+
+    for (row = 0; row < rhs_rows; row += MAT_MULT_PER_TENSOR_ROWS)
+    {
+        riscv_nn_mat_mult_nt_t_s8_core(lhs,
+                                       rhs + row * rhs_cols,
+                                       (bias != NULL) ? bias + row : NULL,
+                                       dst + row,
+                                       mults,
+                                       shifts,
+                                       lhs_rows,
+                                       MIN(MAT_MULT_PER_TENSOR_ROWS, rhs_rows - row),
+                                       rhs_cols,
+                                       lhs_offset,
+                                       dst_offset,
+                                       activation_min,
+                                       activation_max,
+                                       lhs_cols_offset,
+                                       dst_stride,
+                                       NULL,
+                                       0);
+    }
+    return 0;
+}
+
+// dst = lhs x rhs with a non-transposed rhs[rhs_rows][rhs_cols], i.e.
+// rhs_rows is the inner dimension. Every 4 rhs columns are packed into the
+// panel layout (one contiguous 4-byte copy per inner index) and run through
+// the same register tiles as riscv_nn_mat_mult_nt_t_s8_core.
+int32_t riscv_nn_mat_mult_nt_nt_s8_per_tensor(const int8_t *lhs,
+                                              const int8_t *rhs,
+                                              const int32_t *bias,
+                                              int8_t *dst,
+                                              const int32_t dst_multiplier,
+                                              const int32_t dst_shift,
+                                              const int32_t lhs_rows,
+                                              const int32_t rhs_rows,
+                                              const int32_t rhs_cols,
+                                              const int32_t lhs_offset,
+                                              const int32_t dst_offset,
+                                              const int32_t activation_min,
+                                              const int32_t activation_max,
+                                              const int32_t lhs_cols_offset,
+                                              const int32_t dst_stride)
+{
+    const int32_t mults[4] = {dst_multiplier, dst_multiplier, dst_multiplier, dst_multiplier};
+    const int32_t shifts[4] = {dst_shift, dst_shift, dst_shift, dst_shift};
+    q7_t panel[4 * NN_MAT_MULT_PANEL_K];
+    int32_t col = 0;
+
+    for (; (col + 4) <= rhs_cols; col += 4)
+    {
+        const q7_t *rhs_ptr = rhs + col;
+        q31_t contribution[4] = {0, 0, 0, 0};
+
+        if (lhs_offset != 0)
+        {
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                contribution[0] += rhs_ptr[0];
+                contribution[1] += rhs_ptr[1];
+                contribution[2] += rhs_ptr[2];
+                contribution[3] += rhs_ptr[3];
+                rhs_ptr += rhs_cols;
+            }
+        }
+        for (int32_t j = 0; j < 4; j++)
+        {
+            contribution[j] *= lhs_offset;
+            if (bias != NULL)
+            {
+                contribution[j] += bias[col + j];
+            }
+        }
+
+        mat_mult_nt_t_s8_panel(lhs,
+                               rhs + col,
+                               contribution,
+                               dst + col,
+                               mults,
+                               shifts,
+                               lhs_rows,
+                               rhs_rows,
+                               1,
+                               rhs_cols,
+                               dst_offset,
+                               activation_min,
+                               activation_max,
+                               lhs_cols_offset,
+                               dst_stride,
+                               MAT_MULT_TILE_ROWS,
+                               NULL,
+                               panel,
+                               NULL,
+                               NULL);
+    }
+
+    // left-over columns
+    for (; col < rhs_cols; col++)
+    {
+        for (int32_t i = 0; i < lhs_rows; i++)
+        {
+            const q7_t *lhs_ptr = lhs + i * lhs_cols_offset;
+            const q7_t *rhs_ptr = rhs + col;
+            q31_t acc = (bias != NULL) ? bias[col] : 0;
+
+            for (int32_t k = 0; k < rhs_rows; k++)
+            {
+                acc += (lhs_ptr[k] + lhs_offset) * (*rhs_ptr);
+                rhs_ptr += rhs_cols;
+            }
+            dst[i * dst_stride + col] = mat_mult_out_s8(acc, dst_multiplier, dst_shift, dst_offset,
+                                                        activation_min, activation_max);
+        }
+    }
+    return 0;
+}
+
+// riscv_nn_mat_mult_nt_t_s8_core on an rhs of packed int4 values (two per
+// byte, even elements in the low nibbles). Every group of 4 rhs rows is
+// unpacked once into rhs_buf (4 * rhs_cols bytes) in the panel layout and then
+// multiplied by all lhs rows, so the nibbles are not extracted per MAC.
+int32_t riscv_nn_mat_mult_nt_t_s4_core(const int8_t *lhs,
+                                       const int8_t *packed_rhs,
+                                       const int32_t *bias,
+                                       int8_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,
+                                       const int32_t dst_offset,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const int32_t lhs_cols_offset,
+                                       const int32_t dst_stride,
+                                       const int32_t *contri_buf,
+                                       int8_t *rhs_buf)
+{
+    int32_t contribution[4];
+    int32_t rhs_rows_idx;
+
+    for (rhs_rows_idx = 0; rhs_rows_idx < rhs_rows; rhs_rows_idx += 4)
+    {
+        const int32_t rows = MIN(4, rhs_rows - rhs_rows_idx);
+        // panel layout for full groups, row order for the left-over rows
+        const int32_t step = (rows == 4) ? 4 : 1;
+        int32_t j, k;
+
+        for (j = 0; j < rows; j++)
+        {
+            int32_t idx = (rhs_rows_idx + j) * rhs_cols;
+            int32_t sum = 0;
+            int8_t *buf = (rows == 4) ? rhs_buf + j : rhs_buf + j * rhs_cols;
+
+            for (k = 0; k < rhs_cols; k++, idx++)
+            {
+                const int8_t packed = packed_rhs[idx >> 1];
+                const int8_t val = (idx & 1) ? (int8_t)(packed >> 4) : (int8_t)((int8_t)(packed << 4) >> 4);
+                buf[k * step] = val;
+                sum += val;
+            }
+
+            if (contri_buf)
+            {
+                contribution[j] = contri_buf[rhs_rows_idx + j];
+            }
+            else
+            {
+                contribution[j] = lhs_offset * sum;
+                if (bias)
+                {
+                    contribution[j] += bias[rhs_rows_idx + j];
+                }
+            }
+        }
+
+        if (rows == 4)
+        {
+            mat_mult_nt_t_s8_panel(lhs,
+                                   NULL,
+                                   contribution,
+                                   dst + rhs_rows_idx,
+                                   dst_multipliers + rhs_rows_idx,
+                                   dst_shifts + rhs_rows_idx,
+                                   lhs_rows,
+                                   rhs_cols,
+                                   rhs_cols,
+                                   1,
+                                   dst_offset,
+                                   activation_min,
+                                   activation_max,
+                                   lhs_cols_offset,
+                                   dst_stride,
+                                   MAT_MULT_TILE_ROWS,
+                                   rhs_buf,
+                                   NULL,
+                                   NULL,
+                                   NULL);
+        }
+        else
+        {
+            mat_mult_nt_t_s8_2x2(lhs,
+                                 rhs_buf,
+                                 NULL,
+                                 dst + rhs_rows_idx,
+                                 dst_multipliers + rhs_rows_idx,
+                                 dst_shifts + rhs_rows_idx,
+                                 lhs_rows,
+                                 rows,
+                                 rhs_cols,
+                                 0,
+                                 dst_offset,
+                                 activation_min,
+                                 activation_max,
+                                 lhs_cols_offset,
+                                 dst_stride,
+                                 contribution);
+        }
+    }
+    return 0;
+}
+
+int32_t riscv_nn_mat_mult_nt_t_s8(const q7_t *lhs,
+                                   const q7_t *rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t lhs_offset,    //value is in the range of [-127, 128]
+                                   const int32_t dst_offset,    //value is in the range of [-128, 127]
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t lhs_cols_offset)
+{
+    return riscv_nn_mat_mult_nt_t_s8_core(lhs, rhs, bias, dst, dst_multipliers, dst_shifts, lhs_rows,
+                                          rhs_rows, rhs_cols, lhs_offset, dst_offset, activation_min,
+                                          activation_max, lhs_cols_offset, rhs_rows, NULL, 0);
+}
+
+// Same results as riscv_nn_mat_mult_nt_t_s8. When contri_buf is not NULL it
+// holds bias[i] + lhs_offset * sum(rhs[i][:]) for every rhs row (see
+// riscv_nn_kernel_sum_s8), so neither bias nor the weights are read for the
+// offset terms. Layers of at least 4 lhs and 4 rhs rows run the 4x4 tile on
+// packed rhs panels, the others the 2x2 loop.
 int32_t riscv_nn_mat_mult_nt_t_s8_v2(const int8_t *lhs,
             const int8_t *rhs,
             const int32_t *bias,
@@ -224,5 +1174,7 @@ int32_t riscv_nn_mat_mult_nt_t_s8_v2(const int8_t *lhs,
             const int32_t lhs_cols_offset,
             int32_t *contri_buf)
 {
-    return 0;
+    return riscv_nn_mat_mult_nt_t_s8_core(lhs, rhs, bias, dst, dst_multipliers, dst_shifts, lhs_rows,
+                                          rhs_rows, rhs_cols, lhs_offset, dst_offset, activation_min,
+                                          activation_max, lhs_cols_offset, rhs_rows, contri_buf, 0);
 }
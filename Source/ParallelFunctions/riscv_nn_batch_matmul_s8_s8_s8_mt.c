@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_fully_connected.h"
+#include "riscv_nn_parallel.h"
+
+//// Parallel Functions
+
+typedef struct
+{
+    const int8_t * lhs;
+    const int8_t * rhs;
+    const int32_t * bias;
+    int8_t * dst;
+    int16_t lhs_offset, rhs_offset, out_offset;
+    int32_t out_scale, out_shift, act_min, act_max;
+    int32_t lhs_n, lhs_h, lhs_w, rhs_n, rhs_h, rhs_w, rhs_c, out_h;
+    int32_t rows;           // out_dim_n * out_dim_h * lhs_dim_w
+    int32_t num_tasks;
+} batch_matmul_mt_ctx;
+
+static void batch_matmul_mt_task(void * ctx, int32_t task_idx)
+{
+    batch_matmul_mt_ctx * c = (batch_matmul_mt_ctx *)ctx;
+    int32_t r, r_end;
+
+    riscv_nn_parallel_split(c->rows, c->num_tasks, task_idx, &r, &r_end);
+    while (r < r_end)
+    {
+        const int32_t p = r / c->lhs_w;
+        const int32_t n = p / c->out_h;
+        const int32_t h = p - n * c->out_h;
+        const int32_t j0 = r - p * c->lhs_w;
+        const int32_t j1 = MIN(c->lhs_w, j0 + (r_end - r));
+
+        // the broadcast side keeps pointing at its only block, as in
+        // riscv_nn_batch_matmul_s8_s8_s8
+        const int32_t lhs_blk = (c->lhs_n >= c->rhs_n ? n : 0) * c->lhs_h + (c->lhs_h >= c->rhs_h ? h : 0);
+        const int32_t rhs_blk = (c->rhs_n >= c->lhs_n ? n : 0) * c->rhs_h + (c->rhs_h >= c->lhs_h ? h : 0);
+
+        riscv_nn_batch_matmul_s8_s8_s8(c->lhs + (lhs_blk * c->lhs_w + j0) * c->rhs_c,
+                                       c->rhs + rhs_blk * c->rhs_w * c->rhs_c,
+                                       c->lhs_offset,
+                                       c->rhs_offset,
+                                       c->bias,
+                                       c->dst + (p * c->lhs_w + j0) * c->rhs_w,
+                                       c->out_offset,
+                                       c->out_scale,
+                                       c->out_shift,
+                                       1,
+                                       1,
+                                       j1 - j0,
+                                       1,
+                                       1,
+                                       c->rhs_w,
+                                       c->rhs_c,
+                                       1,
+                                       1,
+                                       c->act_min,
+                                       c->act_max);
+        r += j1 - j0;
+    }
+}
+
+int32_t riscv_nn_batch_matmul_s8_s8_s8_mt(const int8_t * in_lhs,
+                                          const int8_t * in_rhs,
+                                          const int16_t lhs_offset,
+                                          const int16_t rhs_offset,
+                                          const int32_t * bias,
+                                          int8_t * dst,
+                                          const int16_t out_offset,
+                                          const int32_t out_scale,
+                                          const int32_t out_shift,
+                                          const int32_t lhs_dim_n,
+                                          const int32_t lhs_dim_h,
+                                          const int32_t lhs_dim_w,
+                                          const int32_t rhs_dim_n,
+                                          const int32_t rhs_dim_h,
+                                          const int32_t rhs_dim_w,
+                                          const int32_t rhs_dim_c,
+                                          const int32_t out_dim_n,
+                                          const int32_t out_dim_h,
+                                          const int32_t act_min,
+                                          const int32_t act_max)
+{
+    batch_matmul_mt_ctx c;
+
+    c.rows = out_dim_n * out_dim_h * lhs_dim_w;
+    c.num_tasks = MIN(riscv_nn_get_parallel_threads(), c.rows);
+
+    if (c.num_tasks <= 1)
+    {
+        return riscv_nn_batch_matmul_s8_s8_s8(in_lhs, in_rhs, lhs_offset, rhs_offset, bias, dst,
+                    out_offset, out_scale, out_shift, lhs_dim_n, lhs_dim_h, lhs_dim_w, rhs_dim_n,
+                    rhs_dim_h, rhs_dim_w, rhs_dim_c, out_dim_n, out_dim_h, act_min, act_max);
+    }
+
+    c.lhs = in_lhs;
+    c.rhs = in_rhs;
+    c.bias = bias;
+    c.dst = dst;
+    c.lhs_offset = lhs_offset;
+    c.rhs_offset = rhs_offset;
+    c.out_offset = out_offset;
+    c.out_scale = out_scale;
+    c.out_shift = out_shift;
+    c.act_min = act_min;
+    c.act_max = act_max;
+    c.lhs_n = lhs_dim_n;
+    c.lhs_h = lhs_dim_h;
+    c.lhs_w = lhs_dim_w;
+    c.rhs_n = rhs_dim_n;
+    c.rhs_h = rhs_dim_h;
+    c.rhs_w = rhs_dim_w;
+    c.rhs_c = rhs_dim_c;
+    c.out_h = out_dim_h;
+
+    riscv_nn_parallel_run(batch_matmul_mt_task, &c, c.num_tasks);
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_parallel.h"
+
+//// Parallel Functions
+
+typedef struct
+{
+    const int8_t * in;
+    const int8_t * wt;
+    const int32_t * bias;
+    int8_t * out;
+    const int32_t * out_shift;
+    const int32_t * out_scale;
+    int16_t * tmp_buf;
+    int32_t slot_size;      // int16_t elements per task
+    int32_t in_x, in_y, in_ch, out_ch, ker_x, ker_y, ker_ch;
+    int32_t pad_x, pad_y, stride_x, stride_y, dil_x, dil_y;
+    int32_t out_x, out_y, out_offset, in_offset, act_min, act_max;
+    int32_t rows;           // batch * out_y
+    int32_t num_tasks;
+    int32_t status[NN_PARALLEL_MAX_THREADS];
+} conv_mt_ctx;
+
+static int32_t conv_mt_rows(const conv_mt_ctx * c, int32_t b, int32_t y0, int32_t y1, int16_t * buf)
+{
+    return riscv_nn_conv_HWC_s8_asym_rows(c->in + b * c->in_y * c->in_x * c->in_ch,
+                c->in_x,
+                c->in_y,
+                c->in_ch,
+                c->wt,
+                c->out_ch,
+                c->ker_x,
+                c->ker_y,
+                c->ker_ch,
+                c->pad_x,
+                c->pad_y,
+                c->stride_x,
+                c->stride_y,
+                c->bias,
+                c->out + ((b * c->out_y + y0) * c->out_x) * c->out_ch,
+                c->out_shift,
+                c->out_scale,
+                c->out_offset,
+                c->in_offset,
+                c->act_min,
+                c->act_max,
+                c->out_x,
+                y0,
+                y1,
+                c->dil_x,
+                c->dil_y,
+                buf);
+}
+
+static void conv_mt_task(void * ctx, int32_t task_idx)
+{
+    conv_mt_ctx * c = (conv_mt_ctx *)ctx;
+    int16_t * buf = c->tmp_buf ? c->tmp_buf + task_idx * c->slot_size : NULL;
+    int32_t r, r_end, status = 0;
+
+    riscv_nn_parallel_split(c->rows, c->num_tasks, task_idx, &r, &r_end);
+    while (r < r_end)
+    {
+        const int32_t b = r / c->out_y;
+        const int32_t y0 = r - b * c->out_y;
+        const int32_t y1 = MIN(c->out_y, y0 + (r_end - r));
+
+        if (conv_mt_rows(c, b, y0, y1, buf) != 0)
+        {
+            status = -1;
+        }
+        r += y1 - y0;
+    }
+    c->status[task_idx] = status;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt(const int8_t * in_tensor,
+                                                   const uint16_t in_tensor_dim_x,
+                                                   const uint16_t in_tensor_dim_y,
+                                                   const uint16_t in_tensor_ch,
+                                                   const uint16_t in_tensor_batch,
+                                                   const int8_t * ker_weight,
+                                                   const uint16_t out_tensor_ch,
+                                                   const uint16_t ker_dim_x,
+                                                   const uint16_t ker_dim_y,
+                                                   const uint16_t ker_ch,
+                                                   const uint16_t pad_x,
+                                                   const uint16_t pad_y,
+                                                   const uint16_t stride_x,
+                                                   const uint16_t stride_y,
+                                                   const int32_t * bias,
+                                                   int8_t * out_tensor,
+                                                   const int32_t * out_shift,
+                                                   const int32_t * out_scale,
+                                                   const int32_t out_offset,
+                                                   const int32_t in_offset,
+                                                   const int32_t act_min,
+                                                   const int32_t act_max,
+                                                   const uint16_t out_tensor_dim_x,
+                                                   const uint16_t out_tensor_dim_y,
+                                                   const int32_t dilation_x,
+                                                   const int32_t dilation_y,
+                                                   int16_t * in_tmp_buf)
+{
+    conv_mt_ctx c;
+    int32_t i, status = 0;
+
+    c.rows = in_tensor_batch * out_tensor_dim_y;
+    c.num_tasks = MIN(riscv_nn_get_parallel_threads(), c.rows);
+
+    // the slicing needs every output row to read at least one input row
+    if ((c.num_tasks <= 1) || (stride_y * (out_tensor_dim_y - 1) - pad_y >= in_tensor_dim_y))
+    {
+        return riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(in_tensor, in_tensor_dim_x, in_tensor_dim_y,
+                    in_tensor_ch, in_tensor_batch, ker_weight, out_tensor_ch, ker_dim_x, ker_dim_y,
+                    ker_ch, pad_x, pad_y, stride_x, stride_y, bias, out_tensor, out_shift, out_scale,
+                    out_offset, in_offset, act_min, act_max, out_tensor_dim_x, out_tensor_dim_y,
+                    dilation_x, dilation_y, in_tmp_buf);
+    }
+
+    c.in = in_tensor;
+    c.wt = ker_weight;
+    c.bias = bias;
+    c.out = out_tensor;
+    c.out_shift = out_shift;
+    c.out_scale = out_scale;
+    c.tmp_buf = in_tmp_buf;
+    c.slot_size = riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(in_tensor_dim_x, in_tensor_dim_y,
+                    in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y,
+                    out_tensor_dim_x, out_tensor_dim_y, out_tensor_ch, dilation_x,
+                    dilation_y) / sizeof(int16_t);
+    c.in_x = in_tensor_dim_x;
+    c.in_y = in_tensor_dim_y;
+    c.in_ch = in_tensor_ch;
+    c.out_ch = out_tensor_ch;
+    c.ker_x = ker_dim_x;
+    c.ker_y = ker_dim_y;
+    c.ker_ch = ker_ch;
+    c.pad_x = pad_x;
+    c.pad_y = pad_y;
+    c.stride_x = stride_x;
+    c.stride_y = stride_y;
+    c.dil_x = dilation_x;
+    c.dil_y = dilation_y;
+    c.out_x = out_tensor_dim_x;
+    c.out_y = out_tensor_dim_y;
+    c.out_offset = out_offset;
+    c.in_offset = in_offset;
+    c.act_min = act_min;
+    c.act_max = act_max;
+
+    riscv_nn_parallel_run(conv_mt_task, &c, c.num_tasks);
+
+    for (i = 0; i < c.num_tasks; i++)
+    {
+        status |= c.status[i];
+    }
+    return status;
+}
+
+int32_t riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(const uint16_t in_tensor_dim_x,
+                                                                   const uint16_t in_tensor_dim_y,
+                                                                   const uint16_t in_tensor_ch,
+                                                                   const uint16_t in_tensor_batch,
+                                                                   const uint16_t ker_dim_x,
+                                                                   const uint16_t ker_dim_y,
+                                                                   const uint16_t ker_ch,
+                                                                   const uint16_t pad_x,
+                                                                   const uint16_t pad_y,
+                                                                   const uint16_t stride_x,
+                                                                   const uint16_t stride_y,
+                                                                   const uint16_t out_tensor_dim_x,
+                                                                   const uint16_t out_tensor_dim_y,
+                                                                   const uint16_t out_tensor_ch,
+                                                                   const int32_t dilation_x,
+                                                                   const int32_t dilation_y)
+{
+    int32_t size = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_dim_x,
+                        in_tensor_dim_y, in_tensor_ch, in_tensor_batch, ker_dim_x, ker_dim_y,
+                        ker_ch, pad_x, pad_y, stride_x, stride_y, out_tensor_dim_x,
+                        out_tensor_dim_y, out_tensor_ch, dilation_x, dilation_y);
+    int32_t slot = riscv_nn_conv_HWC_s8_asym_rows_get_buffer_size(in_tensor_dim_x, in_tensor_dim_y,
+                        in_tensor_ch, ker_dim_x, ker_dim_y, ker_ch, pad_x, pad_y, stride_x, stride_y,
+                        out_tensor_dim_x, out_tensor_dim_y, out_tensor_ch, dilation_x, dilation_y);
+
+    // the single-threaded fallback runs the wrapper on the whole layer
+    return MAX(size, slot * riscv_nn_get_parallel_threads());
+}
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_parallel.h"
+
+//// Parallel Functions
+
+typedef struct
+{
+    const int8_t * in;
+    const int8_t * wt;
+    const int32_t * bias;
+    int8_t * out;
+    const int32_t * out_shift;
+    const int32_t * out_scale;
+    int16_t * tmp_buf;
+    int32_t slot_size;      // int16_t elements per task
+    int32_t in_x, in_y, in_ch, out_ch, ch_mult, ker_x, ker_y;
+    int32_t pad_x, pad_y, stride_x, stride_y, dil_x, dil_y;
+    int32_t out_x, out_y, out_offset, in_offset, act_min, act_max;
+    int32_t num_tasks;
+    int32_t status[NN_PARALLEL_MAX_THREADS];
+} conv_dw_mt_ctx;
+
+static void conv_dw_mt_task(void * ctx, int32_t task_idx)
+{
+    conv_dw_mt_ctx * c = (conv_dw_mt_ctx *)ctx;
+    int16_t * buf = c->tmp_buf ? c->tmp_buf + task_idx * c->slot_size : NULL;
+    int32_t y0, y1, v, in_start, in_end;
+
+    // As in riscv_nn_conv_HWC_s8_asym_rows, the slice is exactly the input
+    // rows its windows read: it keeps what remains of pad_y above its first
+    // window, and windows past its end only reach into the bottom padding.
+    riscv_nn_parallel_split(c->out_y, c->num_tasks, task_idx, &y0, &y1);
+    v = c->stride_y * y0 - c->pad_y;
+    in_start = MAX(v, 0);
+    in_end = MIN(c->stride_y * (y1 - 1) - c->pad_y + (c->ker_y - 1) * c->dil_y + 1, c->in_y);
+
+    c->status[task_idx] = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(c->in + in_start * c->in_x * c->in_ch,
+                              c->in_x,
+                              in_end - in_start,
+                              c->in_ch,
+                              c->wt,
+                              c->out_ch,
+                              c->ch_mult,
+                              c->ker_x,
+                              c->ker_y,
+                              c->pad_x,
+                              in_start - v,
+                              c->stride_x,
+                              c->stride_y,
+                              c->bias,
+                              c->out + y0 * c->out_x * c->out_ch,
+                              c->out_shift,
+                              c->out_scale,
+                              c->out_x,
+                              y1 - y0,
+                              c->out_offset,
+                              c->in_offset,
+                              c->act_min,
+                              c->act_max,
+                              c->dil_x,
+                              c->dil_y,
+                              buf);
+}
+
+int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt(const int8_t * in_tensor,
+                                                      const uint16_t in_tensor_dim_x,
+                                                      const uint16_t in_tensor_dim_y,
+                                                      const uint16_t in_tensor_ch,
+                                                      const int8_t * ker_weight,
+                                                      const uint16_t out_tensor_ch,
+                                                      const uint16_t ch_mult,
+                                                      const uint16_t ker_dim_x,
+                                                      const uint16_t ker_dim_y,
+                                                      const uint16_t pad_x,
+                                                      const uint16_t pad_y,
+                                                      const uint16_t stride_x,
+                                                      const uint16_t stride_y,
+                                                      const int32_t * bias,
+                                                      int8_t * out_tensor,
+                                                      const int32_t * out_shift,
+                                                      const int32_t * out_scale,
+                                                      const uint16_t out_tensor_dim_x,
+                                                      const uint16_t out_tensor_dim_y,
+                                                      const int32_t out_offset,
+                                                      const int32_t in_offset,
+                                                      const int32_t act_min,
+                                                      const int32_t act_max,
+                                                      const uint16_t dilation_x,
+                                                      const uint16_t dilation_y,
+                                                      int16_t * tmp_buf)
+{
+    conv_dw_mt_ctx c;
+    int32_t i, status = 0;
+
+    c.num_tasks = MIN(riscv_nn_get_parallel_threads(), out_tensor_dim_y);
+
+    // the slicing needs every output row to read at least one input row
+    if ((c.num_tasks <= 1) || (stride_y * (out_tensor_dim_y - 1) - pad_y >= in_tensor_dim_y))
+    {
+        return riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(in_tensor, in_tensor_dim_x, in_tensor_dim_y,
+                    in_tensor_ch, ker_weight, out_tensor_ch, ch_mult, ker_dim_x, ker_dim_y, pad_x,
+                    pad_y, stride_x, stride_y, bias, out_tensor, out_shift, out_scale,
+                    out_tensor_dim_x, out_tensor_dim_y, out_offset, in_offset, act_min, act_max,
+                    dilation_x, dilation_y, tmp_buf);
+    }
+
+    c.in = in_tensor;
+    c.wt = ker_weight;
+    c.bias = bias;
+    c.out = out_tensor;
+    c.out_shift = out_shift;
+    c.out_scale = out_scale;
+    c.tmp_buf = tmp_buf;
+    c.slot_size = ((riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_ch, ch_mult,
+                    ker_dim_x, ker_dim_y, pad_x) + 3) & ~3) / sizeof(int16_t);
+    c.in_x = in_tensor_dim_x;
+    c.in_y = in_tensor_dim_y;
+    c.in_ch = in_tensor_ch;
+    c.out_ch = out_tensor_ch;
+    c.ch_mult = ch_mult;
+    c.ker_x = ker_dim_x;
+    c.ker_y = ker_dim_y;
+    c.pad_x = pad_x;
+    c.pad_y = pad_y;
+    c.stride_x = stride_x;
+    c.stride_y = stride_y;
+    c.dil_x = dilation_x;
+    c.dil_y = dilation_y;
+    c.out_x = out_tensor_dim_x;
+    c.out_y = out_tensor_dim_y;
+    c.out_offset = out_offset;
+    c.in_offset = in_offset;
+    c.act_min = act_min;
+    c.act_max = act_max;
+
+    riscv_nn_parallel_run(conv_dw_mt_task, &c, c.num_tasks);
+
+    for (i = 0; i < c.num_tasks; i++)
+    {
+        status |= c.status[i];
+    }
+    return status;
+}
+
+int32_t riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(const uint16_t in_tensor_ch,
+                                                                      const uint16_t ch_mult,
+                                                                      const uint16_t ker_dim_x,
+                                                                      const uint16_t ker_dim_y,
+                                                                      const uint16_t pad_x)
+{
+    int32_t size = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(in_tensor_ch, ch_mult,
+                        ker_dim_x, ker_dim_y, pad_x);
+
+    return ((size + 3) & ~3) * riscv_nn_get_parallel_threads();
+}
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_fully_connected.h"
+#include "riscv_nn_parallel.h"
+
+//// Parallel Functions
+
+typedef struct
+{
+    const int8_t * in_vec;
+    const int8_t * wt_mat;
+    const int32_t * bias;
+    int8_t * out_vec;
+    int16_t * tmp_buf;
+    int32_t slot_size;      // int16_t elements per task
+    int32_t col, row, batch;
+    int32_t in_offset, wt_offset, out_scale, out_shift, out_offset, act_min, act_max;
+    int32_t split_batch;
+    int32_t num_tasks;
+} fc_mt_ctx;
+
+static void fc_mt_task(void * ctx, int32_t task_idx)
+{
+    fc_mt_ctx * c = (fc_mt_ctx *)ctx;
+    int16_t * buf = c->tmp_buf ? c->tmp_buf + task_idx * c->slot_size : NULL;
+    int32_t start, end, b;
+
+    if (c->split_batch)
+    {
+        riscv_nn_parallel_split(c->batch, c->num_tasks, task_idx, &start, &end);
+        riscv_nn_fc_s8_s8_s8_asym_bias(c->in_vec + start * c->col, c->wt_mat, c->col, c->row,
+            end - start, c->in_offset, c->wt_offset, c->out_scale, c->out_shift, c->out_offset,
+            c->bias, c->out_vec + start * c->row, c->act_min, c->act_max, buf);
+        return;
+    }
+
+    // a slice of the output channels is a narrower layer on the same inputs
+    riscv_nn_parallel_split(c->row, c->num_tasks, task_idx, &start, &end);
+    for (b = 0; b < c->batch; b++)
+    {
+        riscv_nn_fc_s8_s8_s8_asym_bias(c->in_vec + b * c->col, c->wt_mat + start * c->col, c->col,
+            end - start, 1, c->in_offset, c->wt_offset, c->out_scale, c->out_shift, c->out_offset,
+            c->bias ? c->bias + start : NULL, c->out_vec + b * c->row + start, c->act_min,
+            c->act_max, buf);
+    }
+}
+
+int32_t riscv_nn_fc_s8_s8_s8_asym_bias_mt(const int8_t * in_vec,
+                                          const int8_t * wt_mat,
+                                          const uint16_t in_vec_col,
+                                          const uint16_t wt_mat_row,
+                                          const uint16_t in_vec_batch,
+                                          const int32_t in_offset,
+                                          const int32_t wt_offset,
+                                          const int32_t out_scale,
+                                          const int32_t out_shift,
+                                          const int32_t out_offset,
+                                          const int32_t * bias,
+                                          int8_t * out_vec,
+                                          const int32_t act_min,
+                                          const int32_t act_max,
+                                          int16_t * tmp_buf)
+{
+    const int32_t threads = riscv_nn_get_parallel_threads();
+    fc_mt_ctx c;
+
+    c.split_batch = (in_vec_batch >= threads);
+    c.num_tasks = MIN(threads, c.split_batch ? in_vec_batch : wt_mat_row);
+
+    if (c.num_tasks <= 1)
+    {
+        return riscv_nn_fc_s8_s8_s8_asym_bias(in_vec, wt_mat, in_vec_col, wt_mat_row, in_vec_batch,
+                    in_offset, wt_offset, out_scale, out_shift, out_offset, bias, out_vec, act_min,
+                    act_max, tmp_buf);
+    }
+
+    c.in_vec = in_vec;
+    c.wt_mat = wt_mat;
+    c.bias = bias;
+    c.out_vec = out_vec;
+    c.tmp_buf = tmp_buf;
+    c.slot_size = ((riscv_nn_fc_s8_s8_s8_asym_bias_get_buffer_size(in_vec_col) + 3) & ~3)
+                  / sizeof(int16_t);
+    c.col = in_vec_col;
+    c.row = wt_mat_row;
+    c.batch = in_vec_batch;
+    c.in_offset = in_offset;
+    c.wt_offset = wt_offset;
+    c.out_scale = out_scale;
+    c.out_shift = out_shift;
+    c.out_offset = out_offset;
+    c.act_min = act_min;
+    c.act_max = act_max;
+
+    riscv_nn_parallel_run(fc_mt_task, &c, c.num_tasks);
+
+    return 0;
+}
+
+int32_t riscv_nn_fc_s8_s8_s8_asym_bias_mt_get_buffer_size(const uint16_t in_vec_col)
+{
+    int32_t size = riscv_nn_fc_s8_s8_s8_asym_bias_get_buffer_size(in_vec_col);
+
+    return ((size + 3) & ~3) * riscv_nn_get_parallel_threads();
+}
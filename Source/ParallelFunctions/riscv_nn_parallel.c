@@ -0,0 +1,215 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_parallel.h"
+
+#ifdef ENA_PARALLEL_PTHREAD
+#include <pthread.h>
+#endif
+
+//// Parallel Functions
+
+static void parallel_serial_dispatch(riscv_nn_task_fn task,
+                                     void * ctx,
+                                     int32_t num_tasks,
+                                     void * user_data)
+{
+    int32_t i;
+
+    (void)user_data;
+    for (i = 0; i < num_tasks; i++)
+    {
+        task(ctx, i);
+    }
+}
+
+#ifdef ENA_PARALLEL_PTHREAD
+// The workers are started once by riscv_nn_set_parallel_dispatcher and sleep
+// on a condition variable between calls, so a dispatch costs a wakeup rather
+// than a thread creation and join. The tasks are handed out one index at a
+// time, to the workers and the calling thread alike.
+typedef struct
+{
+    pthread_mutex_t call_lock;  // serializes dispatches from different threads
+    pthread_mutex_t lock;       // guards the fields below
+    pthread_cond_t start;
+    pthread_cond_t done;
+    riscv_nn_task_fn task;
+    void * ctx;
+    int32_t num_tasks;
+    int32_t next_task;
+    int32_t pending;            // tasks not finished yet
+    uint32_t generation;        // incremented by every dispatch
+    int32_t num_workers;
+} parallel_pthread_pool;
+
+static parallel_pthread_pool parallel_pool =
+{
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER, NULL, NULL, 0, 0, 0, 0, 0
+};
+
+// Run the tasks of the current dispatch that are not taken yet; called and
+// returns with parallel_pool.lock held.
+static void parallel_pthread_drain(void)
+{
+    parallel_pthread_pool * p = &parallel_pool;
+
+    while (p->next_task < p->num_tasks)
+    {
+        const riscv_nn_task_fn task = p->task;
+        void * ctx = p->ctx;
+        const int32_t task_idx = p->next_task++;
+
+        pthread_mutex_unlock(&p->lock);
+        task(ctx, task_idx);
+        pthread_mutex_lock(&p->lock);
+
+        if (--p->pending == 0)
+        {
+            pthread_cond_signal(&p->done);
+        }
+    }
+}
+
+static void * parallel_pthread_worker(void * arg)
+{
+    parallel_pthread_pool * p = &parallel_pool;
+    uint32_t seen;
+
+    (void)arg;
+    pthread_mutex_lock(&p->lock);
+    seen = p->generation;
+    for (;;)
+    {
+        while (p->generation == seen)
+        {
+            pthread_cond_wait(&p->start, &p->lock);
+        }
+        seen = p->generation;
+        parallel_pthread_drain();
+    }
+    return NULL;
+}
+
+// Start workers until there are num_workers of them; the tasks of workers
+// that cannot be created are run by the calling thread.
+static void parallel_pthread_start(int32_t num_workers)
+{
+    parallel_pthread_pool * p = &parallel_pool;
+    pthread_t thread;
+
+    pthread_mutex_lock(&p->lock);
+    while ((p->num_workers < num_workers)
+           && (pthread_create(&thread, NULL, parallel_pthread_worker, NULL) == 0))
+    {
+        pthread_detach(thread);
+        p->num_workers++;
+    }
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void parallel_pthread_dispatch(riscv_nn_task_fn task,
+                                      void * ctx,
+                                      int32_t num_tasks,
+                                      void * user_data)
+{
+    parallel_pthread_pool * p = &parallel_pool;
+
+    (void)user_data;
+    pthread_mutex_lock(&p->call_lock);
+    pthread_mutex_lock(&p->lock);
+
+    p->task = task;
+    p->ctx = ctx;
+    p->num_tasks = num_tasks;
+    p->next_task = 0;
+    p->pending = num_tasks;
+    p->generation++;
+    pthread_cond_broadcast(&p->start);
+
+    parallel_pthread_drain();
+    while (p->pending > 0)
+    {
+        pthread_cond_wait(&p->done, &p->lock);
+    }
+
+    pthread_mutex_unlock(&p->lock);
+    pthread_mutex_unlock(&p->call_lock);
+}
+#endif
+
+static riscv_nn_dispatch_fn parallel_dispatch = parallel_serial_dispatch;
+static void * parallel_user_data = NULL;
+static int32_t parallel_threads = 1;
+
+void riscv_nn_set_parallel_dispatcher(riscv_nn_dispatch_fn dispatch,
+                                      void * user_data,
+                                      int32_t num_threads)
+{
+    num_threads = MAX(num_threads, 1);
+    num_threads = MIN(num_threads, NN_PARALLEL_MAX_THREADS);
+
+    if (dispatch == NULL)
+    {
+#ifdef ENA_PARALLEL_PTHREAD
+        dispatch = parallel_pthread_dispatch;
+        parallel_pthread_start(num_threads - 1);
+#else
+        dispatch = parallel_serial_dispatch;
+        num_threads = 1;
+#endif
+    }
+
+    parallel_dispatch = dispatch;
+    parallel_user_data = user_data;
+    parallel_threads = num_threads;
+}
+
+int32_t riscv_nn_get_parallel_threads(void)
+{
+    return parallel_threads;
+}
+
+void riscv_nn_parallel_run(riscv_nn_task_fn task, void * ctx, int32_t num_tasks)
+{
+    if (num_tasks <= 1)
+    {
+        if (num_tasks == 1)
+        {
+            task(ctx, 0);
+        }
+        return;
+    }
+
+    parallel_dispatch(task, ctx, num_tasks, parallel_user_data);
+}
+
+void riscv_nn_parallel_split(const int32_t total,
+                             const int32_t num_tasks,
+                             const int32_t task_idx,
+                             int32_t * start,
+                             int32_t * end)
+{
+    *start = (int32_t)(((int64_t)total * task_idx) / num_tasks);
+    *end = (int32_t)(((int64_t)total * (task_idx + 1)) / num_tasks);
+}
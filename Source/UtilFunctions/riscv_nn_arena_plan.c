@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+#include "riscv_nn_util.h"
+
+//// Util Functions
+
+#define ARENA_ALIGN_UP(x, a) (((x) + (a) - 1) & ~((a) - 1))
+
+// Placement order: larger buffers first; ties go to the earlier lifetime and
+// then to the lower index so that the plan is deterministic.
+static int32_t arena_before(const riscv_nn_arena_buffer * buffers, int32_t a, int32_t b)
+{
+    if (buffers[a].size != buffers[b].size)
+    {
+        return buffers[a].size > buffers[b].size;
+    }
+    if (buffers[a].first_use != buffers[b].first_use)
+    {
+        return buffers[a].first_use < buffers[b].first_use;
+    }
+    return a < b;
+}
+
+int32_t riscv_nn_arena_plan(riscv_nn_arena_buffer * buffers,
+                            const int32_t num_buffers,
+                            const int32_t align,
+                            int32_t * tmp_buf)
+{
+    int32_t * order = tmp_buf;
+    int32_t * live = tmp_buf + num_buffers;
+    int32_t arena_size = 0;
+    int32_t i, j, k;
+
+    if ((align <= 0) || ((align & (align - 1)) != 0))
+    {
+        return -1;
+    }
+
+    for (i = 0; i < num_buffers; i++)
+    {
+        const riscv_nn_arena_buffer * b = &buffers[i];
+        int32_t pos = i;
+
+        if ((b->size < 0) || (b->first_use > b->last_use))
+        {
+            return -1;
+        }
+
+        // insertion sort of the placement order
+        while ((pos > 0) && arena_before(buffers, i, order[pos - 1]))
+        {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+
+    for (i = 0; i < num_buffers; i++)
+    {
+        riscv_nn_arena_buffer * cur = &buffers[order[i]];
+        int32_t num_live = 0;
+        int32_t offset = 0;
+
+        // the placed buffers alive at the same time, sorted by offset
+        for (j = 0; j < i; j++)
+        {
+            const riscv_nn_arena_buffer * other = &buffers[order[j]];
+
+            if ((other->size == 0) || (other->first_use > cur->last_use) || (other->last_use < cur->first_use))
+            {
+                continue;
+            }
+            k = num_live++;
+            while ((k > 0) && (buffers[live[k - 1]].offset > other->offset))
+            {
+                live[k] = live[k - 1];
+                k--;
+            }
+            live[k] = order[j];
+        }
+
+        // lowest gap between them that is large enough
+        for (j = 0; j < num_live; j++)
+        {
+            const riscv_nn_arena_buffer * other = &buffers[live[j]];
+
+            if (offset + cur->size <= other->offset)
+            {
+                break;
+            }
+            offset = MAX(offset, ARENA_ALIGN_UP(other->offset + other->size, align));
+        }
+
+        cur->offset = offset;
+        arena_size = MAX(arena_size, offset + cur->size);
+    }
+
+    return arena_size;
+}
+
+int32_t riscv_nn_arena_plan_get_buffer_size(const int32_t num_buffers)
+{
+    return 2 * num_buffers * sizeof(int32_t);
+}
@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+#include "internal_nn_math.h"
+
+int32_t riscv_nn_kernel_sum_s8(const int8_t * ker_weight,
+                               const int32_t * bias,
+                               const int32_t out_tensor_ch,
+                               const int32_t ker_size,
+                               const int32_t in_offset,   //value is in the range of [-127, 128]
+                               int32_t * kernel_sum)
+{
+    for (int32_t i_out_ch = 0; i_out_ch < out_tensor_ch; i_out_ch++)
+    {
+        int32_t sum = 0;
+
+        for (int32_t i = 0; i < ker_size; i++)
+        {
+            sum += ker_weight[i];
+        }
+
+        sum *= in_offset;
+        if (bias != NULL)
+        {
+            sum += bias[i_out_ch];
+        }
+        kernel_sum[i_out_ch] = sum;
+        ker_weight += ker_size;
+    }
+    return 0;
+}
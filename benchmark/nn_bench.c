@@ -0,0 +1,795 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+// Host-native micro-benchmark of the libnn kernel families.
+//
+// Every kernel family declared in Include/riscv_nn_*.h is swept over layer
+// shapes taken from MobileNet, DS-CNN and small transformer models. For each
+// case the average time per call is measured and reported together with the
+// derived MAC/s and bytes/s as one JSON document on stdout.
+//
+// Usage: nn_bench [--filter <substring>] [--min-time-ms <ms>] [--list]
+
+#include "nn_bench_common.h"
+
+#include "riscv_nn_activation.h"
+#include "riscv_nn_basic.h"
+#include "riscv_nn_concatenation.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_fully_connected.h"
+#include "riscv_nn_pooling.h"
+#include "riscv_nn_softmax.h"
+#include "riscv_nn_util.h"
+
+static const char *bench_filter = NULL;
+static uint64_t bench_min_time_ns = 20000000ull;
+static int bench_list_only = 0;
+static int bench_count = 0;
+
+static int bench_selected(const char *kernel, const char *shape)
+{
+    if (bench_filter == NULL)
+    {
+        return 1;
+    }
+    return (strstr(kernel, bench_filter) != NULL) || (strstr(shape, bench_filter) != NULL);
+}
+
+// Time one case and print it as a JSON object. "macs" may be 0 for kernels
+// without multiply-accumulate work; "bytes" counts every input, weight and
+// output byte touched by one call.
+static void bench_report(const char *family,
+                         const char *kernel,
+                         const char *shape,
+                         nn_bench_run_fn run,
+                         void *args,
+                         uint64_t macs,
+                         uint64_t bytes)
+{
+    double ns;
+
+    if (!bench_selected(kernel, shape))
+    {
+        return;
+    }
+    if (bench_list_only)
+    {
+        printf("%s %s\n", kernel, shape);
+        return;
+    }
+
+    ns = nn_bench_time_ns(run, args, bench_min_time_ns);
+    printf("%s\n    {\"family\": \"%s\", \"kernel\": \"%s\", \"shape\": \"%s\", "
+           "\"ns_per_call\": %.1f, \"macs\": %llu, \"mac_per_s\": %.4e, "
+           "\"bytes\": %llu, \"bytes_per_s\": %.4e}",
+           bench_count ? "," : "", family, kernel, shape, ns,
+           (unsigned long long)macs, macs ? (double)macs * 1e9 / ns : 0.0,
+           (unsigned long long)bytes, (double)bytes * 1e9 / ns);
+    fflush(stdout);
+    bench_count++;
+}
+
+static void fill_quant_params(int32_t *scale, int32_t *shift, int32_t size)
+{
+    int32_t i;
+    for (i = 0; i < size; i++)
+    {
+        scale[i] = nn_bench_rand_range(1 << 29, 0x7FFFFFFF);
+        shift[i] = nn_bench_rand_range(-10, -6);
+    }
+}
+
+//==============================================================================
+// Convolution
+//==============================================================================
+
+typedef struct
+{
+    const char *shape;
+    uint16_t in_x, in_y, in_ch, batch;
+    uint16_t out_ch, ker_x, ker_y;
+    uint16_t pad_x, pad_y, stride_x, stride_y;
+    uint16_t dilation_x, dilation_y;
+} conv_shape;
+
+typedef struct
+{
+    conv_shape s;
+    uint16_t out_x, out_y;
+    int8_t *in, *wt, *out;
+    int32_t *bias, *scale, *shift;
+    int16_t *buf;
+} conv_args;
+
+static void conv_args_init(conv_args *a, const conv_shape *s, int32_t depthwise)
+{
+    const int32_t ker_ch = depthwise ? 1 : s->in_ch;
+    const int32_t eff_kx = s->dilation_x * (s->ker_x - 1) + 1;
+    const int32_t eff_ky = s->dilation_y * (s->ker_y - 1) + 1;
+
+    a->s = *s;
+    a->out_x = (s->in_x + 2 * s->pad_x - eff_kx) / s->stride_x + 1;
+    a->out_y = (s->in_y + 2 * s->pad_y - eff_ky) / s->stride_y + 1;
+    a->in = nn_bench_alloc((size_t)s->in_x * s->in_y * s->in_ch * s->batch);
+    a->wt = nn_bench_alloc((size_t)s->out_ch * s->ker_x * s->ker_y * ker_ch);
+    a->out = nn_bench_alloc((size_t)a->out_x * a->out_y * s->out_ch * s->batch);
+    a->bias = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    a->scale = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    a->shift = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    nn_bench_fill_s8(a->in, (size_t)s->in_x * s->in_y * s->in_ch * s->batch, -128, 127);
+    nn_bench_fill_s8(a->wt, (size_t)s->out_ch * s->ker_x * s->ker_y * ker_ch, -127, 127);
+    nn_bench_fill_s32(a->bias, s->out_ch, -5000, 5000);
+    fill_quant_params(a->scale, a->shift, s->out_ch);
+    a->buf = NULL;
+}
+
+static void conv_args_free(conv_args *a)
+{
+    free(a->in);
+    free(a->wt);
+    free(a->out);
+    free(a->bias);
+    free(a->scale);
+    free(a->shift);
+    free(a->buf);
+}
+
+static void run_conv_wrapper_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(a->in, a->s.in_x, a->s.in_y, a->s.in_ch, a->s.batch,
+        a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.in_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_wrapper_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->wt, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x,
+        a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale,
+        a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_trans_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y, 0, 0,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, (int8_t *)a->buf);
+}
+
+static uint64_t conv_bytes(const conv_args *a, int32_t ker_ch)
+{
+    return (uint64_t)a->s.in_x * a->s.in_y * a->s.in_ch * a->s.batch
+         + (uint64_t)a->s.out_ch * a->s.ker_x * a->s.ker_y * ker_ch
+         + (uint64_t)a->out_x * a->out_y * a->s.out_ch * a->s.batch;
+}
+
+static const conv_shape conv_shapes[] =
+{
+    // name                        in_x in_y in_ch b  out kx  ky pad_x pad_y sx sy dx dy
+    {"mobilenet_v1_0.25_conv0",      96,  96,   3, 1,   8,  3,  3,  1,  1,  2, 2, 1, 1},
+    {"mobilenet_v1_0.25_pw_24x24",   24,  24,  32, 1,  64,  1,  1,  0,  0,  1, 1, 1, 1},
+    {"mobilenet_v1_0.25_pw_6x6",      6,   6, 128, 1, 256,  1,  1,  0,  0,  1, 1, 1, 1},
+    {"mobilenet_v2_pw_s2_28x28",     28,  28,  64, 1, 128,  1,  1,  0,  0,  2, 2, 1, 1},
+    {"ds_cnn_conv0_10x4",            10,  49,   1, 1,  64,  4, 10,  1,  4,  2, 2, 1, 1},
+    {"ds_cnn_pw_25x5",                5,  25,  64, 1,  64,  1,  1,  0,  0,  1, 1, 1, 1},
+    {"resnet_3x3_16x16",             16,  16,  32, 1,  32,  3,  3,  1,  1,  1, 1, 1, 1},
+    {"deeplab_3x3_dil2_16x16",       16,  16,  32, 1,  32,  3,  3,  2,  2,  1, 1, 2, 2},
+    {"conv1d_1x5_seq64",             64,   1,  32, 1,  32,  5,  1,  2,  0,  1, 1, 1, 1},
+};
+
+static const conv_shape conv_dw_shapes[] =
+{
+    {"mobilenet_v1_0.25_dw_48x48",   48,  48,   8, 1,   8,  3,  3,  1,  1,  1, 1, 1, 1},
+    {"mobilenet_v1_0.25_dw_s2_24x24",24,  24,  32, 1,  32,  3,  3,  1,  1,  2, 2, 1, 1},
+    {"mobilenet_v2_dw_14x14",        14,  14, 192, 1, 192,  3,  3,  1,  1,  1, 1, 1, 1},
+    {"ds_cnn_dw_25x5",                5,  25,  64, 1,  64,  3,  3,  1,  1,  1, 1, 1, 1},
+    {"efficientnet_dw5x5_14x14",     14,  14,  96, 1,  96,  5,  5,  2,  2,  1, 1, 1, 1},
+    {"convnext_dw7x7_14x14",         14,  14,  64, 1,  64,  7,  7,  3,  3,  1, 1, 1, 1},
+};
+
+static const conv_shape conv_trans_shapes[] =
+{
+    {"unet_up_8x8_to_16x16",          8,   8,  32, 1,  16,  2,  2,  0,  0,  2, 2, 1, 1},
+    {"segnet_up_3x3_s2_12x12",       12,  12,  16, 1,  16,  3,  3,  1,  1,  2, 2, 1, 1},
+};
+
+static void bench_convolution(void)
+{
+    const char *family = "convolution";
+    char shape[160];
+    size_t i;
+
+    for (i = 0; i < sizeof(conv_shapes) / sizeof(conv_shapes[0]); i++)
+    {
+        const conv_shape *s = &conv_shapes[i];
+        conv_args a;
+        conv_args_init(&a, s, 0);
+        a.buf = nn_bench_alloc(riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(
+            s->in_x, s->in_y, s->in_ch, s->batch, s->ker_x, s->ker_y, s->in_ch, s->pad_x,
+            s->pad_y, s->stride_x, s->stride_y, a.out_x, a.out_y, s->out_ch, s->dilation_x,
+            s->dilation_y));
+        snprintf(shape, sizeof(shape), "%s %ux%ux%u->%ux%ux%u k%ux%u",
+                 s->shape, s->in_y, s->in_x, s->in_ch, a.out_y, a.out_x, s->out_ch, s->ker_y, s->ker_x);
+        bench_report(family, "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym", shape, run_conv_wrapper_s8, &a,
+                     (uint64_t)a.out_x * a.out_y * s->out_ch * s->ker_x * s->ker_y * s->in_ch * s->batch,
+                     conv_bytes(&a, s->in_ch));
+        conv_args_free(&a);
+    }
+
+    for (i = 0; i < sizeof(conv_dw_shapes) / sizeof(conv_dw_shapes[0]); i++)
+    {
+        const conv_shape *s = &conv_dw_shapes[i];
+        conv_args a;
+        conv_args_init(&a, s, 1);
+        a.buf = nn_bench_alloc(riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(
+            s->in_ch, s->out_ch / s->in_ch, s->ker_x, s->ker_y, s->pad_x));
+        snprintf(shape, sizeof(shape), "%s %ux%ux%u->%ux%ux%u k%ux%u",
+                 s->shape, s->in_y, s->in_x, s->in_ch, a.out_y, a.out_x, s->out_ch, s->ker_y, s->ker_x);
+        bench_report(family, "riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym", shape, run_conv_dw_wrapper_s8, &a,
+                     (uint64_t)a.out_x * a.out_y * s->out_ch * s->ker_x * s->ker_y,
+                     conv_bytes(&a, 1));
+        conv_args_free(&a);
+    }
+
+    for (i = 0; i < sizeof(conv_trans_shapes) / sizeof(conv_trans_shapes[0]); i++)
+    {
+        const conv_shape *s = &conv_trans_shapes[i];
+        conv_args a;
+        conv_args_init(&a, s, 0);
+        // transposed convolution: the output grows by the stride
+        free(a.out);
+        a.out_x = (s->in_x - 1) * s->stride_x + s->ker_x - 2 * s->pad_x;
+        a.out_y = (s->in_y - 1) * s->stride_y + s->ker_y - 2 * s->pad_y;
+        a.out = nn_bench_alloc((size_t)a.out_x * a.out_y * s->out_ch * s->batch);
+        a.buf = nn_bench_alloc(riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(
+            s->in_x, s->in_y, s->in_ch, s->batch, s->out_ch, s->ker_x, s->ker_y, s->pad_x,
+            s->pad_y, s->stride_x, s->stride_y, a.out_x, a.out_y));
+        snprintf(shape, sizeof(shape), "%s %ux%ux%u->%ux%ux%u k%ux%u",
+                 s->shape, s->in_y, s->in_x, s->in_ch, a.out_y, a.out_x, s->out_ch, s->ker_y, s->ker_x);
+        bench_report(family, "riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any", shape, run_conv_trans_s8, &a,
+                     (uint64_t)s->in_x * s->in_y * s->out_ch * s->ker_x * s->ker_y * s->in_ch * s->batch,
+                     conv_bytes(&a, s->in_ch));
+        conv_args_free(&a);
+    }
+}
+
+//==============================================================================
+// Fully-connected and batch matrix multiplication
+//==============================================================================
+
+typedef struct
+{
+    const char *shape;
+    uint16_t in_col, out_row, batch;
+} fc_shape;
+
+typedef struct
+{
+    fc_shape s;
+    int8_t *in, *wt, *out;
+    int32_t *bias;
+    int16_t *buf;
+} fc_args;
+
+static void run_fc_s8(void *args)
+{
+    fc_args *a = (fc_args *)args;
+    riscv_nn_fc_s8_s8_s8_asym_bias(a->in, a->wt, a->s.in_col, a->s.out_row, a->s.batch, 7, 0,
+                                   1518500250, -8, -3, a->bias, a->out, -128, 127, a->buf);
+}
+
+static const fc_shape fc_shapes[] =
+{
+    {"ds_cnn_classifier",         64,   12,  1},
+    {"mobilenet_classifier",     256, 1000,  1},
+    {"transformer_qkv_seq1",      64,  192,  1},
+    {"transformer_ffn_up_seq8",   64,  256,  8},
+    {"transformer_ffn_down_seq64",256,  64, 64},
+};
+
+typedef struct
+{
+    const char *shape;
+    int32_t n, h, lhs_rows, rhs_rows, cols;
+} bmm_shape;
+
+typedef struct
+{
+    bmm_shape s;
+    int8_t *lhs, *rhs, *out;
+    int16_t *lhs16, *rhs16, *out16;
+} bmm_args;
+
+static void run_batch_matmul_s8(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    riscv_nn_batch_matmul_s8_s8_s8(a->lhs, a->rhs, 3, 0, NULL, a->out, -2, 1518500250, -9,
+                                   a->s.n, a->s.h, a->s.lhs_rows, a->s.n, a->s.h, a->s.rhs_rows,
+                                   a->s.cols, a->s.n, a->s.h, -128, 127);
+}
+
+static void run_batch_matmul_s16(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    riscv_nn_batch_matmul_s16_s16_s16(a->lhs16, a->rhs16, 0, 0, NULL, a->out16, 0, 1518500250, -25,
+                                      a->s.n, a->s.h, a->s.lhs_rows, a->s.n, a->s.h, a->s.rhs_rows,
+                                      a->s.cols, a->s.n, a->s.h, -32768, 32767);
+}
+
+static const bmm_shape bmm_shapes[] =
+{
+    // Q.K^T: (seq x d) x (seq x d)^T per head
+    {"attn_qk_h4_seq64_d32",   1, 4,  64,  64, 32},
+    {"attn_qk_h8_seq128_d64",  1, 8, 128, 128, 64},
+    {"attn_qk_h4_seq256_d64",  1, 4, 256, 256, 64},
+    // P.V with V already transposed: (seq x seq) x (d x seq)^T per head
+    {"attn_pv_h4_seq64_d32",   1, 4,  64,  32, 64},
+    {"attn_pv_h8_seq128_d64",  1, 8, 128,  64, 128},
+    {"attn_pv_h4_seq256_d64",  1, 4, 256,  64, 256},
+};
+
+typedef struct
+{
+    const char *shape;
+    int32_t heads, seq, head_dim, causal;
+} attn_shape;
+
+typedef struct
+{
+    attn_shape s;
+    int8_t *q, *k, *v, *scores, *probs, *out;
+    int16_t *buf;
+} attn_args;
+
+static void run_attention_s8(void *args)
+{
+    attn_args *a = (attn_args *)args;
+    riscv_nn_attention_s8_s8_s8(a->q, a->k, a->v, NULL, a->out, 1, a->s.heads, a->s.heads, a->s.seq, a->s.seq,
+                                a->s.head_dim, 3, 0, -2, 1518500250, -9, 1077952576, 23, -248, -5,
+                                1518500250, 1, -128, 127, a->s.causal, a->buf);
+}
+
+// the same layer as batch matmul, softmax and batch matmul, storing the
+// seq x seq scores and probabilities of every head
+static void run_attention_unfused_s8(void *args)
+{
+    attn_args *a = (attn_args *)args;
+    const int32_t h = a->s.heads;
+    const int32_t seq = a->s.seq;
+    riscv_nn_batch_matmul_s8_s8_s8(a->q, a->k, 3, 0, NULL, a->scores, 0, 1518500250, -9, 1, h, seq, 1, h,
+                                   seq, a->s.head_dim, 1, h, -128, 127);
+    riscv_nn_softmax_s8_hp(a->scores, h * seq, seq, 1077952576, 23, -248, a->probs);
+    riscv_nn_batch_matmul_s8_s8_s8_rhs_nt(a->probs, a->v, 128, -2, NULL, a->out, -5, 1518500250, -7, 1, h,
+                                          seq, 1, h, seq, a->s.head_dim, 1, h, -128, 127);
+}
+
+static const attn_shape attn_shapes[] =
+{
+    {"attn_h4_seq64_d32",         4,  64, 32, 0},
+    {"attn_h8_seq128_d64",        8, 128, 64, 0},
+    {"attn_h4_seq256_d64",        4, 256, 64, 0},
+    {"attn_h4_seq256_d64_causal", 4, 256, 64, 1},
+};
+
+static void bench_fully_connected(void)
+{
+    const char *family = "fully_connected";
+    char shape[160];
+    size_t i;
+
+    for (i = 0; i < sizeof(fc_shapes) / sizeof(fc_shapes[0]); i++)
+    {
+        const fc_shape *s = &fc_shapes[i];
+        fc_args a;
+        a.s = *s;
+        a.in = nn_bench_alloc((size_t)s->in_col * s->batch);
+        a.wt = nn_bench_alloc((size_t)s->in_col * s->out_row);
+        a.out = nn_bench_alloc((size_t)s->out_row * s->batch);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->out_row);
+        a.buf = nn_bench_alloc(riscv_nn_fc_s8_s8_s8_asym_bias_get_buffer_size(s->in_col));
+        nn_bench_fill_s8(a.in, (size_t)s->in_col * s->batch, -128, 127);
+        nn_bench_fill_s8(a.wt, (size_t)s->in_col * s->out_row, -127, 127);
+        nn_bench_fill_s32(a.bias, s->out_row, -5000, 5000);
+        snprintf(shape, sizeof(shape), "%s batch%u %u->%u", s->shape, s->batch, s->in_col, s->out_row);
+        bench_report(family, "riscv_nn_fc_s8_s8_s8_asym_bias", shape, run_fc_s8, &a,
+                     (uint64_t)s->in_col * s->out_row * s->batch,
+                     (uint64_t)s->in_col * s->batch + (uint64_t)s->in_col * s->out_row
+                     + (uint64_t)s->out_row * s->batch);
+        free(a.in);
+        free(a.wt);
+        free(a.out);
+        free(a.bias);
+        free(a.buf);
+    }
+
+    for (i = 0; i < sizeof(bmm_shapes) / sizeof(bmm_shapes[0]); i++)
+    {
+        const bmm_shape *s = &bmm_shapes[i];
+        const size_t lhs_size = (size_t)s->n * s->h * s->lhs_rows * s->cols;
+        const size_t rhs_size = (size_t)s->n * s->h * s->rhs_rows * s->cols;
+        const size_t out_size = (size_t)s->n * s->h * s->lhs_rows * s->rhs_rows;
+        bmm_args a;
+        a.s = *s;
+        a.lhs = nn_bench_alloc(lhs_size);
+        a.rhs = nn_bench_alloc(rhs_size);
+        a.out = nn_bench_alloc(out_size);
+        nn_bench_fill_s8(a.lhs, lhs_size, -128, 127);
+        nn_bench_fill_s8(a.rhs, rhs_size, -127, 127);
+        snprintf(shape, sizeof(shape), "%s", s->shape);
+        bench_report(family, "riscv_nn_batch_matmul_s8_s8_s8", shape, run_batch_matmul_s8, &a,
+                     (uint64_t)out_size * s->cols, lhs_size + rhs_size + out_size);
+        a.lhs16 = nn_bench_alloc(sizeof(int16_t) * lhs_size);
+        a.rhs16 = nn_bench_alloc(sizeof(int16_t) * rhs_size);
+        a.out16 = nn_bench_alloc(sizeof(int16_t) * out_size);
+        nn_bench_fill_s16(a.lhs16, lhs_size, -32768, 32767);
+        nn_bench_fill_s16(a.rhs16, rhs_size, -32768, 32767);
+        bench_report(family, "riscv_nn_batch_matmul_s16_s16_s16", shape, run_batch_matmul_s16, &a,
+                     (uint64_t)out_size * s->cols, 2 * (lhs_size + rhs_size + out_size));
+        free(a.lhs);
+        free(a.rhs);
+        free(a.out);
+        free(a.lhs16);
+        free(a.rhs16);
+        free(a.out16);
+    }
+
+    for (i = 0; i < sizeof(attn_shapes) / sizeof(attn_shapes[0]); i++)
+    {
+        const attn_shape *s = &attn_shapes[i];
+        const size_t qkv_size = (size_t)s->heads * s->seq * s->head_dim;
+        const size_t score_size = (size_t)s->heads * s->seq * s->seq;
+        attn_args a;
+        a.s = *s;
+        a.q = nn_bench_alloc(qkv_size);
+        a.k = nn_bench_alloc(qkv_size);
+        a.v = nn_bench_alloc(qkv_size);
+        a.out = nn_bench_alloc(qkv_size);
+        a.scores = nn_bench_alloc(score_size);
+        a.probs = nn_bench_alloc(score_size);
+        a.buf = nn_bench_alloc(riscv_nn_attention_s8_s8_s8_get_buffer_size(s->head_dim));
+        nn_bench_fill_s8(a.q, qkv_size, -128, 127);
+        nn_bench_fill_s8(a.k, qkv_size, -127, 127);
+        nn_bench_fill_s8(a.v, qkv_size, -127, 127);
+        snprintf(shape, sizeof(shape), "%s", s->shape);
+        bench_report(family, "riscv_nn_attention_s8_s8_s8", shape, run_attention_s8, &a,
+                     2 * (uint64_t)score_size * s->head_dim, 4 * qkv_size);
+        if (!s->causal)
+        {
+            bench_report(family, "attention_s8 (batch_matmul + softmax_s8_hp + batch_matmul)", shape,
+                         run_attention_unfused_s8, &a, 2 * (uint64_t)score_size * s->head_dim,
+                         4 * qkv_size + 4 * score_size);
+        }
+        free(a.q);
+        free(a.k);
+        free(a.v);
+        free(a.out);
+        free(a.scores);
+        free(a.probs);
+        free(a.buf);
+    }
+}
+
+//==============================================================================
+// Pooling
+//==============================================================================
+
+typedef struct
+{
+    const char *shape;
+    int32_t in_x, in_y, ch, ker_x, ker_y, stride_x, stride_y, pad_x, pad_y;
+} pool_shape;
+
+typedef struct
+{
+    pool_shape s;
+    int32_t out_x, out_y;
+    int8_t *in, *out;
+    int16_t *buf;
+} pool_args;
+
+static void run_avepool_s8(void *args)
+{
+    pool_args *a = (pool_args *)args;
+    riscv_nn_avepool_HWC_s8_any_act(1, a->s.in_y, a->s.in_x, a->out_y, a->out_x, a->s.stride_y,
+                                    a->s.stride_x, a->s.ker_y, a->s.ker_x, a->s.pad_y, a->s.pad_x,
+                                    -128, 127, a->s.ch, a->in, a->buf, a->out);
+}
+
+static void run_maxpool_s8(void *args)
+{
+    pool_args *a = (pool_args *)args;
+    riscv_nn_maxpool_HWC_s8_any_act(1, a->s.in_y, a->s.in_x, a->out_y, a->out_x, a->s.stride_y,
+                                    a->s.stride_x, a->s.ker_y, a->s.ker_x, a->s.pad_y, a->s.pad_x,
+                                    -128, 127, a->s.ch, a->in, a->buf, a->out);
+}
+
+static const pool_shape pool_shapes[] =
+{
+    {"ds_cnn_global_25x5",     5, 25,  64,  5, 25, 1, 1, 0, 0},
+    {"mobilenet_global_3x3",   3,  3, 256,  3,  3, 1, 1, 0, 0},
+    {"kws_cnn_2x2_s2_48x48",  48, 48,  16,  2,  2, 2, 2, 0, 0},
+};
+
+static void bench_pooling(void)
+{
+    const char *family = "pooling";
+    char shape[160];
+    size_t i;
+
+    for (i = 0; i < sizeof(pool_shapes) / sizeof(pool_shapes[0]); i++)
+    {
+        const pool_shape *s = &pool_shapes[i];
+        pool_args a;
+        uint64_t bytes;
+        a.s = *s;
+        a.out_x = (s->in_x + 2 * s->pad_x - s->ker_x) / s->stride_x + 1;
+        a.out_y = (s->in_y + 2 * s->pad_y - s->ker_y) / s->stride_y + 1;
+        a.in = nn_bench_alloc((size_t)s->in_x * s->in_y * s->ch);
+        a.out = nn_bench_alloc((size_t)a.out_x * a.out_y * s->ch);
+        a.buf = nn_bench_alloc(riscv_nn_avepool_HWC_s8_any_act_get_buffer_size(a.out_x, s->ch));
+        nn_bench_fill_s8(a.in, (size_t)s->in_x * s->in_y * s->ch, -128, 127);
+        bytes = (uint64_t)s->in_x * s->in_y * s->ch + (uint64_t)a.out_x * a.out_y * s->ch;
+        snprintf(shape, sizeof(shape), "%s", s->shape);
+        bench_report(family, "riscv_nn_avepool_HWC_s8_any_act", shape, run_avepool_s8, &a, 0, bytes);
+        bench_report(family, "riscv_nn_maxpool_HWC_s8_any_act", shape, run_maxpool_s8, &a, 0, bytes);
+        free(a.in);
+        free(a.out);
+        free(a.buf);
+    }
+}
+
+//==============================================================================
+// Element-wise families: activation, basic, softmax, util, concatenation
+//==============================================================================
+
+typedef struct
+{
+    uint32_t size, rows, cols;
+    int8_t *in1, *in2, *out;
+    int16_t *out16;
+    float *fin, *fout, *gamma, *beta;
+} ew_args;
+
+static void run_relu_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    memcpy(a->out, a->in1, a->size);
+    riscv_nn_relu_s8(a->out, a->size);
+}
+
+static void run_leaky_relu_s8_asym(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_leaky_relu_s8_asym(a->in1, a->out, a->size, 1518500250, -1, 1288490189, -3, 5, -5,
+                                -128, 127);
+}
+
+static void run_tanh_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_tanh_s8(0, 127, 16384, 1, a->size, a->in1, a->out);
+}
+
+static void run_sigmoid_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_sigmoid_s8(0, 127, 16384, 1, a->size, a->in1, a->out);
+}
+
+static void run_gelu_f32(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_gelu_f32(a->fin, a->size, a->fout);
+}
+
+static void run_ew_add_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_ew_add_s8_asym(a->in1, a->in2, 5, 1073741824, 0, -3, 1288490189, 0, 20, a->out, -7,
+                            1518500250, -21, -128, 127, a->size);
+}
+
+static void run_ew_mul_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_ew_mul_s8_asym(a->in1, a->in2, 5, -3, a->out, -7, 1518500250, -9, -128, 127, a->size);
+}
+
+static void run_softmax_s8_fast(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    uint32_t r;
+    for (r = 0; r < a->rows; r++)
+    {
+        riscv_nn_softmax_s8_fast(a->in1 + r * a->cols, a->cols, a->out + r * a->cols);
+    }
+}
+
+static void run_softmax_s8_hp(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_softmax_s8_hp(a->in1, a->rows, a->cols, 1077952576, 23, -248, a->out);
+}
+
+static void run_softmax_s8_s16_hp(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_softmax_s8_s16_hp(a->in1, a->rows, a->cols, 1077952576, 23, -248, a->out16);
+}
+
+static void run_softmax_f32(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    uint32_t r;
+    for (r = 0; r < a->rows; r++)
+    {
+        riscv_nn_softmax_f32(a->fin + r * a->cols, a->cols, a->fout + r * a->cols);
+    }
+}
+
+static void run_layer_norm_f32(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_layer_norm_f32(a->fin, 1e-5f, a->beta, a->gamma, a->rows, a->cols, a->fout);
+}
+
+static void run_requantize_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_requantize_s8_s8(a->in1, a->out, a->size, 1518500250, -1, 3, -4, -128, 127);
+}
+
+static void run_quantize_f32_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_quantize_f32_s8(a->fin, a->size, a->out, 0.02f, 3, -128, 127);
+}
+
+static void run_transpose_4d_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    // (1, seq, heads, d) -> (1, heads, seq, d)
+    riscv_nn_transpose_4d_s8(a->in1, 1, a->rows, 4, a->cols / 4, NN_WZYX_2_WYZX, a->out);
+}
+
+static void run_concate_s8_z(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    riscv_nn_concate_s8_z(a->in1, a->cols, a->rows, 1, 1, a->out, 2, 0);
+    riscv_nn_concate_s8_z(a->in2, a->cols, a->rows, 1, 1, a->out, 2, 1);
+}
+
+static void run_pad_s8(void *args)
+{
+    ew_args *a = (ew_args *)args;
+    // pad an HWC feature map of rows x rows x (cols / rows) by one pixel
+    riscv_nn_pad_s8(a->in1, 1, a->rows, a->rows, a->cols / a->rows, 0, 1, 1, 0, 0, 1, 1, 0, -5, a->out);
+}
+
+static void bench_elementwise(void)
+{
+    // 48x48x16 feature map (KWS/MobileNet activations) and a 64x64 transformer
+    // score / hidden-state matrix
+    const uint32_t size = 48 * 48 * 16;
+    const uint32_t rows = 64;
+    const uint32_t cols = 64;
+    const uint32_t out_size = (rows + 2) * (rows + 2) * (cols / rows) > 2 * size ? (rows + 2) * (rows + 2) * (cols / rows) : 2 * size;
+    char shape[160];
+    ew_args a;
+
+    a.size = size;
+    a.rows = rows;
+    a.cols = cols;
+    a.in1 = nn_bench_alloc(size);
+    a.in2 = nn_bench_alloc(size);
+    a.out = nn_bench_alloc(out_size);
+    a.out16 = nn_bench_alloc(sizeof(int16_t) * size);
+    a.fin = nn_bench_alloc(sizeof(float) * size);
+    a.fout = nn_bench_alloc(sizeof(float) * size);
+    a.gamma = nn_bench_alloc(sizeof(float) * cols);
+    a.beta = nn_bench_alloc(sizeof(float) * cols);
+    nn_bench_fill_s8(a.in1, size, -128, 127);
+    nn_bench_fill_s8(a.in2, size, -128, 127);
+    nn_bench_fill_f32(a.fin, size, -4.0f, 4.0f);
+    nn_bench_fill_f32(a.gamma, cols, 0.5f, 1.5f);
+    nn_bench_fill_f32(a.beta, cols, -0.5f, 0.5f);
+
+    snprintf(shape, sizeof(shape), "feature_map_48x48x16");
+    bench_report("activation", "riscv_nn_relu_s8", shape, run_relu_s8, &a, 0, 2ull * size);
+    bench_report("activation", "riscv_nn_leaky_relu_s8_asym", shape, run_leaky_relu_s8_asym, &a, 0, 2ull * size);
+    bench_report("activation", "riscv_nn_tanh_s8", shape, run_tanh_s8, &a, 0, 2ull * size);
+    bench_report("activation", "riscv_nn_sigmoid_s8", shape, run_sigmoid_s8, &a, 0, 2ull * size);
+    bench_report("activation", "riscv_nn_gelu_f32", shape, run_gelu_f32, &a, 0, 8ull * size);
+    bench_report("basic", "riscv_nn_ew_add_s8_asym", shape, run_ew_add_s8, &a, 0, 3ull * size);
+    bench_report("basic", "riscv_nn_ew_mul_s8_asym", shape, run_ew_mul_s8, &a, 0, 3ull * size);
+    bench_report("util", "riscv_nn_requantize_s8_s8", shape, run_requantize_s8, &a, 0, 2ull * size);
+    bench_report("util", "riscv_nn_quantize_f32_s8", shape, run_quantize_f32_s8, &a, 0, 5ull * size);
+
+    snprintf(shape, sizeof(shape), "attention_scores_%ux%u", rows, cols);
+    bench_report("softmax", "riscv_nn_softmax_s8_fast", shape, run_softmax_s8_fast, &a, 0, 2ull * rows * cols);
+    bench_report("softmax", "riscv_nn_softmax_s8_hp", shape, run_softmax_s8_hp, &a, 0, 2ull * rows * cols);
+    bench_report("softmax", "riscv_nn_softmax_s8_s16_hp", shape, run_softmax_s8_s16_hp, &a, 0, 3ull * rows * cols);
+    bench_report("softmax", "riscv_nn_softmax_f32", shape, run_softmax_f32, &a, 0, 8ull * rows * cols);
+
+    snprintf(shape, sizeof(shape), "hidden_state_seq%u_d%u", rows, cols);
+    bench_report("util", "riscv_nn_layer_norm_f32", shape, run_layer_norm_f32, &a, 0, 8ull * rows * cols);
+    bench_report("util", "riscv_nn_transpose_4d_s8", shape, run_transpose_4d_s8, &a, 0, 2ull * rows * cols);
+    bench_report("concatenation", "riscv_nn_concate_s8_z", shape, run_concate_s8_z, &a, 0, 4ull * rows * cols);
+    bench_report("concatenation", "riscv_nn_pad_s8", shape, run_pad_s8, &a, 0,
+                 (uint64_t)rows * cols + (uint64_t)(rows + 2) * (rows + 2) * (cols / rows));
+
+    free(a.in1);
+    free(a.in2);
+    free(a.out);
+    free(a.out16);
+    free(a.fin);
+    free(a.fout);
+    free(a.gamma);
+    free(a.beta);
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            bench_filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc)
+        {
+            bench_min_time_ns = (uint64_t)strtoul(argv[++i], NULL, 10) * 1000000ull;
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            bench_list_only = 1;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--filter <substring>] [--min-time-ms <ms>] [--list]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    nn_bench_srand(1);
+    if (!bench_list_only)
+    {
+        printf("{\n  \"library\": \"libnn\",\n  \"version\": \"%s\",\n  \"min_time_ms\": %llu,\n  \"results\": [",
+               get_version_libnn(), (unsigned long long)(bench_min_time_ns / 1000000ull));
+    }
+
+    bench_convolution();
+    bench_fully_connected();
+    bench_pooling();
+    bench_elementwise();
+
+    if (!bench_list_only)
+    {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
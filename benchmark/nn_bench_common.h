@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+// Helpers shared by the host-side benchmark and conformance programs. They are
+// not part of the library and are only meant to be built for a host target.
+
+#ifndef __NN_BENCH_COMMON_H__
+#define __NN_BENCH_COMMON_H__
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef void (*nn_bench_run_fn)(void *args);
+
+static inline uint64_t nn_bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Return the average time (in ns) of one call to "run". The number of calls is
+// doubled until a batch lasts at least "min_time_ns"; the best of three such
+// batches is reported to filter out scheduling noise.
+static inline double nn_bench_time_ns(nn_bench_run_fn run, void *args, uint64_t min_time_ns)
+{
+    uint64_t iters = 1;
+    uint64_t elapsed;
+    double best;
+    int rep;
+
+    run(args);  // warm up caches and page in the buffers
+
+    for (;;)
+    {
+        uint64_t i;
+        uint64_t start = nn_bench_now_ns();
+        for (i = 0; i < iters; i++)
+        {
+            run(args);
+        }
+        elapsed = nn_bench_now_ns() - start;
+        if (elapsed >= min_time_ns || iters >= (1ull << 30))
+        {
+            break;
+        }
+        iters <<= 1;
+    }
+
+    best = (double)elapsed / (double)iters;
+    for (rep = 0; rep < 2; rep++)
+    {
+        uint64_t i;
+        uint64_t start = nn_bench_now_ns();
+        for (i = 0; i < iters; i++)
+        {
+            run(args);
+        }
+        elapsed = nn_bench_now_ns() - start;
+        if ((double)elapsed / (double)iters < best)
+        {
+            best = (double)elapsed / (double)iters;
+        }
+    }
+    return best;
+}
+
+// xorshift32; deterministic so that every run sees the same data
+static uint32_t nn_bench_seed = 0x2545F491u;
+
+static inline void nn_bench_srand(uint32_t seed)
+{
+    nn_bench_seed = seed ? seed : 0x2545F491u;
+}
+
+static inline uint32_t nn_bench_rand(void)
+{
+    uint32_t x = nn_bench_seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    nn_bench_seed = x;
+    return x;
+}
+
+static inline int32_t nn_bench_rand_range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(nn_bench_rand() % (uint32_t)(hi - lo + 1));
+}
+
+static inline void nn_bench_fill_s8(int8_t *dst, size_t size, int32_t lo, int32_t hi)
+{
+    size_t i;
+    for (i = 0; i < size; i++)
+    {
+        dst[i] = (int8_t)nn_bench_rand_range(lo, hi);
+    }
+}
+
+static inline void nn_bench_fill_s16(int16_t *dst, size_t size, int32_t lo, int32_t hi)
+{
+    size_t i;
+    for (i = 0; i < size; i++)
+    {
+        dst[i] = (int16_t)nn_bench_rand_range(lo, hi);
+    }
+}
+
+static inline void nn_bench_fill_s32(int32_t *dst, size_t size, int32_t lo, int32_t hi)
+{
+    size_t i;
+    for (i = 0; i < size; i++)
+    {
+        dst[i] = nn_bench_rand_range(lo, hi);
+    }
+}
+
+static inline void nn_bench_fill_f32(float *dst, size_t size, float lo, float hi)
+{
+    size_t i;
+    for (i = 0; i < size; i++)
+    {
+        dst[i] = lo + (hi - lo) * (float)(nn_bench_rand() & 0xFFFFFF) / (float)0xFFFFFF;
+    }
+}
+
+static inline void *nn_bench_alloc(size_t size)
+{
+    // never hand a zero-sized request to malloc; some kernels accept NULL
+    // scratch buffers but the harness always passes a valid pointer
+    void *ptr = calloc(1, size ? size : 1);
+    if (ptr == NULL)
+    {
+        fprintf(stderr, "out of memory (%zu bytes)\n", size);
+        exit(2);
+    }
+    return ptr;
+}
+
+#endif // __NN_BENCH_COMMON_H__
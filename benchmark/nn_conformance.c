@@ -0,0 +1,3017 @@
+/******************************************************************************
+ * Copyright (C) 2018-2025 Andes Technology Corporation. All rights reserved. *
+ *                                                                            *
+ * SPDX-License-Identifier: Apache-2.0                                        *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the License); you may      *
+ * not use this file except in compliance with the License.                   *
+ * You may obtain a copy of the License at                                    *
+ *                                                                            *
+ * www.apache.org/licenses/LICENSE-2.0                                        *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT    *
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.           *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ ******************************************************************************/
+
+/** @file*/
+
+// Randomized differential test and speedup table for the libnn kernel variants.
+//
+// Every case runs a naive scalar reference written in this file and then each
+// library variant able to handle the shape on the same random inputs. Integer
+// kernels must match the reference bit-exactly unless the case documents a
+// tolerance in LSBs; floating-point kernels are checked against a double
+// precision reference with a ULP bound. The time of each variant is reported
+// relative to the reference so that the fastest variant per shape can be read
+// from the table.
+//
+// Usage: nn_conformance [--filter <substring>] [--min-time-ms <ms>]
+//                       [--seed <n>] [--no-timing]
+//
+// The exit status is 1 if any variant is out of tolerance.
+
+#include "nn_bench_common.h"
+
+#include <math.h>
+
+#include "riscv_nn_basic.h"
+#include "riscv_nn_convolution.h"
+#include "riscv_nn_fully_connected.h"
+#include "riscv_nn_parallel.h"
+#include "riscv_nn_pooling.h"
+#include "riscv_nn_softmax.h"
+#include "riscv_nn_support.h"
+#include "riscv_nn_util.h"
+
+#ifndef MAX
+#define MAX(x, y) ((x) > (y) ? (x) : (y))
+#endif
+#ifndef MIN
+#define MIN(x, y) ((x) < (y) ? (x) : (y))
+#endif
+
+static const char *conf_filter = NULL;
+static uint64_t conf_min_time_ns = 2000000ull;
+static int conf_timing = 1;
+static int conf_failures = 0;
+static int conf_cases = 0;
+
+typedef enum
+{
+    CONF_S8,
+    CONF_S16,
+    CONF_F32
+} conf_type;
+
+// Every argument block of a case starts with this header so that the generic
+// checker can see the return value of the last call.
+typedef struct
+{
+    int32_t status;
+} conf_hdr;
+
+static int conf_selected(const char *group, const char *variant, const char *shape)
+{
+    if (conf_filter == NULL)
+    {
+        return 1;
+    }
+    return (strstr(group, conf_filter) != NULL) || (strstr(variant, conf_filter) != NULL) ||
+           (strstr(shape, conf_filter) != NULL);
+}
+
+static int32_t conf_ulp(float a, float b)
+{
+    int32_t ia, ib;
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    // map the sign-magnitude encoding onto a monotonic integer line
+    ia = (ia < 0) ? (int32_t)(0x80000000u - (uint32_t)ia) : ia;
+    ib = (ib < 0) ? (int32_t)(0x80000000u - (uint32_t)ib) : ib;
+    return (ia > ib) ? ia - ib : ib - ia;
+}
+
+// Return the largest element-wise error of "got" against "ref" (LSBs for the
+// integer types, ULPs for float) and the number of elements beyond "tol".
+static int32_t conf_max_err(conf_type type, const void *ref, const void *got, size_t size,
+                            int32_t tol, size_t *bad)
+{
+    int32_t max_err = 0;
+    size_t i;
+
+    *bad = 0;
+    for (i = 0; i < size; i++)
+    {
+        int32_t err;
+        switch (type)
+        {
+        case CONF_S8:
+            err = abs(((const int8_t *)ref)[i] - ((const int8_t *)got)[i]);
+            break;
+        case CONF_S16:
+            err = abs(((const int16_t *)ref)[i] - ((const int16_t *)got)[i]);
+            break;
+        default:
+            err = conf_ulp(((const float *)ref)[i], ((const float *)got)[i]);
+            break;
+        }
+        if (err > tol)
+        {
+            (*bad)++;
+        }
+        max_err = MAX(max_err, err);
+    }
+    return max_err;
+}
+
+static size_t conf_elem_size(conf_type type)
+{
+    return (type == CONF_S8) ? 1 : (type == CONF_S16) ? 2 : 4;
+}
+
+static double conf_time(nn_bench_run_fn run, void *args)
+{
+    return conf_timing ? nn_bench_time_ns(run, args, conf_min_time_ns) : 0.0;
+}
+
+// Run one variant into "got", compare it with "ref" and print one table row.
+// "ref_ns" is the time of the scalar reference on the same shape.
+static void conf_check(const char *group,
+                       const char *variant,
+                       const char *shape,
+                       nn_bench_run_fn run,
+                       void *args,
+                       conf_type type,
+                       const void *ref,
+                       void *got,
+                       size_t size,
+                       int32_t tol,
+                       double ref_ns)
+{
+    conf_hdr *hdr = (conf_hdr *)args;
+    const char *status;
+    int32_t max_err = 0;
+    size_t bad = 0;
+    double ns = 0.0;
+
+    if (!conf_selected(group, variant, shape))
+    {
+        return;
+    }
+
+    // poison the output so that unwritten elements are caught as well
+    memset(got, 0x5a, size * conf_elem_size(type));
+    hdr->status = 0;
+    run(args);
+    if (hdr->status != 0)
+    {
+        status = "skip";
+    }
+    else
+    {
+        max_err = conf_max_err(type, ref, got, size, tol, &bad);
+        status = bad ? "FAIL" : "ok";
+        if (bad)
+        {
+            conf_failures++;
+        }
+        else
+        {
+            ns = conf_time(run, args);
+        }
+    }
+    conf_cases++;
+
+    printf("%-16s %-62s %-20s %-4s %7ld %5ld %12.1f %8.2f\n", group, variant, shape, status,
+           (long)max_err, (long)tol, ns, (ns > 0.0) ? ref_ns / ns : 0.0);
+    if (bad)
+    {
+        printf("    %zu of %zu elements exceed the tolerance\n", bad, size);
+    }
+    fflush(stdout);
+}
+
+static void fill_quant_params(int32_t *scale, int32_t *shift, int32_t size)
+{
+    int32_t i;
+    for (i = 0; i < size; i++)
+    {
+        scale[i] = nn_bench_rand_range(1 << 29, 0x7FFFFFFF);
+        shift[i] = nn_bench_rand_range(-10, -6);
+    }
+}
+
+//==============================================================================
+// Scalar references
+//==============================================================================
+
+// Same rounding as the requantization used by every asymmetric s8 kernel.
+static int32_t ref_requantize(int32_t val, int32_t mult, int32_t shift)
+{
+    int64_t prod = (int64_t)val * mult;
+    int32_t res = (int32_t)(prod >> (30 - shift));
+    return (res + 1) >> 1;
+}
+
+static int8_t ref_output_s8(int32_t acc, int32_t mult, int32_t shift, int32_t out_offset,
+                            int32_t act_min, int32_t act_max)
+{
+    int32_t res = ref_requantize(acc, mult, shift) + out_offset;
+    res = MAX(res, act_min);
+    return (int8_t)MIN(res, act_max);
+}
+
+typedef struct
+{
+    const char *shape;
+    uint16_t in_x, in_y, in_ch, batch;
+    uint16_t out_ch, ker_x, ker_y, ker_ch;
+    uint16_t pad_x, pad_y, stride_x, stride_y;
+    uint16_t dilation_x, dilation_y;
+} conv_shape;
+
+// Grouped, dilated convolution of HWC tensors with OHWI weights; the number
+// of groups is in_ch / ker_ch. For depthwise layers ker_ch is 1 and the
+// weights are laid out as HWC with out_ch channels.
+static void ref_conv_s8_asym(const conv_shape *s, int32_t depthwise, const int8_t *in,
+                             const int8_t *wt, const int32_t *bias, const int32_t *shift,
+                             const int32_t *scale, int32_t out_offset, int32_t in_offset,
+                             int32_t act_min, int32_t act_max, int32_t out_x, int32_t out_y,
+                             int8_t *out)
+{
+    const int32_t groups = depthwise ? s->in_ch : s->in_ch / s->ker_ch;
+    const int32_t ker_ch = depthwise ? 1 : s->ker_ch;
+    const int32_t out_per_group = s->out_ch / groups;
+    int32_t b, oy, ox, oc, ky, kx, ic;
+
+    for (b = 0; b < s->batch; b++)
+    {
+        const int8_t *in_b = in + (size_t)b * s->in_x * s->in_y * s->in_ch;
+        int8_t *out_b = out + (size_t)b * out_x * out_y * s->out_ch;
+        for (oy = 0; oy < out_y; oy++)
+        {
+            for (ox = 0; ox < out_x; ox++)
+            {
+                for (oc = 0; oc < s->out_ch; oc++)
+                {
+                    const int32_t g = oc / out_per_group;
+                    int32_t acc = bias ? bias[oc] : 0;
+                    for (ky = 0; ky < s->ker_y; ky++)
+                    {
+                        const int32_t iy = oy * s->stride_y - s->pad_y + ky * s->dilation_y;
+                        for (kx = 0; kx < s->ker_x; kx++)
+                        {
+                            const int32_t ix = ox * s->stride_x - s->pad_x + kx * s->dilation_x;
+                            if (iy < 0 || iy >= s->in_y || ix < 0 || ix >= s->in_x)
+                            {
+                                continue;
+                            }
+                            for (ic = 0; ic < ker_ch; ic++)
+                            {
+                                const int32_t x = in_b[(iy * s->in_x + ix) * s->in_ch + g * ker_ch + ic];
+                                const int32_t w = depthwise ?
+                                    wt[(ky * s->ker_x + kx) * s->out_ch + oc] :
+                                    wt[((oc * s->ker_y + ky) * s->ker_x + kx) * ker_ch + ic];
+                                acc += (x + in_offset) * w;
+                            }
+                        }
+                    }
+                    out_b[(oy * out_x + ox) * s->out_ch + oc] =
+                        ref_output_s8(acc, scale[oc], shift[oc], out_offset, act_min, act_max);
+                }
+            }
+        }
+    }
+}
+
+// Symmetric convolution with the two-stage output shift of the *_sym_* kernels.
+static void ref_conv_s8_sym(const conv_shape *s, const int8_t *in, const int8_t *wt,
+                            const int32_t *bias, uint16_t pre_rshift, uint16_t out_scale,
+                            uint16_t post_rshift, int32_t out_x, int32_t out_y, int8_t *out)
+{
+    int32_t oy, ox, oc, ky, kx, ic;
+
+    for (oy = 0; oy < out_y; oy++)
+    {
+        for (ox = 0; ox < out_x; ox++)
+        {
+            for (oc = 0; oc < s->out_ch; oc++)
+            {
+                int32_t acc = bias[oc];
+                for (ky = 0; ky < s->ker_y; ky++)
+                {
+                    const int32_t iy = oy * s->stride_y - s->pad_y + ky;
+                    for (kx = 0; kx < s->ker_x; kx++)
+                    {
+                        const int32_t ix = ox * s->stride_x - s->pad_x + kx;
+                        if (iy < 0 || iy >= s->in_y || ix < 0 || ix >= s->in_x)
+                        {
+                            continue;
+                        }
+                        for (ic = 0; ic < s->in_ch; ic++)
+                        {
+                            acc += in[(iy * s->in_x + ix) * s->in_ch + ic] *
+                                   wt[((oc * s->ker_y + ky) * s->ker_x + kx) * s->in_ch + ic];
+                        }
+                    }
+                }
+                acc = (acc >> pre_rshift) * out_scale + (1 << (post_rshift - 1));
+                acc >>= post_rshift;
+                out[(oy * out_x + ox) * s->out_ch + oc] = (int8_t)MIN(MAX(acc, -128), 127);
+            }
+        }
+    }
+}
+
+// dst[m * dst_stride + n] = requant(bias[n] + sum_k (lhs[m][k] + lhs_offset) * (rhs[n][k] + rhs_offset))
+// with per-channel (mult, shift) arrays; a single pair is broadcast when
+// "per_channel" is zero.
+static void ref_gemm_s8(const int8_t *lhs, const int8_t *rhs, const int32_t *bias, int8_t *dst,
+                        const int32_t *mult, const int32_t *shift, int32_t per_channel,
+                        int32_t m_rows, int32_t n_rows, int32_t k_cols, int32_t lhs_offset,
+                        int32_t rhs_offset, int32_t dst_offset, int32_t act_min, int32_t act_max,
+                        int32_t dst_stride)
+{
+    int32_t m, n, k;
+
+    for (m = 0; m < m_rows; m++)
+    {
+        for (n = 0; n < n_rows; n++)
+        {
+            const int32_t c = per_channel ? n : 0;
+            int32_t acc = bias ? bias[n] : 0;
+            for (k = 0; k < k_cols; k++)
+            {
+                acc += (lhs[m * k_cols + k] + lhs_offset) * (rhs[n * k_cols + k] + rhs_offset);
+            }
+            dst[m * dst_stride + n] = ref_output_s8(acc, mult[c], shift[c], dst_offset, act_min, act_max);
+        }
+    }
+}
+
+//==============================================================================
+// Matrix multiplication
+//==============================================================================
+
+typedef struct
+{
+    const char *shape;
+    int32_t rows, cols;
+} vec_mat_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    vec_mat_shape s;
+    int8_t *lhs, *rhs, *ref, *out;
+    int32_t *bias, *kernel_sum;
+    int32_t mult, shift, rhs_offset;
+} vec_mat_args;
+
+static void run_ref_vec_mat(void *args)
+{
+    vec_mat_args *a = (vec_mat_args *)args;
+    ref_gemm_s8(a->lhs, a->rhs, a->bias, a->ref, &a->mult, &a->shift, 0, 1, a->s.rows, a->s.cols,
+                5, a->rhs_offset, -3, -128, 127, a->s.rows);
+}
+
+static void run_vec_mat_mult_t_s8(void *args)
+{
+    vec_mat_args *a = (vec_mat_args *)args;
+    a->hdr.status = riscv_nn_vec_mat_mult_t_s8(a->lhs, a->rhs, a->bias, a->out, 5, a->rhs_offset, -3,
+                                               a->mult, a->shift, a->s.cols, a->s.rows, -128, 127);
+}
+
+static void run_vec_mat_mult_t_s8_kernel_sum(void *args)
+{
+    vec_mat_args *a = (vec_mat_args *)args;
+    a->hdr.status = riscv_nn_vec_mat_mult_t_s8(a->lhs, a->rhs, a->kernel_sum, a->out, 0, 0, -3,
+                                               a->mult, a->shift, a->s.cols, a->s.rows, -128, 127);
+}
+
+static void run_vec_mat_mult_t_s8_v2(void *args)
+{
+    vec_mat_args *a = (vec_mat_args *)args;
+    a->hdr.status = riscv_nn_vec_mat_mult_t_s8_v2(a->lhs, a->rhs, a->bias, a->out, 5, a->rhs_offset, -3,
+                                                  a->mult, a->shift, a->s.cols, a->s.rows, -128, 127);
+}
+
+// _v3 takes no bias; the case is only run with bias == NULL
+static void run_vec_mat_mult_t_s8_v3(void *args)
+{
+    vec_mat_args *a = (vec_mat_args *)args;
+    a->hdr.status = riscv_nn_vec_mat_mult_t_s8_v3(a->lhs, a->rhs, NULL, a->out, 5, a->rhs_offset, -3,
+                                                  a->mult, a->shift, a->s.cols, a->s.rows, -128, 127, 1);
+}
+
+static const vec_mat_shape vec_mat_shapes[] =
+{
+    {"64x12", 12, 64},
+    {"255x33", 33, 255},
+    {"256x1000", 1000, 256},
+};
+
+static void conf_vec_mat_mult(void)
+{
+    int32_t i, pass;
+
+    for (i = 0; i < (int32_t)(sizeof(vec_mat_shapes) / sizeof(vec_mat_shapes[0])); i++)
+    {
+        const vec_mat_shape *s = &vec_mat_shapes[i];
+        vec_mat_args a;
+        double ref_ns;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.lhs = nn_bench_alloc(s->cols);
+        a.rhs = nn_bench_alloc((size_t)s->rows * s->cols);
+        a.ref = nn_bench_alloc(s->rows);
+        a.out = nn_bench_alloc(s->rows);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->rows);
+        a.kernel_sum = nn_bench_alloc(sizeof(int32_t) * s->rows);
+        nn_bench_fill_s8(a.lhs, s->cols, -128, 127);
+        nn_bench_fill_s8(a.rhs, (size_t)s->rows * s->cols, -127, 127);
+        nn_bench_fill_s32(a.bias, s->rows, -5000, 5000);
+        fill_quant_params(&a.mult, &a.shift, 1);
+
+        // pass 0: bias, no rhs offset; pass 1: no bias (the _v3 contract);
+        // pass 2: non-zero rhs offset, which only the base kernel honors
+        for (pass = 0; pass < 3; pass++)
+        {
+            int32_t *bias = a.bias;
+            a.bias = (pass == 1) ? NULL : bias;
+            a.rhs_offset = (pass == 2) ? 3 : 0;
+
+            run_ref_vec_mat(&a);
+            ref_ns = conf_time(run_ref_vec_mat, &a);
+            conf_check("vec_mat_mult", pass == 2 ? "riscv_nn_vec_mat_mult_t_s8 (rhs_offset)" :
+                       pass == 1 ? "riscv_nn_vec_mat_mult_t_s8 (no bias)" : "riscv_nn_vec_mat_mult_t_s8",
+                       s->shape, run_vec_mat_mult_t_s8, &a, CONF_S8, a.ref, a.out, s->rows, 0, ref_ns);
+            if (pass == 0)
+            {
+                conf_check("vec_mat_mult", "riscv_nn_vec_mat_mult_t_s8_v2", s->shape,
+                           run_vec_mat_mult_t_s8_v2, &a, CONF_S8, a.ref, a.out, s->rows, 0, ref_ns);
+                riscv_nn_kernel_sum_s8(a.rhs, a.bias, s->rows, s->cols, 5, a.kernel_sum);
+                conf_check("vec_mat_mult", "riscv_nn_vec_mat_mult_t_s8 (kernel_sum)", s->shape,
+                           run_vec_mat_mult_t_s8_kernel_sum, &a, CONF_S8, a.ref, a.out, s->rows, 0, ref_ns);
+            }
+            if (pass == 1)
+            {
+                conf_check("vec_mat_mult", "riscv_nn_vec_mat_mult_t_s8_v3 (no bias)", s->shape,
+                           run_vec_mat_mult_t_s8_v3, &a, CONF_S8, a.ref, a.out, s->rows, 0, ref_ns);
+            }
+            a.bias = bias;
+        }
+
+        free(a.lhs);
+        free(a.rhs);
+        free(a.ref);
+        free(a.out);
+        free(a.bias);
+        free(a.kernel_sum);
+    }
+}
+
+typedef struct
+{
+    const char *shape;
+    int32_t m, n, k;
+} gemm_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    gemm_shape s;
+    int8_t *lhs, *rhs, *ref, *out;
+    int32_t *bias, *mult, *shift, *contri_buf;
+    int32_t tile_rows;
+} gemm_args;
+
+static void run_ref_gemm(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    ref_gemm_s8(a->lhs, a->rhs, a->bias, a->ref, a->mult, a->shift, 1, a->s.m, a->s.n, a->s.k,
+                7, 0, -3, -128, 127, a->s.n);
+}
+
+static void run_mat_mult_nt_t_s8(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    // the last three arguments are activation_min, activation_max and the lhs row stride
+    a->hdr.status = riscv_nn_mat_mult_nt_t_s8(a->lhs, a->rhs, a->bias, a->out, a->mult, a->shift,
+                                              a->s.m, a->s.n, a->s.k, 7, -3, -128, 127, a->s.k);
+}
+
+static void run_mat_mult_nt_t_s8_v2(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    a->hdr.status = riscv_nn_mat_mult_nt_t_s8_v2(a->lhs, a->rhs, a->bias, a->out, a->mult, a->shift,
+                                                 a->s.m, a->s.n, a->s.k, 7, -3, -128, 127, a->s.k,
+                                                 a->contri_buf);
+}
+
+static void run_mat_mult_nt_t_s8_core(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    a->hdr.status = riscv_nn_mat_mult_nt_t_s8_core(a->lhs, a->rhs, a->bias, a->out, a->mult, a->shift,
+                                                   a->s.m, a->s.n, a->s.k, 7, -3, -128, 127, a->s.k,
+                                                   a->s.n, a->contri_buf, a->tile_rows);
+}
+
+static void run_ref_fc_gemm(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    ref_gemm_s8(a->lhs, a->rhs, a->bias, a->ref, a->mult, a->shift, 0, a->s.m, a->s.n, a->s.k,
+                5, a->tile_rows, -3, -128, 127, a->s.n);
+}
+
+// the weight offset of the FC layer rides in tile_rows
+static void run_fc_s8(void *args)
+{
+    gemm_args *a = (gemm_args *)args;
+    a->hdr.status = riscv_nn_fc_s8_s8_s8_asym_bias(a->lhs, a->rhs, a->s.k, a->s.n, a->s.m, 5,
+                                                   a->tile_rows, a->mult[0], a->shift[0], -3, a->bias,
+                                                   a->out, -128, 127, NULL);
+}
+
+static const gemm_shape gemm_shapes[] =
+{
+    {"pw_64x32x16", 64, 32, 16},
+    {"odd_37x13x21", 37, 13, 21},
+    {"odd_11x7x300", 11, 7, 300},
+    {"pw_576x64x32", 576, 64, 32},
+    {"pw_196x512x256", 196, 512, 256},
+    {"deep_77x20x600", 77, 20, 600},
+    {"edge_4x4x50", 4, 4, 50},
+    {"edge_3x9x50", 3, 9, 50},
+    {"edge_9x3x50", 9, 3, 50},
+};
+
+// register tiles of riscv_nn_mat_mult_nt_t_s8_core
+static const struct
+{
+    const char *name;
+    int32_t tile_rows;
+} gemm_tiles[] =
+{
+    {"riscv_nn_mat_mult_nt_t_s8_core (2x2)", 2},
+    {"riscv_nn_mat_mult_nt_t_s8_core (4x4)", 4},
+    {"riscv_nn_mat_mult_nt_t_s8_core (8x4)", 8},
+};
+
+// fully-connected layers as batch x row x col; batches of one take the
+// vector-matrix path
+static const gemm_shape fc_gemm_shapes[] =
+{
+    {"fc_1x100x64", 1, 100, 64},
+    {"fc_2x70x33", 2, 70, 33},
+    {"fc_8x150x96", 8, 150, 96},
+    {"fc_64x48x64", 64, 48, 64},
+    {"fc_13x130x256", 13, 130, 256},
+};
+
+static void conf_gemm(void)
+{
+    int32_t i, j;
+
+    for (i = 0; i < (int32_t)(sizeof(gemm_shapes) / sizeof(gemm_shapes[0])); i++)
+    {
+        const gemm_shape *s = &gemm_shapes[i];
+        gemm_args a;
+        double ref_ns;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.lhs = nn_bench_alloc((size_t)s->m * s->k);
+        a.rhs = nn_bench_alloc((size_t)s->n * s->k);
+        a.ref = nn_bench_alloc((size_t)s->m * s->n);
+        a.out = nn_bench_alloc((size_t)s->m * s->n);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->n);
+        a.mult = nn_bench_alloc(sizeof(int32_t) * s->n);
+        a.shift = nn_bench_alloc(sizeof(int32_t) * s->n);
+        nn_bench_fill_s8(a.lhs, (size_t)s->m * s->k, -128, 127);
+        nn_bench_fill_s8(a.rhs, (size_t)s->n * s->k, -127, 127);
+        nn_bench_fill_s32(a.bias, s->n, -5000, 5000);
+        fill_quant_params(a.mult, a.shift, s->n);
+
+        run_ref_gemm(&a);
+        ref_ns = conf_time(run_ref_gemm, &a);
+        conf_check("gemm", "riscv_nn_mat_mult_nt_t_s8", s->shape, run_mat_mult_nt_t_s8, &a, CONF_S8,
+                   a.ref, a.out, (size_t)s->m * s->n, 0, ref_ns);
+        conf_check("gemm", "riscv_nn_mat_mult_nt_t_s8_v2", s->shape, run_mat_mult_nt_t_s8_v2, &a,
+                   CONF_S8, a.ref, a.out, (size_t)s->m * s->n, 0, ref_ns);
+        for (j = 0; j < (int32_t)(sizeof(gemm_tiles) / sizeof(gemm_tiles[0])); j++)
+        {
+            a.tile_rows = gemm_tiles[j].tile_rows;
+            conf_check("gemm", gemm_tiles[j].name, s->shape, run_mat_mult_nt_t_s8_core, &a, CONF_S8,
+                       a.ref, a.out, (size_t)s->m * s->n, 0, ref_ns);
+        }
+        a.contri_buf = nn_bench_alloc(sizeof(int32_t) * s->n);
+        riscv_nn_kernel_sum_s8(a.rhs, a.bias, s->n, s->k, 7, a.contri_buf);
+        conf_check("gemm", "riscv_nn_mat_mult_nt_t_s8_v2 (contri_buf)", s->shape,
+                   run_mat_mult_nt_t_s8_v2, &a, CONF_S8, a.ref, a.out, (size_t)s->m * s->n, 0, ref_ns);
+
+        free(a.lhs);
+        free(a.rhs);
+        free(a.ref);
+        free(a.out);
+        free(a.bias);
+        free(a.mult);
+        free(a.shift);
+        free(a.contri_buf);
+    }
+
+    for (i = 0; i < (int32_t)(sizeof(fc_gemm_shapes) / sizeof(fc_gemm_shapes[0])); i++)
+    {
+        const gemm_shape *s = &fc_gemm_shapes[i];
+        gemm_args a;
+        double ref_ns;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.lhs = nn_bench_alloc((size_t)s->m * s->k);
+        a.rhs = nn_bench_alloc((size_t)s->n * s->k);
+        a.ref = nn_bench_alloc((size_t)s->m * s->n);
+        a.out = nn_bench_alloc((size_t)s->m * s->n);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->n);
+        a.mult = nn_bench_alloc(sizeof(int32_t));
+        a.shift = nn_bench_alloc(sizeof(int32_t));
+        nn_bench_fill_s8(a.lhs, (size_t)s->m * s->k, -128, 127);
+        nn_bench_fill_s8(a.rhs, (size_t)s->n * s->k, -127, 127);
+        nn_bench_fill_s32(a.bias, s->n, -5000, 5000);
+        fill_quant_params(a.mult, a.shift, 1);
+
+        for (j = 0; j < 2; j++)
+        {
+            a.tile_rows = j ? 3 : 0;
+            run_ref_fc_gemm(&a);
+            ref_ns = conf_time(run_ref_fc_gemm, &a);
+            conf_check("fc_s8_asym", j ? "riscv_nn_fc_s8_s8_s8_asym_bias (wt_offset)" :
+                       "riscv_nn_fc_s8_s8_s8_asym_bias", s->shape, run_fc_s8, &a, CONF_S8, a.ref, a.out,
+                       (size_t)s->m * s->n, 0, ref_ns);
+        }
+
+        free(a.lhs);
+        free(a.rhs);
+        free(a.ref);
+        free(a.out);
+        free(a.bias);
+        free(a.mult);
+        free(a.shift);
+    }
+}
+
+//==============================================================================
+// Convolution
+//==============================================================================
+
+typedef struct
+{
+    conf_hdr hdr;
+    conv_shape s;
+    int32_t out_x, out_y;
+    int8_t *in, *wt, *ref, *out;
+    int32_t *bias, *scale, *shift, *kernel_sum;
+    int16_t *buf, *wino_wt;
+    int8_t *packed_wt, *wt_s4;
+    int8_t *res, *res_ref;
+    riscv_nn_residual_add_params res_params;
+    int8_t *pool_ref, *pool_out;
+    riscv_nn_pool_params pool;
+    int16_t *fused_buf;     // sized by the fused wrapper's own get_buffer_size
+} conv_args;
+
+static void conv_args_init(conv_args *a, const conv_shape *s, int32_t depthwise)
+{
+    const int32_t ker_ch = depthwise ? 1 : s->ker_ch;
+    const int32_t eff_kx = s->dilation_x * (s->ker_x - 1) + 1;
+    const int32_t eff_ky = s->dilation_y * (s->ker_y - 1) + 1;
+    const size_t in_size = (size_t)s->in_x * s->in_y * s->in_ch * s->batch;
+    const size_t wt_size = (size_t)s->out_ch * s->ker_x * s->ker_y * ker_ch;
+
+    memset(a, 0, sizeof(*a));
+    a->s = *s;
+    a->out_x = (s->in_x + 2 * s->pad_x - eff_kx) / s->stride_x + 1;
+    a->out_y = (s->in_y + 2 * s->pad_y - eff_ky) / s->stride_y + 1;
+    a->in = nn_bench_alloc(in_size);
+    a->wt = nn_bench_alloc(wt_size);
+    a->ref = nn_bench_alloc((size_t)a->out_x * a->out_y * s->out_ch * s->batch);
+    a->out = nn_bench_alloc((size_t)a->out_x * a->out_y * s->out_ch * s->batch);
+    a->bias = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    a->scale = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    a->shift = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+    nn_bench_fill_s8(a->in, in_size, -128, 127);
+    nn_bench_fill_s8(a->wt, wt_size, -127, 127);
+    nn_bench_fill_s32(a->bias, s->out_ch, -5000, 5000);
+    fill_quant_params(a->scale, a->shift, s->out_ch);
+}
+
+static size_t conv_out_size(const conv_args *a)
+{
+    return (size_t)a->out_x * a->out_y * a->s.out_ch * a->s.batch;
+}
+
+static void conv_args_free(conv_args *a)
+{
+    free(a->in);
+    free(a->wt);
+    free(a->ref);
+    free(a->out);
+    free(a->bias);
+    free(a->scale);
+    free(a->shift);
+    free(a->kernel_sum);
+    free(a->buf);
+    free(a->wino_wt);
+    free(a->packed_wt);
+    free(a->wt_s4);
+    free(a->res);
+    free(a->res_ref);
+    free(a->pool_ref);
+    free(a->pool_out);
+    free(a->fused_buf);
+}
+
+static void run_ref_conv_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    ref_conv_s8_asym(&a->s, 0, a->in, a->wt, a->bias, a->shift, a->scale, -3, 7, -128, 127,
+                     a->out_x, a->out_y, a->ref);
+}
+
+static void run_conv_wrapper_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_wrapper_add_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, &a->res_params, a->fused_buf);
+}
+
+// The residual is first copied to the output, which is then updated in place.
+static void run_conv_wrapper_add_in_place_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    riscv_nn_residual_add_params params = a->res_params;
+
+    memcpy(a->out, a->res, conv_out_size(a));
+    params.in_tensor = a->out;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, &params, a->fused_buf);
+}
+
+static void run_conv_wrapper_pool_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->pool_out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, &a->pool, a->fused_buf);
+}
+
+// Push the rows of every batch through a stream, which is set up again for
+// each batch, and collect the returned output rows.
+static void run_conv_stream(conv_args *a, int32_t depthwise)
+{
+    const int32_t in_row = a->s.in_x * a->s.in_ch;
+    const int32_t out_row = a->out_x * a->s.out_ch;
+    riscv_nn_conv_stream stream;
+    int32_t b, y, num;
+
+    for (b = 0; b < a->s.batch; b++)
+    {
+        int8_t *out = a->out + (size_t)b * a->out_y * out_row;
+
+        if (depthwise)
+        {
+            a->hdr.status = riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_init(&stream, a->s.in_x, a->s.in_y,
+                a->s.in_ch, a->wt, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y,
+                a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->shift, a->scale,
+                a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+        }
+        else
+        {
+            a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_asym_stream_init(&stream, a->s.in_x, a->s.in_y,
+                a->s.in_ch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x,
+                a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->shift, a->scale, -3, 7, -128, 127,
+                a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+        }
+        if (a->hdr.status != 0)
+        {
+            return;
+        }
+        for (y = 0; y < a->s.in_y; y++)
+        {
+            num = riscv_nn_conv_stream_push_row_s8(&stream, a->in + ((size_t)b * a->s.in_y + y) * in_row, out);
+            if (num < 0 || num > stream.max_out_rows)
+            {
+                a->hdr.status = -1;
+                return;
+            }
+            out += num * out_row;
+        }
+    }
+}
+
+static void run_conv_stream_s8(void *args)
+{
+    run_conv_stream((conv_args *)args, 0);
+}
+
+static void run_conv_dw_stream_s8(void *args)
+{
+    run_conv_stream((conv_args *)args, 1);
+}
+
+static void run_conv_wrapper_packed_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->packed_wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch,
+        a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7,
+        -128, 127, a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_wrapper_s4(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt_s4, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+}
+
+static void run_conv_wrapper_packed_s4(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->packed_wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x,
+        a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+}
+
+// bias and input offset folded offline by riscv_nn_kernel_sum_s8
+static void run_conv_wrapper_kernel_sum_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->kernel_sum, a->out, a->shift, a->scale, -3, 0, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->buf);
+}
+
+static void run_conv_any_dilated_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x,
+        a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128,
+        127, a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_winograd_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->wino_wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->bias, a->out,
+        a->shift, a->scale, -3, 7, -128, 127, a->out_x, a->out_y, a->buf);
+}
+
+static void run_conv_any_dilated_no_buf_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x,
+        a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128,
+        127, a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, NULL);
+}
+
+static void run_conv_1x1_fast_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x,
+        a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127, a->out_x, a->out_y,
+        a->buf);
+}
+
+static void run_conv_1x1_fast_any_no_buf_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->s.batch, a->wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x,
+        a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127, a->out_x, a->out_y,
+        NULL);
+}
+
+static void run_conv_1xn_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_1xn_HWC_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.pad_x, a->s.stride_x, a->bias, a->out,
+        a->shift, a->scale, -3, 7, -128, 127, a->out_x, a->buf);
+}
+
+static void run_ref_conv_dw_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    ref_conv_s8_asym(&a->s, 1, a->in, a->wt, a->bias, a->shift, a->scale, -3, 7, -128, 127,
+                     a->out_x, a->out_y, a->ref);
+}
+
+static void run_conv_dw_wrapper_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y,
+        a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale,
+        a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y,
+        a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale,
+        a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_fast_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, a->out_x, a->out_y, -3,
+        7, -128, 127, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_3x3_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y,
+        a->bias, a->out, a->shift, a->scale, a->out_x, a->out_y, -3, 7, -128, 127,
+        a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_any_s4(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any(a->in, a->s.batch, a->s.in_x,
+        a->s.in_y, a->s.in_ch, a->wt_s4, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y,
+        a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale,
+        a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+}
+
+static void run_conv_dw_3x3_s4(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any(a->in, a->s.batch, a->s.in_x,
+        a->s.in_y, a->s.in_ch, a->wt_s4, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x,
+        a->s.stride_y, a->bias, a->out, a->shift, a->scale, a->out_x, a->out_y, -3, 7, -128, 127,
+        a->s.dilation_x, a->s.dilation_y, (int8_t *)a->buf);
+}
+
+static void run_conv_dw_5x5_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y,
+        a->bias, a->out, a->shift, a->scale, a->out_x, a->out_y, -3, 7, -128, 127,
+        a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_7x7_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y,
+        a->bias, a->out, a->shift, a->scale, a->out_x, a->out_y, -3, 7, -128, 127,
+        a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+#define SYM_PRE_RSHIFT  4
+#define SYM_OUT_SCALE   3
+#define SYM_POST_RSHIFT 7
+
+static void run_ref_conv_sym_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    ref_conv_s8_sym(&a->s, a->in, a->wt, a->bias, SYM_PRE_RSHIFT, SYM_OUT_SCALE, SYM_POST_RSHIFT,
+                    a->out_x, a->out_y, a->ref);
+}
+
+static void run_conv_sym_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    riscv_nn_conv_HWC_s8_s8_s8_sym_bias_any(a->in, a->s.in_x, a->s.in_y, a->s.in_ch, a->wt,
+        a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y,
+        a->bias, SYM_PRE_RSHIFT, SYM_OUT_SCALE, SYM_POST_RSHIFT, a->out, a->out_x, a->out_y,
+        a->buf, NULL);
+}
+
+// square tensors and kernels only
+static void run_conv_sym_fast_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    if (a->s.in_x != a->s.in_y || a->s.ker_x != a->s.ker_y || a->s.pad_x != a->s.pad_y ||
+        a->s.stride_x != a->s.stride_y)
+    {
+        a->hdr.status = -1;
+        return;
+    }
+    a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_sym_bias_fast(a->in, a->s.in_x, a->s.in_ch, a->wt,
+        a->s.out_ch, a->s.ker_x, a->s.pad_x, a->s.stride_x, a->bias, SYM_PRE_RSHIFT, SYM_OUT_SCALE,
+        SYM_POST_RSHIFT, a->out, a->out_x, a->buf);
+}
+
+static void run_conv_sym_fast_any_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_s8_s8_s8_sym_bias_fast_any(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, SYM_PRE_RSHIFT, SYM_OUT_SCALE, SYM_POST_RSHIFT,
+        a->out, a->out_x, a->out_y, a->buf);
+}
+
+//  shape                   in_x in_y in_ch batch out_ch ker_x ker_y ker_ch pad_x pad_y s_x s_y d_x d_y
+static const conv_shape conv_shapes[] =
+{
+    {"pw_8x8x16_24",         8,   8,  16,   1,   24,    1,    1,   16,    0,    0,   1,  1,  1,  1},
+    {"pw_s2_9x9x16_8",       9,   9,  16,   1,    8,    1,    1,   16,    0,    0,   2,  2,  1,  1},
+    {"pw_s2_b3_15x11x24_16",15,  11,  24,   3,   16,    1,    1,   24,    0,    0,   2,  2,  1,  1},
+    {"pw_b2_6x6x8_8",        6,   6,   8,   2,    8,    1,    1,    8,    0,    0,   1,  1,  1,  1},
+    {"pw_64x16x8_64",       64,  16,   8,   1,   64,    1,    1,    8,    0,    0,   1,  1,  1,  1},
+    {"pw_s2_b2_17x13x160_8",17,  13, 160,   2,    8,    1,    1,  160,    0,    0,   2,  2,  1,  1},
+    {"pw_g4_10x6x16_24",    10,   6,  16,   1,   24,    1,    1,    4,    0,    0,   1,  1,  1,  1},
+    {"pw_g2_s2_b2_9x7x8_12", 9,   7,   8,   2,   12,    1,    1,    4,    0,    0,   2,  2,  1,  1},
+    {"3x3_12x10x8_12",      12,  10,   8,   1,   12,    3,    3,    8,    1,    1,   1,  1,  1,  1},
+    {"3x3_s2_11x11x3_16",   11,  11,   3,   1,   16,    3,    3,    3,    1,    1,   2,  2,  1,  1},
+    {"3x3_dil2_10x10x8_8",  10,  10,   8,   1,    8,    3,    3,    8,    2,    2,   1,  1,  2,  2},
+    {"3x3_g4_8x8x16_16",     8,   8,  16,   1,   16,    3,    3,    4,    1,    1,   1,  1,  1,  1},
+    {"3x3_g2_s2_9x7x6_10",   9,   7,   6,   1,   10,    3,    3,    3,    1,    1,   2,  2,  1,  1},
+    {"3x3_28x28x32_32",     28,  28,  32,   1,   32,    3,    3,   32,    1,    1,   1,  1,  1,  1},
+    {"3x3_p0_b2_9x8x5_7",    9,   8,   5,   2,    7,    3,    3,    5,    0,    0,   1,  1,  1,  1},
+    {"1x5_32x1x12_16",      32,   1,  12,   1,   16,    5,    1,   12,    2,    0,   1,  1,  1,  1},
+};
+
+static const conv_shape conv_dw_shapes[] =
+{
+    {"3x3_12x12x16",        12,  12,  16,   1,   16,    3,    3,    1,    1,    1,   1,  1,  1,  1},
+    {"3x3_s2_13x13x8",      13,  13,   8,   1,    8,    3,    3,    1,    1,    1,   2,  2,  1,  1},
+    {"5x5_9x9x12",           9,   9,  12,   1,   12,    5,    5,    1,    2,    2,   1,  1,  1,  1},
+    {"3x3_dil2_10x10x8",    10,  10,   8,   1,    8,    3,    3,    1,    2,    2,   1,  1,  2,  2},
+    {"3x3_mult2_8x8x4",      8,   8,   4,   1,    8,    3,    3,    1,    1,    1,   1,  1,  1,  1},
+    {"3x3_p2_s2_11x9x12",   11,   9,  12,   1,   12,    3,    3,    1,    2,    2,   2,  2,  1,  1},
+    {"3x3_dil3x2_12x10x18", 12,  10,  18,   1,   18,    3,    3,    1,    3,    2,   1,  1,  3,  2},
+    {"3x3_9x7x7",            9,   7,   7,   1,    7,    3,    3,    1,    1,    1,   1,  1,  1,  1},
+    {"5x5_s2_15x13x24",     15,  13,  24,   1,   24,    5,    5,    1,    2,    2,   2,  2,  1,  1},
+    {"7x7_14x14x16",        14,  14,  16,   1,   16,    7,    7,    1,    3,    3,   1,  1,  1,  1},
+    {"7x7_p1_5x9x8",         5,   9,   8,   1,    8,    7,    7,    1,    1,    3,   1,  1,  1,  1},
+};
+
+static const conv_shape conv_sym_shapes[] =
+{
+    {"3x3_10x10x8_16",      10,  10,   8,   1,   16,    3,    3,    8,    1,    1,   1,  1,  1,  1},
+    {"3x3_s2_9x9x4_6",       9,   9,   4,   1,    6,    3,    3,    4,    1,    1,   2,  2,  1,  1},
+    {"3x1_12x8x8_10",       12,   8,   8,   1,   10,    3,    1,    8,    1,    0,   1,  1,  1,  1},
+    {"3x3_7x7x3_5",          7,   7,   3,   1,    5,    3,    3,    3,    1,    1,   1,  1,  1,  1},
+};
+
+// large enough for every s8/s4 asym variant run on the shape
+// Pooling layers fused after the convolution; the largest window comes first
+// for conv_buf_size. Only the window, stride and padding are used from here.
+static const struct
+{
+    const char *variant;
+    riscv_nn_pool_params pool;
+} conv_pools[] =
+{
+    {"riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool (max 3x3 s2 p1)", {NN_POOL_MAX, 3, 3, 2, 2, 1, 1}},
+    {"riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool (max 2x2 s2)",    {NN_POOL_MAX, 2, 2, 2, 2, 0, 0}},
+    {"riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool (ave 2x2 s2)",    {NN_POOL_AVE, 2, 2, 2, 2, 0, 0}},
+};
+
+static size_t conv_buf_size(const conv_shape *s, const conv_args *a)
+{
+    int32_t size = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(s->in_x, s->in_y, s->in_ch,
+        s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x, s->stride_y, a->out_x,
+        a->out_y, s->out_ch, s->dilation_x, s->dilation_y);
+
+    size = MAX(size, riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(s->in_x, s->in_y, s->in_ch,
+        s->out_ch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, s->stride_x, s->stride_y, a->out_x, a->out_y));
+    size = MAX(size, riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated_get_buffer_size(s->ker_ch, s->ker_x,
+        s->ker_y, s->out_ch));
+    size = MAX(size, riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any_get_buffer_size(s->in_ch));
+    size = MAX(size, riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed_get_buffer_size(s->out_ch, s->ker_x,
+        s->ker_y, s->ker_ch));
+    size = MAX(size, riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add_get_buffer_size(s->in_x, s->in_y,
+        s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x, s->stride_y,
+        a->out_x, a->out_y, s->out_ch, s->dilation_x, s->dilation_y));
+    size = MAX(size, riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool_get_buffer_size(s->in_x, s->in_y,
+        s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x, s->stride_y,
+        a->out_x, a->out_y, s->out_ch, s->dilation_x, s->dilation_y, &conv_pools[0].pool));
+    size = MAX(size, riscv_nn_conv_HWC_s8_s8_s8_asym_stream_get_buffer_size(s->in_x, s->in_y, s->in_ch,
+        s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x, s->stride_y, a->out_x, s->out_ch,
+        s->dilation_x, s->dilation_y));
+    size = MAX(size, riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_get_buffer_size(s->in_x, s->in_y, s->in_ch,
+        s->batch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, s->stride_x, s->stride_y, a->out_x, a->out_y,
+        s->out_ch, s->dilation_x, s->dilation_y));
+    return (size_t)size;
+}
+
+// Nibble-pack s8 weights in [-8, 7] the way the s4 kernels read them: the
+// weights are one stream in which even elements go to the low nibbles.
+static int8_t *conv_pack_s4(const int8_t *wt, size_t size)
+{
+    int8_t *wt_s4 = nn_bench_alloc((size + 1) / 2);
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        const uint8_t nibble = (uint8_t)wt[i] & 0xf;
+
+        wt_s4[i >> 1] |= (int8_t)((i & 1) ? (nibble << 4) : nibble);
+    }
+    return wt_s4;
+}
+
+static void conf_convolution(void)
+{
+    int32_t i, j;
+
+    for (i = 0; i < (int32_t)(sizeof(conv_shapes) / sizeof(conv_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_shapes[i];
+        const int32_t plain = (s->dilation_x == 1) && (s->dilation_y == 1) && (s->ker_ch == s->in_ch);
+        conv_args a;
+        double ref_ns;
+
+        conv_args_init(&a, s, 0);
+        a.buf = nn_bench_alloc(conv_buf_size(s, &a));
+        run_ref_conv_s8(&a);
+        ref_ns = conf_time(run_ref_conv_s8, &a);
+
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym", s->shape,
+                   run_conv_wrapper_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated", s->shape,
+                   run_conv_any_dilated_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+
+        // the fused residual addition must match the reference convolution
+        // followed by riscv_nn_ew_add_s8_asym
+        a.res = nn_bench_alloc(conv_out_size(&a));
+        a.res_ref = nn_bench_alloc(conv_out_size(&a));
+        nn_bench_fill_s8(a.res, conv_out_size(&a), -128, 127);
+        a.res_params = (riscv_nn_residual_add_params){a.res, 3, 1 << 30, 2, -5, 1 << 29, 1, 10, -2,
+                                                      1 << 30, 6, -128, 127};
+        riscv_nn_ew_add_s8_asym(a.ref, a.res, 3, 1 << 30, 2, -5, 1 << 29, 1, 10, a.res_ref, -2, 1 << 30, 6,
+                                -128, 127, conv_out_size(&a));
+        a.fused_buf = nn_bench_alloc(riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add_get_buffer_size(s->in_x,
+            s->in_y, s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x,
+            s->stride_y, a.out_x, a.out_y, s->out_ch, s->dilation_x, s->dilation_y));
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add", s->shape,
+                   run_conv_wrapper_add_s8, &a, CONF_S8, a.res_ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_add (in place)", s->shape,
+                   run_conv_wrapper_add_in_place_s8, &a, CONF_S8, a.res_ref, a.out, conv_out_size(&a), 0,
+                   ref_ns);
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_s8_s8_s8_asym_stream", s->shape,
+                   run_conv_stream_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+
+        // the fused pooling must match the reference convolution followed by
+        // the pooling function
+        for (j = 0; j < (int32_t)(sizeof(conv_pools) / sizeof(conv_pools[0])); j++)
+        {
+            const riscv_nn_pool_params *p = &conv_pools[j].pool;
+            size_t pool_size;
+
+            a.pool = *p;
+            a.pool.act_min = -100;
+            a.pool.act_max = 120;
+            a.pool.out_tensor_dim_x = (a.out_x + 2 * p->pad_x - p->ker_dim_x) / p->stride_x + 1;
+            a.pool.out_tensor_dim_y = (a.out_y + 2 * p->pad_y - p->ker_dim_y) / p->stride_y + 1;
+            if (a.pool.out_tensor_dim_x <= 0 || a.pool.out_tensor_dim_y <= 0)
+            {
+                continue;
+            }
+            pool_size = (size_t)a.pool.out_tensor_dim_x * a.pool.out_tensor_dim_y * s->out_ch * s->batch;
+            free(a.pool_ref);
+            free(a.pool_out);
+            free(a.fused_buf);
+            a.pool_ref = nn_bench_alloc(pool_size);
+            a.pool_out = nn_bench_alloc(pool_size);
+            a.fused_buf = nn_bench_alloc(riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_pool_get_buffer_size(s->in_x,
+                s->in_y, s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x,
+                s->stride_y, a.out_x, a.out_y, s->out_ch, s->dilation_x, s->dilation_y, &a.pool));
+            if (p->type == NN_POOL_MAX)
+            {
+                riscv_nn_maxpool_HWC_s8_any_act(s->batch, a.out_y, a.out_x, a.pool.out_tensor_dim_y,
+                    a.pool.out_tensor_dim_x, p->stride_y, p->stride_x, p->ker_dim_y, p->ker_dim_x,
+                    p->pad_y, p->pad_x, a.pool.act_min, a.pool.act_max, s->out_ch, a.ref, NULL, a.pool_ref);
+            }
+            else
+            {
+                riscv_nn_avepool_HWC_s8_any_act(s->batch, a.out_y, a.out_x, a.pool.out_tensor_dim_y,
+                    a.pool.out_tensor_dim_x, p->stride_y, p->stride_x, p->ker_dim_y, p->ker_dim_x,
+                    p->pad_y, p->pad_x, a.pool.act_min, a.pool.act_max, s->out_ch, a.ref, NULL, a.pool_ref);
+            }
+            conf_check("conv_s8_asym", conv_pools[j].variant, s->shape, run_conv_wrapper_pool_s8, &a,
+                       CONF_S8, a.pool_ref, a.pool_out, pool_size, 0, ref_ns);
+        }
+        a.packed_wt = nn_bench_alloc(riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack_get_size(s->out_ch, s->ker_x,
+            s->ker_y, s->ker_ch));
+        riscv_nn_conv_HWC_s8_s8_s8_asym_weight_pack(a.wt, s->in_ch, s->out_ch, s->ker_x, s->ker_y, s->ker_ch,
+                                                    a.packed_wt);
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_packed", s->shape,
+                   run_conv_wrapper_packed_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_s8_asym", "riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated (no tmp_buf)",
+                   s->shape, run_conv_any_dilated_no_buf_s8, &a, CONF_S8, a.ref, a.out,
+                   conv_out_size(&a), 0, ref_ns);
+        if (plain)
+        {
+            conf_check("conv_s8_asym", "riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any", s->shape,
+                       run_conv_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        if (plain && s->ker_x == 1 && s->ker_y == 1 && s->pad_x == 0 && s->pad_y == 0)
+        {
+            conf_check("conv_s8_asym", "riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any", s->shape,
+                       run_conv_1x1_fast_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+            conf_check("conv_s8_asym", "riscv_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any (no tmp_buf)",
+                       s->shape, run_conv_1x1_fast_any_no_buf_s8, &a, CONF_S8, a.ref, a.out,
+                       conv_out_size(&a), 0, ref_ns);
+
+            a.kernel_sum = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+            riscv_nn_kernel_sum_s8(a.wt, a.bias, s->out_ch, s->in_ch, 7, a.kernel_sum);
+            conf_check("conv_s8_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym (kernel_sum)", s->shape,
+                       run_conv_wrapper_kernel_sum_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0,
+                       ref_ns);
+        }
+        if (plain && s->ker_x == 3 && s->ker_y == 3 && s->stride_x == 1 && s->stride_y == 1)
+        {
+            // the transformed weights are prepared once, outside the timed call
+            a.wino_wt = nn_bench_alloc(sizeof(int16_t) * 16 * s->in_ch * s->out_ch);
+            riscv_nn_conv_HWC_3x3_winograd_s8_weight_transform(a.wt, s->in_ch, s->out_ch, a.wino_wt);
+            conf_check("conv_s8_asym", "riscv_nn_conv_HWC_3x3_winograd_s8_s8_s8_asym_bias_any", s->shape,
+                       run_conv_winograd_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        if (plain && s->in_y == 1 && s->ker_y == 1 && s->pad_y == 0)
+        {
+            conf_check("conv_s8_asym", "riscv_nn_conv_1xn_HWC_s8_s8_s8_asym_bias_any", s->shape,
+                       run_conv_1xn_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        conv_args_free(&a);
+    }
+
+    for (i = 0; i < (int32_t)(sizeof(conv_shapes) / sizeof(conv_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_shapes[i];
+        const size_t wt_size = (size_t)s->out_ch * s->ker_x * s->ker_y * s->in_ch;
+        conv_args a;
+        double ref_ns;
+
+        if (s->ker_ch != s->in_ch)
+        {
+            continue;
+        }
+        conv_args_init(&a, s, 0);
+        nn_bench_fill_s8(a.wt, wt_size, -8, 7);
+        a.wt_s4 = conv_pack_s4(a.wt, wt_size);
+        a.buf = nn_bench_alloc(conv_buf_size(s, &a));
+        run_ref_conv_s8(&a);
+        ref_ns = conf_time(run_ref_conv_s8, &a);
+
+        conf_check("conv_s4_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym", s->shape,
+                   run_conv_wrapper_s4, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        a.packed_wt = nn_bench_alloc(riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack_get_size(s->in_ch, s->out_ch,
+            s->ker_x, s->ker_y));
+        riscv_nn_conv_HWC_s8_s8_s4_asym_weight_pack(a.wt_s4, s->in_ch, s->out_ch, s->ker_x, s->ker_y,
+                                                    a.packed_wt);
+        conf_check("conv_s4_asym", "riscv_nn_conv_HWC_wrapper_s8_s8_s4_asym_packed", s->shape,
+                   run_conv_wrapper_packed_s4, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conv_args_free(&a);
+    }
+
+    for (i = 0; i < (int32_t)(sizeof(conv_dw_shapes) / sizeof(conv_dw_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_dw_shapes[i];
+        conv_args a;
+        double ref_ns;
+
+        conv_args_init(&a, s, 1);
+        a.buf = nn_bench_alloc(MAX(MAX(MAX(riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(
+            s->in_ch, s->out_ch / s->in_ch, s->ker_x, s->ker_y, s->pad_x),
+            riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size(s->in_ch, s->ker_x,
+            s->ker_y)), riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream_get_buffer_size(s->in_x, s->in_y,
+            s->in_ch, s->out_ch / s->in_ch, s->ker_x, s->ker_y, s->pad_x, s->dilation_y)),
+            riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any_get_buffer_size(s->in_ch, s->ker_x, s->ker_y,
+            s->out_ch / s->in_ch)));
+        run_ref_conv_dw_s8(&a);
+        ref_ns = conf_time(run_ref_conv_dw_s8, &a);
+
+        conf_check("conv_dw_s8_asym", "riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym", s->shape,
+                   run_conv_dw_wrapper_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_dw_s8_asym", "riscv_nn_conv_dw_HWC_s8_s8_s8_asym_stream", s->shape,
+                   run_conv_dw_stream_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_dw_s8_asym", "riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_any", s->shape,
+                   run_conv_dw_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        if (s->in_ch == s->out_ch)
+        {
+            conf_check("conv_dw_s8_asym", "riscv_nn_conv_dw_HWC_s8_s8_s8_asym_bias_fast_any", s->shape,
+                       run_conv_dw_fast_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        if (s->in_ch == s->out_ch && s->ker_x == 3 && s->ker_y == 3)
+        {
+            conf_check("conv_dw_s8_asym", "riscv_nn_conv_dw_HWC_3x3_s8_s8_s8_asym_bias_any", s->shape,
+                       run_conv_dw_3x3_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        if (s->in_ch == s->out_ch && s->dilation_x == 1 && s->dilation_y == 1 &&
+            ((s->ker_x == 5 && s->ker_y == 5) || (s->ker_x == 7 && s->ker_y == 7)))
+        {
+            conf_check("conv_dw_s8_asym", (s->ker_x == 5) ? "riscv_nn_conv_dw_HWC_5x5_s8_s8_s8_asym_bias_any" :
+                       "riscv_nn_conv_dw_HWC_7x7_s8_s8_s8_asym_bias_any", s->shape,
+                       (s->ker_x == 5) ? run_conv_dw_5x5_s8 : run_conv_dw_7x7_s8, &a, CONF_S8, a.ref, a.out,
+                       conv_out_size(&a), 0, ref_ns);
+        }
+
+        // the same layer with the weights in [-8, 7] and nibble-packed
+        nn_bench_fill_s8(a.wt, (size_t)s->out_ch * s->ker_x * s->ker_y, -8, 7);
+        a.wt_s4 = conv_pack_s4(a.wt, (size_t)s->out_ch * s->ker_x * s->ker_y);
+        run_ref_conv_dw_s8(&a);
+        ref_ns = conf_time(run_ref_conv_dw_s8, &a);
+        conf_check("conv_dw_s4_asym", "riscv_nn_conv_dw_HWC_s8_s8_s4_asym_bias_any", s->shape,
+                   run_conv_dw_any_s4, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        if (s->in_ch == s->out_ch && s->ker_x == 3 && s->ker_y == 3)
+        {
+            conf_check("conv_dw_s4_asym", "riscv_nn_conv_dw_HWC_3x3_s8_s8_s4_asym_bias_any", s->shape,
+                       run_conv_dw_3x3_s4, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        }
+        conv_args_free(&a);
+    }
+
+    for (i = 0; i < (int32_t)(sizeof(conv_sym_shapes) / sizeof(conv_sym_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_sym_shapes[i];
+        conv_args a;
+        double ref_ns;
+
+        conv_args_init(&a, s, 0);
+        // keep the accumulators small enough for the 16-bit out_scale stage
+        nn_bench_fill_s32(a.bias, s->out_ch, -500, 500);
+        a.buf = nn_bench_alloc(riscv_nn_conv_sym_get_buffer_size(s->in_x, s->in_y, s->in_ch,
+            s->out_ch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, s->stride_x, s->stride_y, a.out_x,
+            a.out_y));
+        run_ref_conv_sym_s8(&a);
+        ref_ns = conf_time(run_ref_conv_sym_s8, &a);
+
+        conf_check("conv_s8_sym", "riscv_nn_conv_HWC_s8_s8_s8_sym_bias_any", s->shape,
+                   run_conv_sym_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_s8_sym", "riscv_nn_conv_HWC_s8_s8_s8_sym_bias_fast", s->shape,
+                   run_conv_sym_fast_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conf_check("conv_s8_sym", "riscv_nn_conv_HWC_s8_s8_s8_sym_bias_fast_any", s->shape,
+                   run_conv_sym_fast_any_s8, &a, CONF_S8, a.ref, a.out, conv_out_size(&a), 0, ref_ns);
+        conv_args_free(&a);
+    }
+}
+
+//==============================================================================
+// Transposed convolution
+//==============================================================================
+
+// The reference scatters every input pixel into a 64-bit partial-result
+// tensor, which is what the library kernels did before they switched to the
+// gather form. The output size is (in - 1) * stride - 2 * pad + ker.
+
+typedef struct
+{
+    conf_hdr hdr;
+    conv_shape s;
+    int32_t out_x, out_y, in_offset, out_offset;
+    int8_t *in, *wt, *ref, *out, *buf;
+    int16_t *in16, *ref16, *out16;
+    int32_t *bias, *scale, *shift;
+    int64_t *bias64;
+} conv_trans_args;
+
+static void ref_conv_trans(const conv_trans_args *a, int32_t s16)
+{
+    const conv_shape *s = &a->s;
+    const size_t out_len = (size_t)a->out_x * a->out_y * s->out_ch;
+    int64_t *acc = nn_bench_alloc(sizeof(int64_t) * out_len);
+    int32_t b, iy, ix, ic, ky, kx, oc;
+    size_t i;
+
+    for (b = 0; b < s->batch; b++)
+    {
+        const size_t in_base = (size_t)b * s->in_x * s->in_y * s->in_ch;
+
+        memset(acc, 0, sizeof(int64_t) * out_len);
+        for (iy = 0; iy < s->in_y; iy++)
+        {
+            for (ix = 0; ix < s->in_x; ix++)
+            {
+                for (ky = 0; ky < s->ker_y; ky++)
+                {
+                    for (kx = 0; kx < s->ker_x; kx++)
+                    {
+                        const int32_t oy = iy * s->stride_y - s->pad_y + ky;
+                        const int32_t ox = ix * s->stride_x - s->pad_x + kx;
+                        if (oy < 0 || oy >= a->out_y || ox < 0 || ox >= a->out_x)
+                        {
+                            continue;
+                        }
+                        for (oc = 0; oc < s->out_ch; oc++)
+                        {
+                            for (ic = 0; ic < s->in_ch; ic++)
+                            {
+                                const size_t in_idx = in_base + ((size_t)iy * s->in_x + ix) * s->in_ch + ic;
+                                const int32_t in_val = s16 ? a->in16[in_idx] : a->in[in_idx] + a->in_offset;
+                                const int32_t wt_val = a->wt[((oc * s->ker_y + ky) * s->ker_x + kx) * s->in_ch + ic];
+                                acc[((size_t)oy * a->out_x + ox) * s->out_ch + oc] += (int64_t)in_val * wt_val;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        for (i = 0; i < out_len; i++)
+        {
+            oc = (int32_t)(i % s->out_ch);
+            if (s16)
+            {
+                const int32_t mult = (a->scale[oc] < 0x7FFF0000) ? ((a->scale[oc] + (1 << 15)) >> 16) : 0x7FFF;
+                int32_t res = (int32_t)(((acc[i] + a->bias64[oc]) * mult) >> (14 - a->shift[oc]));
+                res = (res + 1) >> 1;
+                res = MAX(res, -32768);
+                a->ref16[b * out_len + i] = (int16_t)MIN(res, 32767);
+            }
+            else
+            {
+                a->ref[b * out_len + i] = ref_output_s8((int32_t)acc[i] + a->bias[oc], a->scale[oc],
+                                                        a->shift[oc], a->out_offset, -128, 127);
+            }
+        }
+    }
+    free(acc);
+}
+
+static void run_ref_conv_trans_s8(void *args)
+{
+    ref_conv_trans((conv_trans_args *)args, 0);
+}
+
+static void run_ref_conv_trans_s16(void *args)
+{
+    ref_conv_trans((conv_trans_args *)args, 1);
+}
+
+static void run_conv_trans_s8(void *args)
+{
+    conv_trans_args *a = (conv_trans_args *)args;
+    const conv_shape *s = &a->s;
+    a->hdr.status = riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any(a->in, s->in_x, s->in_y, s->in_ch,
+        s->batch, a->wt, s->out_ch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, 0, 0, s->stride_x, s->stride_y,
+        a->bias, a->out, a->shift, a->scale, a->out_offset, a->in_offset, -128, 127, a->out_x, a->out_y,
+        a->buf);
+}
+
+static void run_conv_trans_s16(void *args)
+{
+    conv_trans_args *a = (conv_trans_args *)args;
+    const conv_shape *s = &a->s;
+    a->hdr.status = riscv_nn_conv_trans_HWC_s16_s16_s8_asym_bias_any(a->in16, s->in_x, s->in_y, s->in_ch,
+        s->batch, a->wt, s->out_ch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, 0, 0, s->stride_x, s->stride_y,
+        a->bias64, a->out16, a->shift, a->scale, 0, 0, -32768, 32767, a->out_x, a->out_y, NULL);
+}
+
+static void run_conv_trans_1xn_s16(void *args)
+{
+    conv_trans_args *a = (conv_trans_args *)args;
+    const conv_shape *s = &a->s;
+    a->hdr.status = riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any(a->in16, s->in_x, s->in_ch,
+        s->batch, a->wt, s->out_ch, s->ker_x, s->pad_x, s->stride_x, a->bias64, a->out16, a->shift,
+        a->scale, 0, 0, -32768, 32767, a->out_x, NULL);
+}
+
+// ker_ch and the dilation are not used by the transposed convolutions.
+static const conv_shape conv_trans_shapes[] =
+{
+    {"2x2_s2_6x5x8",        6,  5,  8, 1, 12, 2, 2,  8, 0, 0, 2, 2, 1, 1},
+    {"3x3_s2_p1_7x6x16",    7,  6, 16, 2,  8, 3, 3, 16, 1, 1, 2, 2, 1, 1},
+    {"4x4_s2_p1_5x5x12",    5,  5, 12, 1, 20, 4, 4, 12, 1, 1, 2, 2, 1, 1},
+    {"3x2_s2x1_p1_6x7x5",   6,  7,  5, 1,  9, 3, 2,  5, 1, 0, 2, 1, 1, 1},
+    {"1x1_s3_4x4x8",        4,  4,  8, 1,  6, 1, 1,  8, 0, 0, 3, 3, 1, 1},
+    {"5x1_s2_p2_9x1x6",     9,  1,  6, 2, 10, 5, 1,  6, 2, 0, 2, 1, 1, 1},
+};
+
+static void conf_conv_trans(void)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(conv_trans_shapes) / sizeof(conv_trans_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_trans_shapes[i];
+        const size_t in_size = (size_t)s->in_x * s->in_y * s->in_ch * s->batch;
+        const size_t wt_size = (size_t)s->out_ch * s->ker_x * s->ker_y * s->in_ch;
+        conv_trans_args a;
+        size_t out_size;
+        double ref_ns;
+        int32_t c;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.out_x = (s->in_x - 1) * s->stride_x - 2 * s->pad_x + s->ker_x;
+        a.out_y = (s->in_y - 1) * s->stride_y - 2 * s->pad_y + s->ker_y;
+        a.in_offset = 7;
+        a.out_offset = -3;
+        out_size = (size_t)a.out_x * a.out_y * s->out_ch * s->batch;
+        a.in = nn_bench_alloc(in_size);
+        a.in16 = nn_bench_alloc(sizeof(int16_t) * in_size);
+        a.wt = nn_bench_alloc(wt_size);
+        a.ref = nn_bench_alloc(out_size);
+        a.out = nn_bench_alloc(out_size);
+        a.ref16 = nn_bench_alloc(sizeof(int16_t) * out_size);
+        a.out16 = nn_bench_alloc(sizeof(int16_t) * out_size);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+        a.bias64 = nn_bench_alloc(sizeof(int64_t) * s->out_ch);
+        a.scale = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+        a.shift = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+        nn_bench_fill_s8(a.in, in_size, -128, 127);
+        nn_bench_fill_s16(a.in16, in_size, -32768, 32767);
+        nn_bench_fill_s8(a.wt, wt_size, -127, 127);
+        nn_bench_fill_s32(a.bias, s->out_ch, -5000, 5000);
+        for (c = 0; c < s->out_ch; c++)
+        {
+            a.bias64[c] = (int64_t)a.bias[c] * 256;
+        }
+        fill_quant_params(a.scale, a.shift, s->out_ch);
+        a.buf = nn_bench_alloc(riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any_get_buffer_size(s->in_x,
+            s->in_y, s->in_ch, s->batch, s->out_ch, s->ker_x, s->ker_y, s->pad_x, s->pad_y, s->stride_x,
+            s->stride_y, a.out_x, a.out_y));
+
+        run_ref_conv_trans_s8(&a);
+        ref_ns = conf_time(run_ref_conv_trans_s8, &a);
+        conf_check("conv_trans", "riscv_nn_conv_trans_HWC_s8_s8_s8_asym_bias_any", s->shape,
+                   run_conv_trans_s8, &a, CONF_S8, a.ref, a.out, out_size, 0, ref_ns);
+
+        run_ref_conv_trans_s16(&a);
+        ref_ns = conf_time(run_ref_conv_trans_s16, &a);
+        conf_check("conv_trans", "riscv_nn_conv_trans_HWC_s16_s16_s8_asym_bias_any", s->shape,
+                   run_conv_trans_s16, &a, CONF_S16, a.ref16, a.out16, out_size, 0, ref_ns);
+        if (s->in_y == 1 && s->ker_y == 1 && s->pad_y == 0)
+        {
+            conf_check("conv_trans", "riscv_nn_conv_trans_1xn_HWC_s16_s16_s8_asym_bias_any", s->shape,
+                       run_conv_trans_1xn_s16, &a, CONF_S16, a.ref16, a.out16, out_size, 0, ref_ns);
+        }
+
+        free(a.in);
+        free(a.in16);
+        free(a.wt);
+        free(a.ref);
+        free(a.out);
+        free(a.ref16);
+        free(a.out16);
+        free(a.bias);
+        free(a.bias64);
+        free(a.scale);
+        free(a.shift);
+        free(a.buf);
+    }
+}
+
+//==============================================================================
+// Depth-first convolution chains
+//==============================================================================
+
+// Every chain is checked against the reference run layer by layer, at a few
+// tile heights; the row after each check reports the buffer size and the
+// recomputed work of the tile height.
+
+#define CONV_CHAIN_MAX_LAYERS 3
+
+// A layer with ker_ch 0 is depthwise; batch comes from the chain.
+typedef struct
+{
+    const char *shape;
+    int32_t batch, num;
+    conv_shape layers[CONV_CHAIN_MAX_LAYERS];
+} conv_chain_shape;
+
+//                      in_x in_y in_ch batch out_ch ker_x ker_y ker_ch pad_x pad_y s_x s_y d_x d_y
+static const conv_chain_shape conv_chain_shapes[] =
+{
+    {"mbv2_14x14x16", 1, 3, {
+        {"expand",      14,  14,  16,   0,   48,    1,    1,   16,    0,    0,   1,  1,  1,  1},
+        {"dw",          14,  14,  48,   0,   48,    3,    3,    0,    1,    1,   1,  1,  1,  1},
+        {"project",     14,  14,  48,   0,   16,    1,    1,   48,    0,    0,   1,  1,  1,  1}}},
+    {"s2_b2_15x13x8", 2, 3, {
+        {"conv",        15,  13,   8,   0,   12,    3,    3,    8,    1,    1,   1,  1,  1,  1},
+        {"dw_s2",       15,  13,  12,   0,   12,    3,    3,    0,    1,    1,   2,  2,  1,  1},
+        {"project",      8,   7,  12,   0,    8,    1,    1,   12,    0,    0,   1,  1,  1,  1}}},
+    {"dil_g2_12x10x6", 1, 3, {
+        {"dw_mult2",    12,  10,   6,   0,   12,    3,    3,    0,    2,    2,   1,  1,  2,  2},
+        {"g2_s2",       12,  10,  12,   0,   12,    3,    3,    6,    1,    1,   2,  2,  1,  1},
+        {"project",      6,   5,  12,   0,   10,    1,    1,   12,    0,    0,   1,  1,  1,  1}}},
+};
+
+typedef struct
+{
+    conf_hdr hdr;
+    const conv_chain_shape *c;
+    int32_t batch, num, tile_rows;
+    riscv_nn_conv_layer layers[CONV_CHAIN_MAX_LAYERS];
+    int8_t *in, *ref, *out;
+    int8_t *mid[CONV_CHAIN_MAX_LAYERS];
+    int8_t *wt[CONV_CHAIN_MAX_LAYERS];
+    int32_t *bias[CONV_CHAIN_MAX_LAYERS], *scale[CONV_CHAIN_MAX_LAYERS], *shift[CONV_CHAIN_MAX_LAYERS];
+    int16_t *buf;
+} conv_chain_args;
+
+static void run_ref_conv_chain(void *args)
+{
+    conv_chain_args *a = (conv_chain_args *)args;
+    const int8_t *src = a->in;
+    int32_t i;
+
+    for (i = 0; i < a->num; i++)
+    {
+        const riscv_nn_conv_layer *l = &a->layers[i];
+        conv_shape s = a->c->layers[i];
+        int8_t *dst = (i == a->num - 1) ? a->ref : a->mid[i];
+
+        s.batch = a->batch;
+        ref_conv_s8_asym(&s, l->type == NN_CONV_DEPTHWISE, src, l->ker_weight, l->bias, l->out_shift,
+                         l->out_scale, l->out_offset, l->in_offset, l->act_min, l->act_max, l->out_dim_x,
+                         l->out_dim_y, dst);
+        src = dst;
+    }
+}
+
+static void run_conv_chain(void *args)
+{
+    conv_chain_args *a = (conv_chain_args *)args;
+    a->hdr.status = riscv_nn_conv_chain_s8(a->in, a->batch, a->layers, a->num, a->out, a->tile_rows, a->buf);
+}
+
+static void conf_conv_chain(void)
+{
+    int32_t i, j, k;
+
+    for (i = 0; i < (int32_t)(sizeof(conv_chain_shapes) / sizeof(conv_chain_shapes[0])); i++)
+    {
+        const conv_chain_shape *c = &conv_chain_shapes[i];
+        const conv_shape *s0 = &c->layers[0];
+        const size_t in_size = (size_t)s0->in_x * s0->in_y * s0->in_ch * c->batch;
+        const riscv_nn_conv_layer *last;
+        conv_chain_args a;
+        size_t out_size;
+        double ref_ns;
+
+        memset(&a, 0, sizeof(a));
+        a.c = c;
+        a.batch = c->batch;
+        a.num = c->num;
+        for (j = 0; j < c->num; j++)
+        {
+            const conv_shape *s = &c->layers[j];
+            riscv_nn_conv_layer *l = &a.layers[j];
+            const int32_t depthwise = (s->ker_ch == 0);
+            const size_t wt_size = (size_t)s->out_ch * s->ker_x * s->ker_y * (depthwise ? 1 : s->ker_ch);
+
+            a.wt[j] = nn_bench_alloc(wt_size);
+            a.bias[j] = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+            a.scale[j] = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+            a.shift[j] = nn_bench_alloc(sizeof(int32_t) * s->out_ch);
+            nn_bench_fill_s8(a.wt[j], wt_size, -127, 127);
+            nn_bench_fill_s32(a.bias[j], s->out_ch, -5000, 5000);
+            fill_quant_params(a.scale[j], a.shift[j], s->out_ch);
+
+            *l = (riscv_nn_conv_layer){depthwise ? NN_CONV_DEPTHWISE : NN_CONV_STANDARD, a.wt[j], a.bias[j],
+                a.shift[j], a.scale[j], s->in_x, s->in_y, s->in_ch, s->out_ch, s->out_ch / s->in_ch,
+                s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x, s->stride_y, s->dilation_x,
+                s->dilation_y, -3, 3, (j == 1) ? 0 : -128, 127,
+                (s->in_x + 2 * s->pad_x - (s->dilation_x * (s->ker_x - 1) + 1)) / s->stride_x + 1,
+                (s->in_y + 2 * s->pad_y - (s->dilation_y * (s->ker_y - 1) + 1)) / s->stride_y + 1};
+            a.mid[j] = nn_bench_alloc((size_t)l->out_dim_x * l->out_dim_y * l->out_ch * c->batch);
+        }
+        last = &a.layers[c->num - 1];
+        out_size = (size_t)last->out_dim_x * last->out_dim_y * last->out_ch * c->batch;
+        a.in = nn_bench_alloc(in_size);
+        a.ref = nn_bench_alloc(out_size);
+        a.out = nn_bench_alloc(out_size);
+        nn_bench_fill_s8(a.in, in_size, -128, 127);
+        run_ref_conv_chain(&a);
+        ref_ns = conf_time(run_ref_conv_chain, &a);
+
+        // a few tile heights, then the whole output (layer by layer)
+        for (k = 1; k <= last->out_dim_y; k = (k < 3) ? k + 1 : last->out_dim_y)
+        {
+            riscv_nn_conv_chain_cost cost;
+            char variant[64];
+
+            if (k == last->out_dim_y)
+            {
+                snprintf(variant, sizeof(variant), "riscv_nn_conv_chain_s8 (whole output)");
+            }
+            else
+            {
+                snprintf(variant, sizeof(variant), "riscv_nn_conv_chain_s8 (tile %ld)", (long)k);
+            }
+            a.tile_rows = k;
+            riscv_nn_conv_chain_s8_get_cost(a.layers, a.num, k, &cost);
+            free(a.buf);
+            a.buf = nn_bench_alloc(riscv_nn_conv_chain_s8_get_buffer_size(a.layers, a.num, k));
+            conf_check("conv_chain", variant, c->shape, run_conv_chain, &a, CONF_S8, a.ref, a.out, out_size, 0,
+                       ref_ns);
+            if (conf_selected("conv_chain", variant, c->shape))
+            {
+                printf("    buffer %ld bytes (%ld of tiles), %lld MACs per batch, %lld recomputed\n",
+                       (long)cost.buffer_size, (long)cost.tile_size, (long long)cost.macs,
+                       (long long)cost.recomputed_macs);
+            }
+            if (k == last->out_dim_y)
+            {
+                break;
+            }
+        }
+
+        free(a.in);
+        free(a.ref);
+        free(a.out);
+        free(a.buf);
+        for (j = 0; j < c->num; j++)
+        {
+            free(a.mid[j]);
+            free(a.wt[j]);
+            free(a.bias[j]);
+            free(a.scale[j]);
+            free(a.shift[j]);
+        }
+    }
+}
+
+//==============================================================================
+// Parallel execution
+//==============================================================================
+
+// The riscv_nn_*_mt functions must be bit-exact with the functions they split,
+// whatever the dispatcher. They are run through the built-in POSIX-thread
+// dispatcher and through a custom one that runs the tasks backwards on the
+// caller. The speedup column is relative to the single-threaded function.
+
+static void conf_reverse_dispatch(riscv_nn_task_fn task, void *ctx, int32_t num_tasks, void *user_data)
+{
+    int32_t i;
+
+    (void)user_data;
+    for (i = num_tasks - 1; i >= 0; i--)
+    {
+        task(ctx, i);
+    }
+}
+
+static const struct
+{
+    const char *name;
+    riscv_nn_dispatch_fn dispatch;
+    int32_t threads;
+} par_configs[] =
+{
+    {"pthread x4", NULL, 4},
+    {"reverse x3", conf_reverse_dispatch, 3},
+};
+
+static void run_conv_wrapper_mt_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt(a->in, a->s.in_x, a->s.in_y, a->s.in_ch,
+        a->s.batch, a->wt, a->s.out_ch, a->s.ker_x, a->s.ker_y, a->s.ker_ch, a->s.pad_x, a->s.pad_y,
+        a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale, -3, 7, -128, 127,
+        a->out_x, a->out_y, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+static void run_conv_dw_wrapper_mt_s8(void *args)
+{
+    conv_args *a = (conv_args *)args;
+    a->hdr.status = riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt(a->in, a->s.in_x, a->s.in_y,
+        a->s.in_ch, a->wt, a->s.out_ch, a->s.out_ch / a->s.in_ch, a->s.ker_x, a->s.ker_y,
+        a->s.pad_x, a->s.pad_y, a->s.stride_x, a->s.stride_y, a->bias, a->out, a->shift, a->scale,
+        a->out_x, a->out_y, -3, 7, -128, 127, a->s.dilation_x, a->s.dilation_y, a->buf);
+}
+
+typedef struct
+{
+    const char *shape;
+    int32_t batch, col, row;
+} fc_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    fc_shape s;
+    int8_t *in, *wt, *ref, *out;
+    int32_t *bias;
+    int16_t *buf;
+    int32_t mult, shift;
+} fc_args;
+
+static void run_ref_fc_s8(void *args)
+{
+    fc_args *a = (fc_args *)args;
+    riscv_nn_fc_s8_s8_s8_asym_bias(a->in, a->wt, a->s.col, a->s.row, a->s.batch, 5, 0, a->mult,
+                                   a->shift, -3, a->bias, a->ref, -128, 127, a->buf);
+}
+
+static void run_fc_mt_s8(void *args)
+{
+    fc_args *a = (fc_args *)args;
+    a->hdr.status = riscv_nn_fc_s8_s8_s8_asym_bias_mt(a->in, a->wt, a->s.col, a->s.row, a->s.batch, 5, 0,
+                                                      a->mult, a->shift, -3, a->bias, a->out, -128, 127,
+                                                      a->buf);
+}
+
+static const fc_shape fc_shapes[] =
+{
+    {"1x256x1000", 1, 256, 1000},
+    {"2x33x255", 2, 33, 255},
+    {"6x64x12", 6, 64, 12},
+};
+
+typedef struct
+{
+    const char *shape;
+    int32_t lhs_n, lhs_h, lhs_w, rhs_n, rhs_h, rhs_w, c;
+} bmm_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    bmm_shape s;
+    int32_t out_n, out_h;
+    int8_t *lhs, *rhs, *ref, *out, *rhs_nt;
+    int16_t *lhs16, *rhs16, *ref16, *out16, *rhs16_nt;
+    int32_t *bias;
+    int64_t *bias64;
+    int32_t mult, shift, rhs_offset;
+} bmm_args;
+
+// Every output matrix (n, h) multiplies lhs matrix (n % lhs_n, h % lhs_h) by
+// the transpose of rhs matrix (n % rhs_n, h % rhs_h): a dimension of 1 is
+// broadcast against the other operand.
+static void ref_bmm(bmm_args *a, int32_t s16)
+{
+    const bmm_shape *s = &a->s;
+    const int32_t mult16 = (a->mult < 0x7FFF0000) ? ((a->mult + (1 << 15)) >> 16) : 0x7FFF;
+    int32_t n, h, i, j, k;
+
+    for (n = 0; n < a->out_n; n++)
+    {
+        for (h = 0; h < a->out_h; h++)
+        {
+            const size_t lhs_base = ((size_t)(n % s->lhs_n) * s->lhs_h + h % s->lhs_h) * s->lhs_w * s->c;
+            const size_t rhs_base = ((size_t)(n % s->rhs_n) * s->rhs_h + h % s->rhs_h) * s->rhs_w * s->c;
+            const size_t out_base = ((size_t)n * a->out_h + h) * s->lhs_w * s->rhs_w;
+
+            for (i = 0; i < s->lhs_w; i++)
+            {
+                for (j = 0; j < s->rhs_w; j++)
+                {
+                    int64_t acc = 0;
+                    for (k = 0; k < s->c; k++)
+                    {
+                        const size_t l = lhs_base + (size_t)i * s->c + k;
+                        const size_t r = rhs_base + (size_t)j * s->c + k;
+                        acc += s16 ? (int64_t)a->lhs16[l] * a->rhs16[r]
+                                   : (int64_t)(a->lhs[l] + 4) * (a->rhs[r] + a->rhs_offset);
+                    }
+                    if (s16)
+                    {
+                        int32_t res = (int32_t)(((acc + a->bias64[j]) * mult16) >> (14 - a->shift));
+                        res = (res + 1) >> 1;
+                        res = MAX(res, -32768);
+                        a->ref16[out_base + (size_t)i * s->rhs_w + j] = (int16_t)MIN(res, 32767);
+                    }
+                    else
+                    {
+                        a->ref[out_base + (size_t)i * s->rhs_w + j] =
+                            ref_output_s8((int32_t)acc + a->bias[j], a->mult, a->shift, -3, -128, 127);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void run_ref_bmm_s8(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    riscv_nn_batch_matmul_s8_s8_s8(a->lhs, a->rhs, 4, 0, a->bias, a->ref, -3, a->mult, a->shift,
+                                   a->s.lhs_n, a->s.lhs_h, a->s.lhs_w, a->s.rhs_n, a->s.rhs_h, a->s.rhs_w,
+                                   a->s.c, a->out_n, a->out_h, -128, 127);
+}
+
+static void run_bmm_mt_s8(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    a->hdr.status = riscv_nn_batch_matmul_s8_s8_s8_mt(a->lhs, a->rhs, 4, 0, a->bias, a->out, -3, a->mult,
+                                                      a->shift, a->s.lhs_n, a->s.lhs_h, a->s.lhs_w,
+                                                      a->s.rhs_n, a->s.rhs_h, a->s.rhs_w, a->s.c,
+                                                      a->out_n, a->out_h, -128, 127);
+}
+
+// the last two broadcast the lhs over N and the rhs over H, and the other way
+static const bmm_shape bmm_shapes[] =
+{
+    {"2x3x5x16_2x3x7", 2, 3, 5, 2, 3, 7, 16},
+    {"1x4x9x8_2x1x6", 1, 4, 9, 2, 1, 6, 8},
+    {"2x1x1x32_1x3x12", 2, 1, 1, 1, 3, 12, 32},
+};
+
+static void run_ref_bmm_ref_s8(void *args)
+{
+    ref_bmm((bmm_args *)args, 0);
+}
+
+static void run_ref_bmm_ref_s16(void *args)
+{
+    ref_bmm((bmm_args *)args, 1);
+}
+
+static void run_bmm_s8(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    a->hdr.status = riscv_nn_batch_matmul_s8_s8_s8(a->lhs, a->rhs, 4, a->rhs_offset, a->bias, a->out, -3,
+                                                   a->mult, a->shift, a->s.lhs_n, a->s.lhs_h, a->s.lhs_w,
+                                                   a->s.rhs_n, a->s.rhs_h, a->s.rhs_w, a->s.c, a->out_n,
+                                                   a->out_h, -128, 127);
+}
+
+static void run_bmm_s16(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    a->hdr.status = riscv_nn_batch_matmul_s16_s16_s16(a->lhs16, a->rhs16, 0, 0, a->bias64, a->out16, 0,
+                                                      a->mult, a->shift, a->s.lhs_n, a->s.lhs_h, a->s.lhs_w,
+                                                      a->s.rhs_n, a->s.rhs_h, a->s.rhs_w, a->s.c, a->out_n,
+                                                      a->out_h, -32768, 32767);
+}
+
+static void run_bmm_rhs_nt_s8(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    a->hdr.status = riscv_nn_batch_matmul_s8_s8_s8_rhs_nt(a->lhs, a->rhs_nt, 4, a->rhs_offset, a->bias, a->out,
+                                                          -3, a->mult, a->shift, a->s.lhs_n, a->s.lhs_h,
+                                                          a->s.lhs_w, a->s.rhs_n, a->s.rhs_h, a->s.c,
+                                                          a->s.rhs_w, a->out_n, a->out_h, -128, 127);
+}
+
+static void run_bmm_rhs_nt_s16(void *args)
+{
+    bmm_args *a = (bmm_args *)args;
+    a->hdr.status = riscv_nn_batch_matmul_s16_s16_s16_rhs_nt(a->lhs16, a->rhs16_nt, 0, 0, a->bias64, a->out16,
+                                                             0, a->mult, a->shift, a->s.lhs_n, a->s.lhs_h,
+                                                             a->s.lhs_w, a->s.rhs_n, a->s.rhs_h, a->s.c,
+                                                             a->s.rhs_w, a->out_n, a->out_h, -32768, 32767);
+}
+
+// attention products per head (Q.K^T, then P.V with V transposed; the rhs_nt
+// variants take V as is) and the broadcast forms
+static const bmm_shape bmm_attn_shapes[] =
+{
+    {"qk_h4_s64_d32",     1, 4,  64, 1, 4,  64, 32},
+    {"pv_h4_s64_d32",     1, 4,  64, 1, 4,  32, 64},
+    {"qk_h8_s128_d64",    1, 8, 128, 1, 8, 128, 64},
+    {"pv_h8_s128_d64",    1, 8, 128, 1, 8,  64, 128},
+    {"qk_h4_s256_d64",    1, 4, 256, 1, 4, 256, 64},
+    {"kv_bcast_2x6x5x24", 2, 6,  5, 2, 1,  13, 24},
+    {"2x3x5x16_2x3x7",    2, 3,  5, 2, 3,   7, 16},
+    {"1x4x9x8_2x1x6",     1, 4,  9, 2, 1,   6, 8},
+    {"2x1x1x32_1x3x12",   2, 1,  1, 1, 3,  12, 32},
+    {"1x1x3x20_3x2x9",    1, 1,  3, 3, 2,   9, 20},
+};
+
+static void conf_batch_matmul(void)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(bmm_attn_shapes) / sizeof(bmm_attn_shapes[0])); i++)
+    {
+        const bmm_shape *s = &bmm_attn_shapes[i];
+        const size_t lhs_size = (size_t)s->lhs_n * s->lhs_h * s->lhs_w * s->c;
+        const size_t rhs_size = (size_t)s->rhs_n * s->rhs_h * s->rhs_w * s->c;
+        size_t out_size;
+        bmm_args a;
+        double ref_ns;
+        int32_t j;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.out_n = MAX(s->lhs_n, s->rhs_n);
+        a.out_h = MAX(s->lhs_h, s->rhs_h);
+        out_size = (size_t)a.out_n * a.out_h * s->lhs_w * s->rhs_w;
+        a.lhs = nn_bench_alloc(lhs_size);
+        a.rhs = nn_bench_alloc(rhs_size);
+        a.ref = nn_bench_alloc(out_size);
+        a.out = nn_bench_alloc(out_size);
+        a.bias = nn_bench_alloc(sizeof(int32_t) * s->rhs_w);
+        a.lhs16 = nn_bench_alloc(sizeof(int16_t) * lhs_size);
+        a.rhs16 = nn_bench_alloc(sizeof(int16_t) * rhs_size);
+        a.ref16 = nn_bench_alloc(sizeof(int16_t) * out_size);
+        a.out16 = nn_bench_alloc(sizeof(int16_t) * out_size);
+        a.bias64 = nn_bench_alloc(sizeof(int64_t) * s->rhs_w);
+        a.rhs_nt = nn_bench_alloc(rhs_size);
+        a.rhs16_nt = nn_bench_alloc(sizeof(int16_t) * rhs_size);
+        nn_bench_fill_s8(a.lhs, lhs_size, -128, 127);
+        nn_bench_fill_s8(a.rhs, rhs_size, -127, 127);
+        nn_bench_fill_s32(a.bias, s->rhs_w, -5000, 5000);
+        nn_bench_fill_s16(a.lhs16, lhs_size, -32768, 32767);
+        nn_bench_fill_s16(a.rhs16, rhs_size, -32768, 32767);
+
+        // the same rhs matrices in natural [c][rhs_w] layout
+        for (j = 0; j < s->rhs_n * s->rhs_h; j++)
+        {
+            const size_t base = (size_t)j * s->rhs_w * s->c;
+            int32_t r, k;
+
+            for (r = 0; r < s->rhs_w; r++)
+            {
+                for (k = 0; k < s->c; k++)
+                {
+                    a.rhs_nt[base + (size_t)k * s->rhs_w + r] = a.rhs[base + (size_t)r * s->c + k];
+                    a.rhs16_nt[base + (size_t)k * s->rhs_w + r] = a.rhs16[base + (size_t)r * s->c + k];
+                }
+            }
+        }
+        for (j = 0; j < s->rhs_w; j++)
+        {
+            a.bias64[j] = (int64_t)a.bias[j] * 65536;
+        }
+        fill_quant_params(&a.mult, &a.shift, 1);
+
+        for (j = 0; j < 2; j++)
+        {
+            a.rhs_offset = j ? 2 : 0;
+            run_ref_bmm_ref_s8(&a);
+            ref_ns = conf_time(run_ref_bmm_ref_s8, &a);
+            conf_check("batch_matmul", j ? "riscv_nn_batch_matmul_s8_s8_s8 (rhs_offset)" :
+                       "riscv_nn_batch_matmul_s8_s8_s8", s->shape, run_bmm_s8, &a, CONF_S8, a.ref, a.out,
+                       out_size, 0, ref_ns);
+            conf_check("batch_matmul", j ? "riscv_nn_batch_matmul_s8_s8_s8_rhs_nt (rhs_offset)" :
+                       "riscv_nn_batch_matmul_s8_s8_s8_rhs_nt", s->shape, run_bmm_rhs_nt_s8, &a, CONF_S8,
+                       a.ref, a.out, out_size, 0, ref_ns);
+        }
+
+        // keep the 64-bit accumulators inside the 16-bit output range
+        a.shift -= 16;
+        run_ref_bmm_ref_s16(&a);
+        ref_ns = conf_time(run_ref_bmm_ref_s16, &a);
+        conf_check("batch_matmul", "riscv_nn_batch_matmul_s16_s16_s16", s->shape, run_bmm_s16, &a, CONF_S16,
+                   a.ref16, a.out16, out_size, 0, ref_ns);
+        conf_check("batch_matmul", "riscv_nn_batch_matmul_s16_s16_s16_rhs_nt", s->shape, run_bmm_rhs_nt_s16,
+                   &a, CONF_S16, a.ref16, a.out16, out_size, 0, ref_ns);
+
+        free(a.lhs);
+        free(a.rhs);
+        free(a.ref);
+        free(a.out);
+        free(a.bias);
+        free(a.lhs16);
+        free(a.rhs16);
+        free(a.ref16);
+        free(a.out16);
+        free(a.bias64);
+        free(a.rhs_nt);
+        free(a.rhs16_nt);
+    }
+}
+
+typedef struct
+{
+    const char *shape;
+    int32_t batch, q_heads, kv_heads, q_len, kv_len, head_dim, causal, masked;
+} attn_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    attn_shape s;
+    int8_t *q, *k, *v, *ref, *out;
+    uint8_t *mask;
+    int16_t *buf;
+    int32_t qk_mult, qk_shift, out_mult, out_shift, k_offset;
+} attn_args;
+
+#define ATTN_SM_SCALE 1077952576
+#define ATTN_SM_LSHIFT 23
+#define ATTN_DIFF_MIN (-248)
+
+// Unfused attention in double precision on the same 8-bit scores: the softmax
+// input is diff * 2^lshift * scale in Q5.26, as riscv_nn_softmax_s8_s16_hp.
+static void ref_attention_s8(void *args)
+{
+    attn_args *a = (attn_args *)args;
+    const attn_shape *s = &a->s;
+    const int32_t group = s->q_heads / s->kv_heads;
+    const double sm = ldexp((double)ATTN_SM_SCALE * ldexp(1.0, ATTN_SM_LSHIFT), -31 - 26);
+    int32_t *scores = nn_bench_alloc(sizeof(int32_t) * s->kv_len);
+    double *w = nn_bench_alloc(sizeof(double) * s->kv_len);
+    int32_t b, h, i, j, c;
+
+    for (b = 0; b < s->batch; b++)
+    {
+        for (h = 0; h < s->q_heads; h++)
+        {
+            const size_t kv_base = (size_t)(b * s->kv_heads + h / group) * s->kv_len * s->head_dim;
+            const size_t q_base = (size_t)(b * s->q_heads + h) * s->q_len * s->head_dim;
+
+            for (i = 0; i < s->q_len; i++)
+            {
+                const int8_t *q_row = a->q + q_base + (size_t)i * s->head_dim;
+                int8_t *out = a->ref + q_base + (size_t)i * s->head_dim;
+                int32_t max = -256;
+                double sum = 0.0;
+
+                for (j = 0; j < s->kv_len; j++)
+                {
+                    int32_t acc = 0;
+                    scores[j] = -256;
+                    if ((s->causal && j > i + s->kv_len - s->q_len) ||
+                        (a->mask && !a->mask[b * s->kv_len + j]))
+                    {
+                        continue;
+                    }
+                    for (c = 0; c < s->head_dim; c++)
+                    {
+                        acc += (q_row[c] + 3) * (a->k[kv_base + (size_t)j * s->head_dim + c] + a->k_offset);
+                    }
+                    scores[j] = ref_output_s8(acc, a->qk_mult, a->qk_shift, 0, -128, 127);
+                    max = MAX(max, scores[j]);
+                }
+                for (j = 0; j < s->kv_len; j++)
+                {
+                    const int32_t diff = scores[j] - max;
+                    w[j] = (scores[j] != -256 && diff >= ATTN_DIFF_MIN) ? exp(diff * sm) : 0.0;
+                    sum += w[j];
+                }
+                for (c = 0; c < s->head_dim; c++)
+                {
+                    double o = 0.0;
+                    int32_t res = -5;
+                    if (sum > 0.0)
+                    {
+                        for (j = 0; j < s->kv_len; j++)
+                        {
+                            o += w[j] * (a->v[kv_base + (size_t)j * s->head_dim + c] - 2);
+                        }
+                        res += (int32_t)lrint(ldexp(o / sum * a->out_mult, a->out_shift - 31));
+                    }
+                    res = MAX(res, -128);
+                    out[c] = (int8_t)MIN(res, 127);
+                }
+            }
+        }
+    }
+    free(scores);
+    free(w);
+}
+
+static void run_attention_s8(void *args)
+{
+    attn_args *a = (attn_args *)args;
+    a->hdr.status = riscv_nn_attention_s8_s8_s8(a->q, a->k, a->v, a->mask, a->out, a->s.batch, a->s.q_heads,
+                                                a->s.kv_heads, a->s.q_len, a->s.kv_len, a->s.head_dim, 3,
+                                                a->k_offset, -2, a->qk_mult, a->qk_shift, ATTN_SM_SCALE,
+                                                ATTN_SM_LSHIFT, ATTN_DIFF_MIN, -5, a->out_mult, a->out_shift,
+                                                -128, 127, a->s.causal, a->buf);
+}
+
+// self-attention heads, a prefill chunk against earlier context, grouped
+// key/value heads and padded keys; odd sizes leave partial tiles and blocks.
+// masked = 2 makes the padded keys score highest, above every visible key.
+static const attn_shape attn_shapes[] =
+{
+    {"h4_s64_d32",           1, 4, 4,  64,  64, 32, 0, 0},
+    {"h4_s64_d32_causal",    1, 4, 4,  64,  64, 32, 1, 0},
+    {"h8_s128_d64_causal",   1, 8, 8, 128, 128, 64, 1, 0},
+    {"q20_kv150_d24_causal", 1, 2, 2,  20, 150, 24, 1, 0},
+    {"gqa_h8_kv2_s37_d16",   1, 8, 2,  37,  37, 16, 0, 0},
+    {"pad_2x3_s45_d20",      2, 3, 3,  45,  45, 20, 0, 1},
+    {"pad_causal_2x2_s70",   2, 2, 1,  70,  70,  8, 1, 1},
+    {"pad_hot_2x2_s90_d16",  2, 2, 2,  90,  90, 16, 1, 2},
+};
+
+static void conf_attention(void)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(attn_shapes) / sizeof(attn_shapes[0])); i++)
+    {
+        const attn_shape *s = &attn_shapes[i];
+        const size_t q_size = (size_t)s->batch * s->q_heads * s->q_len * s->head_dim;
+        const size_t kv_size = (size_t)s->batch * s->kv_heads * s->kv_len * s->head_dim;
+        attn_args a;
+        double ref_ns;
+        int32_t j;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.q = nn_bench_alloc(q_size);
+        a.k = nn_bench_alloc(kv_size);
+        a.v = nn_bench_alloc(kv_size);
+        a.ref = nn_bench_alloc(q_size);
+        a.out = nn_bench_alloc(q_size);
+        a.buf = nn_bench_alloc(riscv_nn_attention_s8_s8_s8_get_buffer_size(s->head_dim));
+        nn_bench_fill_s8(a.q, q_size, -128, 127);
+        nn_bench_fill_s8(a.k, kv_size, -127, 127);
+        nn_bench_fill_s8(a.v, kv_size, -127, 127);
+        fill_quant_params(&a.qk_mult, &a.qk_shift, 1);
+        a.out_mult = nn_bench_rand_range(1 << 30, 0x7FFFFFFF);
+        a.out_shift = 1;
+        if (s->masked)
+        {
+            // pad the tail of the second batch and a few keys of the first;
+            // the last batch keeps no key for its first rows when causal
+            a.mask = nn_bench_alloc((size_t)s->batch * s->kv_len);
+            for (j = 0; j < s->batch * s->kv_len; j++)
+            {
+                const int32_t key = j % s->kv_len;
+                a.mask[j] = (j < s->kv_len) ? (key % 7 != 3) : (key >= 5 && key < s->kv_len - 9);
+            }
+        }
+        if (s->masked == 2)
+        {
+            // non-negative queries against all-127 keys saturate the score
+            // of every padded key
+            nn_bench_fill_s8(a.q, q_size, 0, 127);
+            for (j = 0; j < (int32_t)(kv_size / s->head_dim); j++)
+            {
+                const int32_t b = j / (s->kv_heads * s->kv_len);
+                if (!a.mask[b * s->kv_len + j % s->kv_len])
+                {
+                    memset(a.k + (size_t)j * s->head_dim, 127, s->head_dim);
+                }
+            }
+        }
+
+        for (j = 0; j < 2; j++)
+        {
+            a.k_offset = j ? 1 : 0;
+            ref_attention_s8(&a);
+            ref_ns = conf_time(ref_attention_s8, &a);
+            conf_check("attention", j ? "riscv_nn_attention_s8_s8_s8 (k_offset)" : "riscv_nn_attention_s8_s8_s8",
+                       s->shape, run_attention_s8, &a, CONF_S8, a.ref, a.out, q_size, 1, ref_ns);
+        }
+
+        free(a.q);
+        free(a.k);
+        free(a.v);
+        free(a.ref);
+        free(a.out);
+        free(a.buf);
+        free(a.mask);
+    }
+}
+
+typedef struct
+{
+    const char *shape;
+    int32_t q_heads, kv_heads, head_dim, capacity, prompt, steps;
+    int32_t k_offset, v_offset;
+} decode_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    decode_shape s;
+    int8_t *q, *k, *v, *ref, *out, *k_cache, *v_cache;
+    int16_t *buf;
+    riscv_nn_scaling *qk_scaling, *out_scaling;
+    int16_t *k_offset, *v_offset;
+} decode_args;
+
+// Tokens kept in the cache once step (0-based) has been appended: the window
+// slides by one token when the cache is full, and every 5th step of a full
+// cache drops 3 tokens at once instead.
+static int32_t decode_evict(const decode_shape *s, int32_t len, int32_t step)
+{
+    if (len < s->capacity)
+    {
+        return 0;
+    }
+    return (step % 5 == 4) ? 3 : 1;
+}
+
+// k and v hold every token of the run as [kv_heads][prompt + steps][head_dim];
+// each step attends to the newest len of them.
+static void ref_decode_attention_s8(void *args)
+{
+    decode_args *a = (decode_args *)args;
+    const decode_shape *s = &a->s;
+    const int32_t total = s->prompt + s->steps;
+    const int32_t group = s->q_heads / s->kv_heads;
+    const double sm = ldexp((double)ATTN_SM_SCALE * ldexp(1.0, ATTN_SM_LSHIFT), -31 - 26);
+    int32_t *scores = nn_bench_alloc(sizeof(int32_t) * total);
+    double *w = nn_bench_alloc(sizeof(double) * total);
+    int32_t len = s->prompt;
+    int32_t step, h, j, c;
+
+    for (step = 0; step < s->steps; step++)
+    {
+        const int32_t end = s->prompt + step + 1;
+
+        len -= decode_evict(s, len, step);
+        len++;
+        for (h = 0; h < s->q_heads; h++)
+        {
+            const int32_t kv_h = h / group;
+            const int32_t k_offset = (a->k_offset != NULL) ? a->k_offset[kv_h] : 0;
+            const int32_t v_offset = (a->v_offset != NULL) ? a->v_offset[kv_h] : 0;
+            const int8_t *q_row = a->q + ((size_t)step * s->q_heads + h) * s->head_dim;
+            int8_t *out = a->ref + ((size_t)step * s->q_heads + h) * s->head_dim;
+            int32_t max = -128;
+            double sum = 0.0;
+
+            for (j = end - len; j < end; j++)
+            {
+                int32_t acc = 0;
+                for (c = 0; c < s->head_dim; c++)
+                {
+                    acc += (q_row[c] + 3) * (a->k[((size_t)kv_h * total + j) * s->head_dim + c] + k_offset);
+                }
+                scores[j] = ref_output_s8(acc, a->qk_scaling[kv_h].multiplier, a->qk_scaling[kv_h].shift, 0,
+                                          -128, 127);
+                max = MAX(max, scores[j]);
+            }
+            for (j = end - len; j < end; j++)
+            {
+                w[j] = (scores[j] - max >= ATTN_DIFF_MIN) ? exp((scores[j] - max) * sm) : 0.0;
+                sum += w[j];
+            }
+            for (c = 0; c < s->head_dim; c++)
+            {
+                double o = 0.0;
+                int32_t res;
+                for (j = end - len; j < end; j++)
+                {
+                    o += w[j] * (a->v[((size_t)kv_h * total + j) * s->head_dim + c] + v_offset);
+                }
+                res = 4 + (int32_t)lrint(ldexp(o / sum * a->out_scaling[kv_h].multiplier,
+                                               a->out_scaling[kv_h].shift - 31));
+                res = MAX(res, -128);
+                out[c] = (int8_t)MIN(res, 127);
+            }
+        }
+    }
+    free(scores);
+    free(w);
+}
+
+// Gather the keys and values of tokens [first, first + tokens) of every head.
+static void decode_gather(const decode_args *a, int32_t first, int32_t tokens, int8_t *k, int8_t *v)
+{
+    const decode_shape *s = &a->s;
+    const int32_t total = s->prompt + s->steps;
+    int32_t h;
+
+    for (h = 0; h < s->kv_heads; h++)
+    {
+        const size_t src = ((size_t)h * total + first) * s->head_dim;
+        const size_t dst = (size_t)h * tokens * s->head_dim;
+        memcpy(k + dst, a->k + src, (size_t)tokens * s->head_dim);
+        memcpy(v + dst, a->v + src, (size_t)tokens * s->head_dim);
+    }
+}
+
+static void run_decode_attention_s8(void *args)
+{
+    decode_args *a = (decode_args *)args;
+    const decode_shape *s = &a->s;
+    int8_t *k_new = nn_bench_alloc((size_t)s->kv_heads * s->prompt * s->head_dim);
+    int8_t *v_new = nn_bench_alloc((size_t)s->kv_heads * s->prompt * s->head_dim);
+    riscv_nn_kv_cache_s8 cache;
+    int32_t step;
+
+    a->hdr.status = riscv_nn_kv_cache_s8_init(&cache, a->k_cache, a->v_cache, a->qk_scaling, a->out_scaling,
+                                              a->k_offset, a->v_offset, s->kv_heads, s->head_dim, s->capacity);
+    decode_gather(a, 0, s->prompt, k_new, v_new);
+    a->hdr.status |= riscv_nn_kv_cache_s8_append(&cache, k_new, v_new, s->prompt);
+    for (step = 0; step < s->steps; step++)
+    {
+        a->hdr.status |= riscv_nn_kv_cache_s8_evict(&cache, decode_evict(s, cache.len, step));
+        decode_gather(a, s->prompt + step, 1, k_new, v_new);
+        a->hdr.status |= riscv_nn_kv_cache_s8_append(&cache, k_new, v_new, 1);
+        a->hdr.status |= riscv_nn_decode_attention_s8_s8_s8(a->q + (size_t)step * s->q_heads * s->head_dim,
+                                                            &cache, a->out + (size_t)step * s->q_heads * s->head_dim,
+                                                            s->q_heads, 3, ATTN_SM_SCALE, ATTN_SM_LSHIFT,
+                                                            ATTN_DIFF_MIN, 4, -128, 127, a->buf);
+    }
+    free(k_new);
+    free(v_new);
+}
+
+// a prompt followed by decode steps; the small capacities wrap the ring and
+// evict while decoding. Head h uses the key and value offsets of its shape
+// moved h towards 0, and shapes with zero offsets leave them as null pointers.
+static const decode_shape decode_shapes[] =
+{
+    {"h4_d32_c256_p100x40",     4, 4, 32, 256, 100, 40,   0,    0},
+    {"h8kv2_d64_c96_p90x30",    8, 2, 64,  96,  90, 30,  -5,    7},
+    {"h2_d20_c37_p37x50",       2, 2, 20,  37,  37, 50, 127, -128},
+};
+
+static void conf_decode_attention(void)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(decode_shapes) / sizeof(decode_shapes[0])); i++)
+    {
+        const decode_shape *s = &decode_shapes[i];
+        const size_t q_size = (size_t)s->steps * s->q_heads * s->head_dim;
+        const size_t kv_size = (size_t)s->kv_heads * (s->prompt + s->steps) * s->head_dim;
+        const size_t cache_size = (size_t)s->kv_heads * s->capacity * s->head_dim;
+        decode_args a;
+        double ref_ns;
+        int32_t j;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.q = nn_bench_alloc(q_size);
+        a.k = nn_bench_alloc(kv_size);
+        a.v = nn_bench_alloc(kv_size);
+        a.ref = nn_bench_alloc(q_size);
+        a.out = nn_bench_alloc(q_size);
+        a.k_cache = nn_bench_alloc(cache_size);
+        a.v_cache = nn_bench_alloc(cache_size);
+        a.buf = nn_bench_alloc(riscv_nn_decode_attention_s8_s8_s8_get_buffer_size(s->head_dim, s->capacity));
+        a.qk_scaling = nn_bench_alloc(sizeof(riscv_nn_scaling) * s->kv_heads);
+        a.out_scaling = nn_bench_alloc(sizeof(riscv_nn_scaling) * s->kv_heads);
+        nn_bench_fill_s8(a.q, q_size, -128, 127);
+        nn_bench_fill_s8(a.k, kv_size, -127, 127);
+        nn_bench_fill_s8(a.v, kv_size, -127, 127);
+        for (j = 0; j < s->kv_heads; j++)
+        {
+            fill_quant_params(&a.qk_scaling[j].multiplier, &a.qk_scaling[j].shift, 1);
+            a.out_scaling[j].multiplier = nn_bench_rand_range(1 << 30, 0x7FFFFFFF);
+            a.out_scaling[j].shift = 1;
+        }
+        if ((s->k_offset != 0) || (s->v_offset != 0))
+        {
+            a.k_offset = nn_bench_alloc(sizeof(int16_t) * s->kv_heads);
+            a.v_offset = nn_bench_alloc(sizeof(int16_t) * s->kv_heads);
+            for (j = 0; j < s->kv_heads; j++)
+            {
+                a.k_offset[j] = (int16_t)(s->k_offset - (s->k_offset > 0 ? j : -j));
+                a.v_offset[j] = (int16_t)(s->v_offset - (s->v_offset > 0 ? j : -j));
+            }
+        }
+
+        ref_decode_attention_s8(&a);
+        ref_ns = conf_time(ref_decode_attention_s8, &a);
+        conf_check("attention", "riscv_nn_decode_attention_s8_s8_s8 (kv_cache)", s->shape,
+                   run_decode_attention_s8, &a, CONF_S8, a.ref, a.out, q_size, 1, ref_ns);
+
+        free(a.q);
+        free(a.k);
+        free(a.v);
+        free(a.ref);
+        free(a.out);
+        free(a.k_cache);
+        free(a.v_cache);
+        free(a.buf);
+        free(a.qk_scaling);
+        free(a.out_scaling);
+        free(a.k_offset);
+        free(a.v_offset);
+    }
+}
+
+static void conf_parallel(void)
+{
+    char variant[96];
+    int32_t cfg, i;
+
+    for (cfg = 0; cfg < (int32_t)(sizeof(par_configs) / sizeof(par_configs[0])); cfg++)
+    {
+        riscv_nn_set_parallel_dispatcher(par_configs[cfg].dispatch, NULL, par_configs[cfg].threads);
+
+        for (i = 0; i < (int32_t)(sizeof(conv_shapes) / sizeof(conv_shapes[0])); i++)
+        {
+            const conv_shape *s = &conv_shapes[i];
+            conv_args a;
+            double ref_ns;
+
+            // sized exactly, so that a task writing past its slot is caught
+            conv_args_init(&a, s, 0);
+            a.buf = nn_bench_alloc(riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(s->in_x,
+                s->in_y, s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x,
+                s->stride_y, a.out_x, a.out_y, s->out_ch, s->dilation_x, s->dilation_y));
+            run_ref_conv_s8(&a);
+            ref_ns = conf_time(run_conv_wrapper_s8, &a);
+
+            snprintf(variant, sizeof(variant), "riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_mt (%s)",
+                     par_configs[cfg].name);
+            conf_check("parallel", variant, s->shape, run_conv_wrapper_mt_s8, &a, CONF_S8, a.ref, a.out,
+                       conv_out_size(&a), 0, ref_ns);
+            conv_args_free(&a);
+        }
+
+        for (i = 0; i < (int32_t)(sizeof(conv_dw_shapes) / sizeof(conv_dw_shapes[0])); i++)
+        {
+            const conv_shape *s = &conv_dw_shapes[i];
+            conv_args a;
+            double ref_ns;
+
+            conv_args_init(&a, s, 1);
+            a.buf = nn_bench_alloc(riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt_get_buffer_size(s->in_ch,
+                s->out_ch / s->in_ch, s->ker_x, s->ker_y, s->pad_x));
+            run_ref_conv_dw_s8(&a);
+            ref_ns = conf_time(run_conv_dw_wrapper_s8, &a);
+
+            snprintf(variant, sizeof(variant), "riscv_nn_conv_dw_HWC_wrapper_s8_s8_s8_asym_mt (%s)",
+                     par_configs[cfg].name);
+            conf_check("parallel", variant, s->shape, run_conv_dw_wrapper_mt_s8, &a, CONF_S8, a.ref,
+                       a.out, conv_out_size(&a), 0, ref_ns);
+            conv_args_free(&a);
+        }
+
+        for (i = 0; i < (int32_t)(sizeof(fc_shapes) / sizeof(fc_shapes[0])); i++)
+        {
+            const fc_shape *s = &fc_shapes[i];
+            const size_t out_size = (size_t)s->batch * s->row;
+            fc_args a;
+            double ref_ns;
+
+            memset(&a, 0, sizeof(a));
+            a.s = *s;
+            a.in = nn_bench_alloc((size_t)s->batch * s->col);
+            a.wt = nn_bench_alloc((size_t)s->row * s->col);
+            a.ref = nn_bench_alloc(out_size);
+            a.out = nn_bench_alloc(out_size);
+            a.bias = nn_bench_alloc(sizeof(int32_t) * s->row);
+            a.buf = nn_bench_alloc(riscv_nn_fc_s8_s8_s8_asym_bias_mt_get_buffer_size(s->col));
+            nn_bench_fill_s8(a.in, (size_t)s->batch * s->col, -128, 127);
+            nn_bench_fill_s8(a.wt, (size_t)s->row * s->col, -127, 127);
+            nn_bench_fill_s32(a.bias, s->row, -5000, 5000);
+            fill_quant_params(&a.mult, &a.shift, 1);
+            run_ref_fc_s8(&a);
+            ref_ns = conf_time(run_ref_fc_s8, &a);
+
+            snprintf(variant, sizeof(variant), "riscv_nn_fc_s8_s8_s8_asym_bias_mt (%s)",
+                     par_configs[cfg].name);
+            conf_check("parallel", variant, s->shape, run_fc_mt_s8, &a, CONF_S8, a.ref, a.out, out_size, 0,
+                       ref_ns);
+            free(a.in);
+            free(a.wt);
+            free(a.ref);
+            free(a.out);
+            free(a.bias);
+            free(a.buf);
+        }
+
+        for (i = 0; i < (int32_t)(sizeof(bmm_shapes) / sizeof(bmm_shapes[0])); i++)
+        {
+            const bmm_shape *s = &bmm_shapes[i];
+            const size_t lhs_size = (size_t)s->lhs_n * s->lhs_h * s->lhs_w * s->c;
+            const size_t rhs_size = (size_t)s->rhs_n * s->rhs_h * s->rhs_w * s->c;
+            size_t out_size;
+            bmm_args a;
+            double ref_ns;
+
+            memset(&a, 0, sizeof(a));
+            a.s = *s;
+            a.out_n = MAX(s->lhs_n, s->rhs_n);
+            a.out_h = MAX(s->lhs_h, s->rhs_h);
+            out_size = (size_t)a.out_n * a.out_h * s->lhs_w * s->rhs_w;
+            a.lhs = nn_bench_alloc(lhs_size);
+            a.rhs = nn_bench_alloc(rhs_size);
+            a.ref = nn_bench_alloc(out_size);
+            a.out = nn_bench_alloc(out_size);
+            a.bias = nn_bench_alloc(sizeof(int32_t) * s->rhs_w);
+            nn_bench_fill_s8(a.lhs, lhs_size, -128, 127);
+            nn_bench_fill_s8(a.rhs, rhs_size, -127, 127);
+            nn_bench_fill_s32(a.bias, s->rhs_w, -5000, 5000);
+            fill_quant_params(&a.mult, &a.shift, 1);
+            run_ref_bmm_s8(&a);
+            ref_ns = conf_time(run_ref_bmm_s8, &a);
+
+            snprintf(variant, sizeof(variant), "riscv_nn_batch_matmul_s8_s8_s8_mt (%s)",
+                     par_configs[cfg].name);
+            conf_check("parallel", variant, s->shape, run_bmm_mt_s8, &a, CONF_S8, a.ref, a.out, out_size, 0,
+                       ref_ns);
+            free(a.lhs);
+            free(a.rhs);
+            free(a.ref);
+            free(a.out);
+            free(a.bias);
+        }
+    }
+
+    riscv_nn_set_parallel_dispatcher(NULL, NULL, 1);
+}
+
+//==============================================================================
+// Softmax
+//==============================================================================
+
+// The integer softmax kernels approximate exp() with fixed-point arithmetic, so
+// they are compared with a double-precision model of what they compute and a
+// tolerance in output LSBs:
+//  - riscv_nn_softmax_s8_fast is a base-2 softmax with output in q0.7. Its
+//    denominator saturates every exponent to [max - 8, max - 1], so inputs
+//    far below the maximum count as 2^-8 and the maximum itself only as 2^-1;
+//    the model reproduces that and leaves the integer division and shifts as
+//    the error.
+//  - riscv_nn_softmax_s8_hp and _s8_s16_hp follow the TFLite reference with a
+//    Q5.26 scaled input difference and a zero contribution below diff_min.
+#define SOFTMAX_SCALE    1077952576
+#define SOFTMAX_LSHIFT   23
+#define SOFTMAX_DIFF_MIN (-248)
+
+#define SOFTMAX_S8_FAST_TOL  1
+#define SOFTMAX_S8_HP_TOL    1
+#define SOFTMAX_S16_HP_TOL   2
+#define SOFTMAX_F32_ULP_TOL  64
+
+typedef struct
+{
+    const char *shape;
+    int32_t rows, cols;
+} softmax_shape;
+
+typedef struct
+{
+    conf_hdr hdr;
+    softmax_shape s;
+    int8_t *in, *ref, *out;
+    int16_t *ref16, *out16;
+    float *fin, *fref, *fout;
+} softmax_args;
+
+static void run_ref_softmax_s8_fast(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    int32_t r, c;
+
+    for (r = 0; r < a->s.rows; r++)
+    {
+        const int8_t *in = a->in + r * a->s.cols;
+        int32_t max = -128;
+        double sum = 0.0;
+
+        for (c = 0; c < a->s.cols; c++)
+        {
+            max = MAX(max, in[c]);
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            sum += ldexp(1.0, MIN(MAX(in[c] - max, -8), -1));
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            const double p = ldexp(1.0, MAX(in[c] - max, -13)) / sum;
+            a->ref[r * a->s.cols + c] = (int8_t)MIN(lrint(p * 128.0), 127);
+        }
+    }
+}
+
+static void run_ref_softmax_hp(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    const double beta = ldexp((double)SOFTMAX_SCALE, SOFTMAX_LSHIFT - 31 - 26);
+    int32_t r, c;
+
+    for (r = 0; r < a->s.rows; r++)
+    {
+        const int8_t *in = a->in + r * a->s.cols;
+        int32_t max = -128;
+        double sum = 0.0;
+
+        for (c = 0; c < a->s.cols; c++)
+        {
+            max = MAX(max, in[c]);
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            const int32_t diff = in[c] - max;
+            sum += (diff >= SOFTMAX_DIFF_MIN) ? exp(diff * beta) : 0.0;
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            const int32_t diff = in[c] - max;
+            const double p = (diff >= SOFTMAX_DIFF_MIN) ? exp(diff * beta) / sum : 0.0;
+            a->ref[r * a->s.cols + c] = (int8_t)MIN(lrint(p * 256.0) - 128, 127);
+            a->ref16[r * a->s.cols + c] = (int16_t)MIN(lrint(p * 65536.0) - 32768, 32767);
+        }
+    }
+}
+
+static void run_ref_softmax_f32(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    int32_t r, c;
+
+    for (r = 0; r < a->s.rows; r++)
+    {
+        const float *in = a->fin + r * a->s.cols;
+        double max = in[0], sum = 0.0;
+
+        for (c = 1; c < a->s.cols; c++)
+        {
+            max = MAX(max, in[c]);
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            sum += exp(in[c] - max);
+        }
+        for (c = 0; c < a->s.cols; c++)
+        {
+            a->fref[r * a->s.cols + c] = (float)(exp(in[c] - max) / sum);
+        }
+    }
+}
+
+static void run_softmax_s8_fast(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    int32_t r;
+    for (r = 0; r < a->s.rows; r++)
+    {
+        riscv_nn_softmax_s8_fast(a->in + r * a->s.cols, a->s.cols, a->out + r * a->s.cols);
+    }
+}
+
+static void run_softmax_s8_hp(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    riscv_nn_softmax_s8_hp(a->in, a->s.rows, a->s.cols, SOFTMAX_SCALE, SOFTMAX_LSHIFT,
+                           SOFTMAX_DIFF_MIN, a->out);
+}
+
+static void run_softmax_s8_s16_hp(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    riscv_nn_softmax_s8_s16_hp(a->in, a->s.rows, a->s.cols, SOFTMAX_SCALE, SOFTMAX_LSHIFT,
+                               SOFTMAX_DIFF_MIN, a->out16);
+}
+
+static void run_softmax_f32(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    int32_t r;
+    for (r = 0; r < a->s.rows; r++)
+    {
+        a->hdr.status = riscv_nn_softmax_f32(a->fin + r * a->s.cols, a->s.cols, a->fout + r * a->s.cols);
+    }
+}
+
+static void run_softmax_f32_2pass(void *args)
+{
+    softmax_args *a = (softmax_args *)args;
+    int32_t r;
+    for (r = 0; r < a->s.rows; r++)
+    {
+        a->hdr.status = riscv_nn_softmax_f32_2pass(a->fin + r * a->s.cols, a->s.cols,
+                                                   a->fout + r * a->s.cols);
+    }
+}
+
+static const softmax_shape softmax_shapes[] =
+{
+    {"kws_1x12", 1, 12},
+    {"attn_16x64", 16, 64},
+    {"cls_1x1000", 1, 1000},
+};
+
+static void conf_softmax(void)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(softmax_shapes) / sizeof(softmax_shapes[0])); i++)
+    {
+        const softmax_shape *s = &softmax_shapes[i];
+        const size_t size = (size_t)s->rows * s->cols;
+        softmax_args a;
+        double ref_ns;
+
+        memset(&a, 0, sizeof(a));
+        a.s = *s;
+        a.in = nn_bench_alloc(size);
+        a.ref = nn_bench_alloc(size);
+        a.out = nn_bench_alloc(size);
+        a.ref16 = nn_bench_alloc(sizeof(int16_t) * size);
+        a.out16 = nn_bench_alloc(sizeof(int16_t) * size);
+        a.fin = nn_bench_alloc(sizeof(float) * size);
+        a.fref = nn_bench_alloc(sizeof(float) * size);
+        a.fout = nn_bench_alloc(sizeof(float) * size);
+        nn_bench_fill_s8(a.in, size, -128, 127);
+        nn_bench_fill_f32(a.fin, size, -8.0f, 8.0f);
+
+        run_ref_softmax_s8_fast(&a);
+        ref_ns = conf_time(run_ref_softmax_s8_fast, &a);
+        conf_check("softmax_s8", "riscv_nn_softmax_s8_fast", s->shape, run_softmax_s8_fast, &a,
+                   CONF_S8, a.ref, a.out, size, SOFTMAX_S8_FAST_TOL, ref_ns);
+
+        run_ref_softmax_hp(&a);
+        ref_ns = conf_time(run_ref_softmax_hp, &a);
+        conf_check("softmax_s8", "riscv_nn_softmax_s8_hp", s->shape, run_softmax_s8_hp, &a,
+                   CONF_S8, a.ref, a.out, size, SOFTMAX_S8_HP_TOL, ref_ns);
+        conf_check("softmax_s8", "riscv_nn_softmax_s8_s16_hp", s->shape, run_softmax_s8_s16_hp, &a,
+                   CONF_S16, a.ref16, a.out16, size, SOFTMAX_S16_HP_TOL, ref_ns);
+
+        run_ref_softmax_f32(&a);
+        ref_ns = conf_time(run_ref_softmax_f32, &a);
+        conf_check("softmax_f32", "riscv_nn_softmax_f32", s->shape, run_softmax_f32, &a,
+                   CONF_F32, a.fref, a.fout, size, SOFTMAX_F32_ULP_TOL, ref_ns);
+        conf_check("softmax_f32", "riscv_nn_softmax_f32_2pass", s->shape, run_softmax_f32_2pass, &a,
+                   CONF_F32, a.fref, a.fout, size, SOFTMAX_F32_ULP_TOL, ref_ns);
+
+        free(a.in);
+        free(a.ref);
+        free(a.out);
+        free(a.ref16);
+        free(a.out16);
+        free(a.fin);
+        free(a.fref);
+        free(a.fout);
+    }
+}
+
+//==============================================================================
+// Arena planning
+//==============================================================================
+
+// riscv_nn_arena_plan has no numeric output to compare; a plan is checked for
+// aligned offsets and for buffers alive at the same time that share bytes. The
+// row also reports the arena size against the peak of the live sizes, which is
+// a lower bound of any plan.
+
+#define ARENA_ALIGN 16
+
+static void conf_arena_check(const char *shape, riscv_nn_arena_buffer *buf, int32_t num)
+{
+    int32_t *tmp = nn_bench_alloc(riscv_nn_arena_plan_get_buffer_size(num));
+    int32_t arena, live_peak = 0, bad = 0, first = 0, last = 0;
+    int32_t i, j, layer;
+    const char *status;
+
+    if (!conf_selected("arena", "riscv_nn_arena_plan", shape))
+    {
+        free(tmp);
+        return;
+    }
+
+    arena = riscv_nn_arena_plan(buf, num, ARENA_ALIGN, tmp);
+    for (i = 0; i < num; i++)
+    {
+        first = MIN(first, buf[i].first_use);
+        last = MAX(last, buf[i].last_use);
+        bad += (buf[i].offset % ARENA_ALIGN != 0) || (buf[i].offset + buf[i].size > arena);
+        for (j = i + 1; j < num; j++)
+        {
+            const int32_t alive = (buf[i].first_use <= buf[j].last_use) && (buf[j].first_use <= buf[i].last_use);
+            const int32_t share = (buf[i].offset < buf[j].offset + buf[j].size) &&
+                                  (buf[j].offset < buf[i].offset + buf[i].size);
+
+            bad += alive && share;
+        }
+    }
+    for (layer = first; layer <= last; layer++)
+    {
+        int32_t live = 0;
+
+        for (i = 0; i < num; i++)
+        {
+            live += (buf[i].first_use <= layer && layer <= buf[i].last_use) ? buf[i].size : 0;
+        }
+        live_peak = MAX(live_peak, live);
+    }
+
+    status = (arena < 0 || bad) ? "FAIL" : "ok";
+    conf_failures += (arena < 0 || bad) ? 1 : 0;
+    conf_cases++;
+    printf("%-16s %-62s %-20s %-4s %7ld %5ld %12.1f %8.2f\n", "arena", "riscv_nn_arena_plan", shape, status,
+           (long)bad, 0L, 0.0, 0.0);
+    printf("    arena %ld bytes, peak of live buffers %ld bytes\n", (long)arena, (long)live_peak);
+    fflush(stdout);
+    free(tmp);
+}
+
+static void conf_arena(void)
+{
+    riscv_nn_arena_buffer buf[96];
+    int32_t i, num;
+
+    // the conv shapes as a chain of layers: input, scratch and output of
+    // layer i, with the output read by layer i + 1
+    num = 0;
+    for (i = 0; i < (int32_t)(sizeof(conv_shapes) / sizeof(conv_shapes[0])); i++)
+    {
+        const conv_shape *s = &conv_shapes[i];
+        const int32_t out_x = (s->in_x + 2 * s->pad_x - (s->dilation_x * (s->ker_x - 1) + 1)) / s->stride_x + 1;
+        const int32_t out_y = (s->in_y + 2 * s->pad_y - (s->dilation_y * (s->ker_y - 1) + 1)) / s->stride_y + 1;
+
+        if (i == 0)
+        {
+            buf[num++] = (riscv_nn_arena_buffer){s->in_x * s->in_y * s->in_ch * s->batch, 0, 0, 0};
+        }
+        buf[num++] = (riscv_nn_arena_buffer){riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym_get_buffer_size(s->in_x,
+            s->in_y, s->in_ch, s->batch, s->ker_x, s->ker_y, s->ker_ch, s->pad_x, s->pad_y, s->stride_x,
+            s->stride_y, out_x, out_y, s->out_ch, s->dilation_x, s->dilation_y), i, i, 0};
+        buf[num++] = (riscv_nn_arena_buffer){out_x * out_y * s->out_ch * s->batch, i, i + 1, 0};
+    }
+    conf_arena_check("conv_chain", buf, num);
+
+    // a residual network: every block output is also read two blocks later
+    num = 0;
+    for (i = 0; i < 24; i++)
+    {
+        buf[num++] = (riscv_nn_arena_buffer){nn_bench_rand_range(1, 64) * 256, i, i + 1 + 2 * (i % 3 == 0), 0};
+        buf[num++] = (riscv_nn_arena_buffer){nn_bench_rand_range(0, 16) * 100, i, i, 0};
+    }
+    conf_arena_check("residual_24", buf, num);
+
+    // random sizes and lifetimes, including empty buffers
+    for (i = 0; i < 96; i++)
+    {
+        const int32_t first = nn_bench_rand_range(0, 40);
+
+        buf[i] = (riscv_nn_arena_buffer){nn_bench_rand_range(0, 20000), first,
+                                         first + nn_bench_rand_range(0, 10), 0};
+    }
+    conf_arena_check("random_96", buf, 96);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seed = 1;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            conf_filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc)
+        {
+            conf_min_time_ns = (uint64_t)strtoul(argv[++i], NULL, 10) * 1000000ull;
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--no-timing") == 0)
+        {
+            conf_timing = 0;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--filter <substring>] [--min-time-ms <ms>] [--seed <n>] "
+                    "[--no-timing]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    nn_bench_srand(seed);
+    printf("libnn %s conformance, seed %lu\n", get_version_libnn(), (unsigned long)seed);
+    printf("%-16s %-62s %-20s %-4s %7s %5s %12s %8s\n", "group", "variant", "shape", "", "max_err",
+           "tol", "ns/call", "speedup");
+
+    conf_vec_mat_mult();
+    conf_gemm();
+    conf_batch_matmul();
+    conf_attention();
+    conf_decode_attention();
+    conf_convolution();
+    conf_conv_trans();
+    conf_conv_chain();
+    conf_parallel();
+    conf_softmax();
+    conf_arena();
+
+    printf("%d variant(s) checked, %d out of tolerance\n", conf_cases, conf_failures);
+    return conf_failures ? 1 : 0;
+}
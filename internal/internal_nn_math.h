@@ -467,6 +467,97 @@ extern float16_t tanh_f16(float16_t x);
  * register through intructions on the fly.
  ******************************************************************************/
 // #define ENA_UNPACK_S4_TO_TMP_BUF
+
+/*******************************************************************************
+ * Number of weight columns packed at a time into the on-stack RHS panel of the
+ * register-blocked (4x4 and 8x4) s8 matrix multiplication; the panel takes 4
+ * times this many bytes of stack. Layers with more input columns are
+ * processed in blocks.
+ ******************************************************************************/
+#define NN_MAT_MULT_PANEL_K 64
+
+/*******************************************************************************
+ * Number of lhs rows whose accumulators are kept on the stack (16 bytes each)
+ * by the register-blocked s8 matrix multiplication. When the RHS panel is
+ * packed in column blocks, each block is packed once for this many rows.
+ * Keep it a multiple of 8.
+ ******************************************************************************/
+#define NN_MAT_MULT_PANEL_ROWS 8
+
+/*******************************************************************************
+ * Number of output pixels gathered at a time into the temporary buffer by the
+ * im2col path of riscv_nn_conv_HWC_s8_s8_s8_asym_bias_any_dilated. Each pixel
+ * takes ker_dim_x * ker_dim_y * ker_ch bytes of the buffer.
+ ******************************************************************************/
+#define NN_CONV_IM2COL_PIXELS 8
+
+/*******************************************************************************
+ * Bytes of the temporary buffer that the strided 1x1 convolutions (the s8 and
+ * s4 *_fast_any functions) gather input pixels into, in_tensor_ch bytes per
+ * pixel. Each tile is one matrix multiplication, which packs (or unpacks) the
+ * weights once, so at 8192 bytes a layer of up to NN_MAT_MULT_PANEL_K input
+ * channels reads its weights once per 128 or more pixels. Deeper layers
+ * repack them every NN_MAT_MULT_PANEL_ROWS pixels anyway and only get whole
+ * chunks of that many.
+ ******************************************************************************/
+#define NN_CONV_1X1_GATHER_BYTES 8192
+
+// pixels per gather tile of a strided 1x1 convolution: whole chunks of the
+// register-blocked matrix multiplication, at most the output pixels
+__STATIC_FORCEINLINE int32_t nn_conv_1x1_gather_pixels(const int32_t in_ch, const int32_t out_pixels)
+{
+    const int32_t chunks = MAX(NN_CONV_1X1_GATHER_BYTES / (in_ch * NN_MAT_MULT_PANEL_ROWS), 1);
+    return MIN(chunks * NN_MAT_MULT_PANEL_ROWS, out_pixels);
+}
+
+/*******************************************************************************
+ * Smallest batch for which riscv_nn_fc_s8_s8_s8_asym_bias runs its input
+ * vectors as the lhs of one GEMM rather than as one vector-matrix product
+ * each. Smaller batches stream the weights once per vector.
+ ******************************************************************************/
+#define NN_FC_GEMM_MIN_BATCH 2
+
+/*******************************************************************************
+ * Query rows and key/value rows processed together by the fused attention
+ * kernels. Each query tile keeps NN_ATTENTION_Q_TILE * head_dim accumulators
+ * in the temporary buffer, and its scores against one key block take
+ * NN_ATTENTION_Q_TILE * NN_ATTENTION_KV_BLOCK elements of stack, so the full
+ * score matrix is never stored.
+ ******************************************************************************/
+#define NN_ATTENTION_Q_TILE 8
+#define NN_ATTENTION_KV_BLOCK 64
+
+/*******************************************************************************
+ * Number of 2x2 output tiles transformed at a time into the temporary buffer
+ * by the s8 Winograd F(2x2, 3x3) convolution, and the largest number of input
+ * channels for which its int32 transform-domain sums cannot overflow.
+ ******************************************************************************/
+#define NN_CONV_WINOGRAD_TILES 4
+#define NN_CONV_WINOGRAD_S8_MAX_CH 1824
+
+/*******************************************************************************
+ * If below switch is defined, riscv_nn_conv_HWC_wrapper_s8_s8_s8_asym and
+ * riscv_nn_conv_HWC_f16_f16_f16_bias run 3x3 stride-1 layers with the Winograd
+ * kernels. The weights are then transformed on every call into the temporary
+ * buffer, which grows by 32 (s8) or 36 (f16) * in_tensor_ch * out_tensor_ch
+ * bytes or elements. By default, this switch is not enabled; use the
+ * riscv_nn_conv_HWC_3x3_winograd_* functions with offline-transformed weights
+ * instead.
+ ******************************************************************************/
+// #define ENA_CONV_WINOGRAD_IN_WRAPPER
+
+/*******************************************************************************
+ * Largest number of threads the riscv_nn_*_mt functions split a layer into.
+ ******************************************************************************/
+#define NN_PARALLEL_MAX_THREADS 8
+
+/*******************************************************************************
+ * If below switch is defined, riscv_nn_set_parallel_dispatcher falls back to a
+ * built-in pool of POSIX threads when no dispatcher is given, and the
+ * application must be linked with -pthread. By default, this switch is not
+ * enabled; install your own dispatcher or run single-threaded.
+ ******************************************************************************/
+// #define ENA_PARALLEL_PTHREAD
 //----- algorithm switches_end -----
 
 #ifdef  __cplusplus